@@ -12,4 +12,15 @@ enum class DPL2Quality : int
   High = 2,
   Highest = 3
 };
+
+// Interpolation used by the mixer to resample audio to the output sample rate.
+enum class AudioResampler : int
+{
+  // Cheapest, but the most aliasing.
+  Linear = 0,
+  // 6-point, 3rd-order Hermite interpolation.
+  Hermite = 1,
+  // 16-tap windowed sinc, using a polyphase filter table.
+  WindowedSinc = 2,
+};
 }  // namespace AudioCommon
@@ -6,18 +6,30 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <numbers>
 #include <span>
+#include <utility>
+
+#if defined(_M_X86_64)
+#include <xmmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
 
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
+#include "Common/Metrics.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/System.h"
 
+static Common::Metrics::Counter s_underruns{"audio_underruns_total",
+                                           "Times an audio FIFO ran out of samples while running"};
+
 static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 {
   switch (quality)
@@ -33,6 +45,54 @@ static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
   }
 }
 
+// Polyphase windowed sinc filter. Each phase is a 16-tap filter for a fractional position between
+// the 8th and 9th tap.
+constexpr std::size_t SINC_TAPS = 16;
+constexpr int SINC_HALF_TAPS = SINC_TAPS / 2;
+constexpr u32 SINC_PHASE_BITS = 8;
+constexpr std::size_t SINC_PHASES = 1 << SINC_PHASE_BITS;
+
+// Cutoff frequency, relative to the input Nyquist frequency.
+constexpr double SINC_CUTOFF = 0.9;
+
+using SincTable = std::array<std::array<float, SINC_TAPS>, SINC_PHASES>;
+
+static SincTable BuildSincTable()
+{
+  SincTable table{};
+  for (std::size_t phase = 0; phase < SINC_PHASES; ++phase)
+  {
+    const double t = static_cast<double>(phase) / SINC_PHASES;
+    double sum = 0.0;
+    std::array<double, SINC_TAPS> taps;
+    for (std::size_t i = 0; i < SINC_TAPS; ++i)
+    {
+      // Distance of the tap from the position that's being interpolated.
+      const double x = static_cast<double>(i) - (SINC_HALF_TAPS - 1) - t;
+      const double sinc = x == 0.0 ? 1.0 :
+                                     std::sin(std::numbers::pi * SINC_CUTOFF * x) /
+                                         (std::numbers::pi * SINC_CUTOFF * x);
+      // Blackman window, spanning the whole filter.
+      const double w = (x / SINC_HALF_TAPS + 1.0) / 2.0;
+      const double window = 0.42 - 0.5 * std::cos(2.0 * std::numbers::pi * w) +
+                            0.08 * std::cos(4.0 * std::numbers::pi * w);
+      taps[i] = sinc * window;
+      sum += taps[i];
+    }
+
+    // Normalize each phase for unity gain at DC.
+    for (std::size_t i = 0; i < SINC_TAPS; ++i)
+      table[phase][i] = static_cast<float>(taps[i] / sum);
+  }
+  return table;
+}
+
+static const SincTable& GetSincTable()
+{
+  alignas(16) static const SincTable table = BuildSincTable();
+  return table;
+}
+
 Mixer::Mixer(u32 BackendSampleRate)
     : m_output_sample_rate(BackendSampleRate),
       m_surround_decoder(BackendSampleRate,
@@ -41,6 +101,9 @@ Mixer::Mixer(u32 BackendSampleRate)
   m_config_changed_callback_id = Config::AddConfigChangedCallback([this] { RefreshConfig(); });
   RefreshConfig();
 
+  // Build the filter table here rather than on the audio thread.
+  GetSincTable();
+
   INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer is initialized");
 }
 
@@ -98,67 +161,163 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 
   m_granule_queue_size.store(buffer_size_granules, std::memory_order_relaxed);
 
-  while (num_samples-- > 0)
+  const auto mix = [&](auto interpolate) {
+    while (num_samples-- > 0)
+    {
+      // The indexes for the front and back buffers are offset by 50% of the granule size.
+      // We use the modular nature of 32-bit integers to wrap around the granule size.
+      m_current_index += index_jump;
+      const u32 front_index = m_current_index;
+      const u32 back_index = m_current_index + INDEX_HALF;
+
+      // If either index is less than the index jump, that means we reached
+      // the end of the of the buffer and need to load the next granule.
+      if (front_index < index_jump)
+        fade_audio = Dequeue(&m_front);
+      else if (back_index < index_jump)
+        fade_audio = Dequeue(&m_back);
+
+      StereoPair sample = interpolate(front_index, back_index);
+
+      // Apply Fade In / Fade Out depending on if we are looping
+      if (fade_audio)
+        m_fade_volume += fade_out_mul * (0.0f - m_fade_volume);
+      else
+        m_fade_volume += fade_in_mul * (1.0f - m_fade_volume);
+
+      // Apply the fade volume and the regular volume to the sample
+      sample = sample * volume * StereoPair{m_fade_volume};
+
+      // This quantization method prevents accumulated error but does not do noise shaping.
+      sample.l += samples[0] - m_quantization_error.l;
+      samples[0] = MathUtil::SaturatingCast<s16>(std::lround(sample.l));
+      m_quantization_error.l = std::clamp(samples[0] - sample.l, -1.0f, 1.0f);
+
+      sample.r += samples[1] - m_quantization_error.r;
+      samples[1] = MathUtil::SaturatingCast<s16>(std::lround(sample.r));
+      m_quantization_error.r = std::clamp(samples[1] - sample.r, -1.0f, 1.0f);
+
+      samples += 2;
+    }
+  };
+
+  // The resampler is picked once per call, so that each variant of the loop above gets its
+  // interpolator inlined.
+  switch (m_mixer->m_config_audio_resampler)
   {
-    // The indexes for the front and back buffers are offset by 50% of the granule size.
-    // We use the modular nature of 32-bit integers to wrap around the granule size.
-    m_current_index += index_jump;
-    const u32 front_index = m_current_index;
-    const u32 back_index = m_current_index + INDEX_HALF;
-
-    // If either index is less than the index jump, that means we reached
-    // the end of the of the buffer and need to load the next granule.
-    if (front_index < index_jump)
-      fade_audio = Dequeue(&m_front);
-    else if (back_index < index_jump)
-      fade_audio = Dequeue(&m_back);
-
-    // The Granules are pre-windowed, so we can just add them together
-    const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
-    const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
-    const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
-    const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
-    const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
-    const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
-    const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
-    const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
-
-    // Polynomial Interpolators for High-Quality Resampling of
-    // Over Sampled Audio by Olli Niemitalo, October 2001.
-    // Page 43 -- 6-point, 3rd-order Hermite:
-    // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
-    const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
-    const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
-    const float t2 = t1 * t1;
-    const float t3 = t2 * t1;
-
-    StereoPair sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
-                         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
-                         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
-                         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
-                         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
-                         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
-
-    // Apply Fade In / Fade Out depending on if we are looping
-    if (fade_audio)
-      m_fade_volume += fade_out_mul * (0.0f - m_fade_volume);
-    else
-      m_fade_volume += fade_in_mul * (1.0f - m_fade_volume);
+  case AudioCommon::AudioResampler::Linear:
+    mix([this](u32 front, u32 back) { return InterpolateLinear(front, back); });
+    break;
+  case AudioCommon::AudioResampler::WindowedSinc:
+    mix([this](u32 front, u32 back) { return InterpolateWindowedSinc(front, back); });
+    break;
+  case AudioCommon::AudioResampler::Hermite:
+  default:
+    mix([this](u32 front, u32 back) { return InterpolateHermite(front, back); });
+    break;
+  }
+}
 
-    // Apply the fade volume and the regular volume to the sample
-    sample = sample * volume * StereoPair{m_fade_volume};
+Mixer::MixerFifo::StereoPair Mixer::MixerFifo::InterpolateLinear(u32 front_index,
+                                                                 u32 back_index) const
+{
+  const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
+  const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
+  const StereoPair s0 = GetSample(ft, bt, 0);
+  const StereoPair s1 = GetSample(ft, bt, 1);
 
-    // This quantization method prevents accumulated error but does not do noise shaping.
-    sample.l += samples[0] - m_quantization_error.l;
-    samples[0] = MathUtil::SaturatingCast<s16>(std::lround(sample.l));
-    m_quantization_error.l = std::clamp(samples[0] - sample.l, -1.0f, 1.0f);
+  const u32 t_frac = front_index & ((1 << GRANULE_FRAC_BITS) - 1);
+  const float t = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
 
-    sample.r += samples[1] - m_quantization_error.r;
-    samples[1] = MathUtil::SaturatingCast<s16>(std::lround(sample.r));
-    m_quantization_error.r = std::clamp(samples[1] - sample.r, -1.0f, 1.0f);
+  return s0 * StereoPair{1.0f - t} + s1 * StereoPair{t};
+}
 
-    samples += 2;
+Mixer::MixerFifo::StereoPair Mixer::MixerFifo::InterpolateHermite(u32 front_index,
+                                                                  u32 back_index) const
+{
+  // The Granules are pre-windowed, so we can just add them together
+  const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
+  const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
+  const StereoPair s0 = GetSample(ft, bt, -2);
+  const StereoPair s1 = GetSample(ft, bt, -1);
+  const StereoPair s2 = GetSample(ft, bt, 0);
+  const StereoPair s3 = GetSample(ft, bt, 1);
+  const StereoPair s4 = GetSample(ft, bt, 2);
+  const StereoPair s5 = GetSample(ft, bt, 3);
+
+  // Polynomial Interpolators for High-Quality Resampling of
+  // Over Sampled Audio by Olli Niemitalo, October 2001.
+  // Page 43 -- 6-point, 3rd-order Hermite:
+  // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
+  const u32 t_frac = front_index & ((1 << GRANULE_FRAC_BITS) - 1);
+  const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
+  const float t2 = t1 * t1;
+  const float t3 = t2 * t1;
+
+  return s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
+         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
+         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
+         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
+         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
+         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f};
+}
+
+Mixer::MixerFifo::StereoPair Mixer::MixerFifo::InterpolateWindowedSinc(u32 front_index,
+                                                                       u32 back_index) const
+{
+  const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
+  const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
+
+  // Gather the taps around the current position, deinterleaved so that the filter can be
+  // applied to both channels with the same coefficient vectors.
+  alignas(16) std::array<float, SINC_TAPS> left;
+  alignas(16) std::array<float, SINC_TAPS> right;
+  for (int i = 0; i < static_cast<int>(SINC_TAPS); ++i)
+  {
+    const StereoPair sample = GetSample(ft, bt, i - SINC_HALF_TAPS + 1);
+    left[i] = sample.l;
+    right[i] = sample.r;
   }
+
+  const u32 phase = (front_index & ((1 << GRANULE_FRAC_BITS) - 1)) >>
+                    (GRANULE_FRAC_BITS - SINC_PHASE_BITS);
+  const std::array<float, SINC_TAPS>& coefficients = GetSincTable()[phase];
+
+#if defined(_M_X86_64)
+  __m128 sum_l = _mm_setzero_ps();
+  __m128 sum_r = _mm_setzero_ps();
+  for (std::size_t i = 0; i < SINC_TAPS; i += 4)
+  {
+    const __m128 c = _mm_load_ps(&coefficients[i]);
+    sum_l = _mm_add_ps(sum_l, _mm_mul_ps(_mm_load_ps(&left[i]), c));
+    sum_r = _mm_add_ps(sum_r, _mm_mul_ps(_mm_load_ps(&right[i]), c));
+  }
+  // Horizontal sum of both accumulators: [l0+l1, l2+l3, r0+r1, r2+r3], then pairwise again.
+  const __m128 lo = _mm_shuffle_ps(sum_l, sum_r, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m128 hi = _mm_shuffle_ps(sum_l, sum_r, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m128 pairs = _mm_add_ps(lo, hi);
+  const __m128 swapped = _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128 sums = _mm_add_ps(pairs, swapped);
+  return StereoPair{_mm_cvtss_f32(sums), _mm_cvtss_f32(_mm_movehl_ps(sums, sums))};
+#elif defined(_M_ARM_64)
+  float32x4_t sum_l = vdupq_n_f32(0.0f);
+  float32x4_t sum_r = vdupq_n_f32(0.0f);
+  for (std::size_t i = 0; i < SINC_TAPS; i += 4)
+  {
+    const float32x4_t c = vld1q_f32(&coefficients[i]);
+    sum_l = vmlaq_f32(sum_l, vld1q_f32(&left[i]), c);
+    sum_r = vmlaq_f32(sum_r, vld1q_f32(&right[i]), c);
+  }
+  return StereoPair{vaddvq_f32(sum_l), vaddvq_f32(sum_r)};
+#else
+  StereoPair sum;
+  for (std::size_t i = 0; i < SINC_TAPS; ++i)
+  {
+    sum.l += left[i] * coefficients[i];
+    sum.r += right[i] * coefficients[i];
+  }
+  return sum;
+#endif
 }
 
 std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
@@ -428,6 +587,7 @@ void Mixer::RefreshConfig()
 {
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_audio_preserve_pitch = Config::Get(Config::MAIN_AUDIO_PRESERVE_PITCH);
+  m_config_audio_resampler = Config::Get(Config::MAIN_AUDIO_RESAMPLER);
   m_config_fill_audio_gaps = Config::Get(Config::MAIN_AUDIO_FILL_GAPS);
   m_config_audio_buffer_ms = Config::Get(Config::MAIN_AUDIO_BUFFER_SIZE);
   m_config_wiimote_routing_enabled = Config::Get(Config::MAIN_WIIMOTE_AUDIO_ROUTING_ENABLED);
@@ -570,6 +730,9 @@ bool Mixer::MixerFifo::Dequeue(Granule* granule)
   {
     // Only fill gaps when running to prevent stutter on pause.
     const bool is_running = Core::GetState(Core::System::GetInstance()) == Core::State::Running;
+    if (is_running && !std::exchange(m_queue_empty, true))
+      s_underruns.Add();
+
     if (m_mixer->m_config_fill_audio_gaps && is_running)
     {
       // Jump the playhead to half the queue size behind the head.
@@ -589,6 +752,10 @@ bool Mixer::MixerFifo::Dequeue(Granule* granule)
       return false;
     }
   }
+  else
+  {
+    m_queue_empty = false;
+  }
 
   *granule = m_queue[tail];
   m_queue_tail.store(next_tail, std::memory_order_release);
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <bit>
 
+#include "AudioCommon/Enums.h"
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
@@ -151,11 +152,28 @@ private:
     std::atomic<std::size_t> m_queue_tail{0};
     std::atomic<bool> m_queue_fading{false};
     std::atomic<bool> m_queue_looping{false};
+    // Whether the queue has run dry, so that each underrun is only counted once. Starts out set
+    // so that FIFOs which never receive samples don't count as underrunning.
+    bool m_queue_empty = true;
     float m_fade_volume = 1.0;
 
     void Enqueue();
     bool Dequeue(Granule* granule);
 
+    // Returns the sample of the overlapped front and back granules, <offset> samples away from
+    // the given integer positions.
+    StereoPair GetSample(std::size_t front_pos, std::size_t back_pos, int offset) const
+    {
+      return m_front[(front_pos + offset) & GRANULE_MASK] +
+             m_back[(back_pos + offset) & GRANULE_MASK];
+    }
+
+    // Interpolators for the output sample at the given granule indexes. The fractional part of
+    // both indexes is the same.
+    StereoPair InterpolateLinear(u32 front_index, u32 back_index) const;
+    StereoPair InterpolateHermite(u32 front_index, u32 back_index) const;
+    StereoPair InterpolateWindowedSinc(u32 front_index, u32 back_index) const;
+
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
@@ -196,6 +214,7 @@ private:
 
   float m_config_emulation_speed;
   bool m_config_audio_preserve_pitch;
+  AudioCommon::AudioResampler m_config_audio_resampler;
   bool m_config_fill_audio_gaps;
   int m_config_audio_buffer_ms;
   bool m_config_wiimote_routing_enabled = false;
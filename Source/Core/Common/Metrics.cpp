@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Metrics.h"
+
+#include <fmt/format.h>
+
+namespace Common::Metrics
+{
+namespace
+{
+// Head of an intrusive list of all metrics. Metrics are only ever added, so readers can walk the
+// list without synchronizing with registration beyond loading the head.
+constinit std::atomic<Metric*> s_head = nullptr;
+}  // namespace
+
+Metric::Metric(const char* name, const char* help, Type type)
+    : m_name(name), m_help(help), m_type(type)
+{
+  m_next = s_head.load(std::memory_order_relaxed);
+  while (!s_head.compare_exchange_weak(m_next, this, std::memory_order_release,
+                                       std::memory_order_relaxed))
+  {
+  }
+}
+
+double Metric::GetValue() const
+{
+  const u64 value = m_value.load(std::memory_order_relaxed);
+  return m_type == Type::Counter ? static_cast<double>(value) : std::bit_cast<double>(value);
+}
+
+void ForEach(const std::function<void(const Metric&)>& callback)
+{
+  for (const Metric* metric = s_head.load(std::memory_order_acquire); metric;
+       metric = metric->m_next)
+  {
+    callback(*metric);
+  }
+}
+
+std::string FormatText()
+{
+  std::string out;
+  ForEach([&out](const Metric& metric) {
+    const bool is_counter = metric.GetType() == Metric::Type::Counter;
+    out += fmt::format("# HELP dolphin_{0} {1}\n# TYPE dolphin_{0} {2}\n", metric.GetName(),
+                       metric.GetHelp(), is_counter ? "counter" : "gauge");
+    // Counters are printed as integers so that large counts don't lose precision.
+    if (is_counter)
+    {
+      const u64 count = static_cast<const Counter&>(metric).Get();
+      out += fmt::format("dolphin_{} {}\n", metric.GetName(), count);
+    }
+    else
+    {
+      out += fmt::format("dolphin_{} {}\n", metric.GetName(), metric.GetValue());
+    }
+  });
+  return out;
+}
+}  // namespace Common::Metrics
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// A registry of named counters and gauges for hot paths, which can be read from any thread.
+//
+// Metrics are defined as objects with static storage duration next to the code that updates them,
+// and register themselves on construction:
+//
+//   static Common::Metrics::Counter s_blocks_compiled{"jit_blocks_compiled",
+//                                                      "JIT blocks compiled"};
+//   ...
+//   s_blocks_compiled.Add();
+//
+// Updating a metric is a single relaxed atomic operation, and the registry never takes a lock.
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common::Metrics
+{
+class Metric
+{
+public:
+  enum class Type
+  {
+    Counter,
+    Gauge,
+  };
+
+  Metric(const Metric&) = delete;
+  Metric& operator=(const Metric&) = delete;
+
+  const char* GetName() const { return m_name; }
+  const char* GetHelp() const { return m_help; }
+  Type GetType() const { return m_type; }
+  double GetValue() const;
+
+protected:
+  Metric(const char* name, const char* help, Type type);
+
+  // The count for counters, and the bit pattern of the value for gauges.
+  std::atomic<u64> m_value = 0;
+
+private:
+  friend void ForEach(const std::function<void(const Metric&)>& callback);
+
+  const char* m_name;
+  const char* m_help;
+  Type m_type;
+  Metric* m_next = nullptr;
+};
+
+// A value that only goes up, such as the number of times something happened.
+class Counter final : public Metric
+{
+public:
+  Counter(const char* name, const char* help) : Metric(name, help, Type::Counter) {}
+
+  void Add(u64 amount = 1) { m_value.fetch_add(amount, std::memory_order_relaxed); }
+  u64 Get() const { return m_value.load(std::memory_order_relaxed); }
+};
+
+// A value that can go up and down, such as the length of a queue.
+class Gauge final : public Metric
+{
+public:
+  Gauge(const char* name, const char* help) : Metric(name, help, Type::Gauge)
+  {
+    m_value.store(std::bit_cast<u64>(0.0), std::memory_order_relaxed);
+  }
+
+  void Set(double value) { m_value.store(std::bit_cast<u64>(value), std::memory_order_relaxed); }
+  double Get() const { return std::bit_cast<double>(m_value.load(std::memory_order_relaxed)); }
+};
+
+// Adds the time between construction and destruction to a counter, in nanoseconds.
+class ScopedTimer final
+{
+public:
+  explicit ScopedTimer(Counter& counter)
+      : m_counter(counter), m_start(std::chrono::steady_clock::now())
+  {
+  }
+
+  ~ScopedTimer()
+  {
+    const auto elapsed = std::chrono::steady_clock::now() - m_start;
+    m_counter.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  Counter& m_counter;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+// Calls the callback for every registered metric, most recently registered first.
+void ForEach(const std::function<void(const Metric&)>& callback);
+
+// Formats the current value of all metrics in the Prometheus text exposition format.
+std::string FormatText();
+}  // namespace Common::Metrics
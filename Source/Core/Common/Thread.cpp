@@ -27,6 +27,7 @@
 #endif
 
 #include "Common/CommonTypes.h"
+#include "Common/Tracing.h"
 #ifdef _WIN32
 #include "Common/StringUtil.h"
 #endif
@@ -115,6 +116,7 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+  Tracing::SetCurrentThreadName(name);
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -185,6 +187,7 @@ void SetCurrentThreadName(const char* name)
   // API.
   __itt_thread_set_name(name);
 #endif
+  Tracing::SetCurrentThreadName(name);
 }
 
 std::tuple<void*, size_t> GetCurrentThreadStack()
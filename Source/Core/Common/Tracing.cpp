@@ -0,0 +1,251 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Tracing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+
+namespace Common::Tracing
+{
+namespace detail
+{
+std::atomic<bool> s_enabled = false;
+
+u64 Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace detail
+
+namespace
+{
+// Each thread keeps the most recent spans up to this limit (8 MiB per thread).
+constexpr size_t MAX_SPANS_PER_THREAD = 1 << 18;
+
+struct Span
+{
+  const char* category;
+  const char* name;
+  u64 start;
+  u64 end;
+};
+
+struct ThreadBuffer
+{
+  // Only contended while exporting, so that a thread which is still finishing a span after
+  // Stop() doesn't race with the export.
+  std::mutex mutex;
+  std::string name;
+  u32 tid = 0;
+  // Spans are only valid if this matches s_generation; otherwise they are from an earlier trace.
+  u32 generation = 0;
+  // Total number of spans recorded. Once the buffer is full, new spans replace the oldest ones.
+  u64 count = 0;
+  std::vector<Span> spans;
+  bool thread_exited = false;
+};
+
+std::mutex s_buffers_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+u32 s_next_tid = 1;
+std::atomic<u32> s_generation = 0;
+u64 s_start_time = 0;
+
+std::mutex s_names_mutex;
+std::unordered_set<std::string> s_names;
+
+// Marks the buffer of a thread as no longer in use when the thread exits. The buffer itself is
+// kept until the next Start(), so that the spans of the thread can still be exported.
+struct ThreadState
+{
+  ~ThreadState()
+  {
+    if (!buffer)
+      return;
+
+    std::lock_guard lock(buffer->mutex);
+    buffer->thread_exited = true;
+  }
+
+  ThreadBuffer* buffer = nullptr;
+  std::string name;
+};
+
+thread_local ThreadState t_state;
+
+ThreadBuffer* GetThreadBuffer()
+{
+  if (!t_state.buffer) [[unlikely]]
+  {
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->name = t_state.name;
+
+    std::lock_guard lock(s_buffers_mutex);
+    buffer->tid = s_next_tid++;
+    t_state.buffer = buffer.get();
+    s_buffers.push_back(std::move(buffer));
+  }
+
+  return t_state.buffer;
+}
+
+void AppendEscaped(std::string* out, std::string_view str)
+{
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out->push_back('\\');
+      out->push_back(c);
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      *out += fmt::format("\\u{:04x}", c);
+    }
+    else
+    {
+      out->push_back(c);
+    }
+  }
+}
+
+double ToMicroseconds(u64 ns)
+{
+  return static_cast<double>(ns) / 1000.0;
+}
+}  // namespace
+
+namespace detail
+{
+void Record(const char* category, const char* name, u64 start, u64 end)
+{
+  ThreadBuffer* const buffer = GetThreadBuffer();
+  const u32 generation = s_generation.load(std::memory_order_relaxed);
+
+  std::lock_guard lock(buffer->mutex);
+  if (buffer->generation != generation) [[unlikely]]
+  {
+    buffer->generation = generation;
+    buffer->count = 0;
+    buffer->spans.clear();
+  }
+
+  const Span span{category, name, start, end};
+  if (buffer->spans.size() < MAX_SPANS_PER_THREAD)
+    buffer->spans.push_back(span);
+  else
+    buffer->spans[buffer->count % MAX_SPANS_PER_THREAD] = span;
+  ++buffer->count;
+}
+}  // namespace detail
+
+void Start()
+{
+  {
+    std::lock_guard lock(s_buffers_mutex);
+    std::erase_if(s_buffers, [](const std::unique_ptr<ThreadBuffer>& buffer) {
+      std::lock_guard buffer_lock(buffer->mutex);
+      return buffer->thread_exited;
+    });
+
+    // Buffers of running threads are cleared by their own thread on the next span.
+    s_generation.fetch_add(1, std::memory_order_relaxed);
+    s_start_time = detail::Now();
+  }
+
+  detail::s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Stop()
+{
+  detail::s_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool ExportChromeTrace(const std::string& path)
+{
+  File::IOFile file(path, "wb");
+  if (!file)
+    return false;
+
+  std::string out = "{\"traceEvents\":[\n";
+  bool first = true;
+  const auto begin_event = [&] {
+    if (!first)
+      out += ",\n";
+    first = false;
+  };
+
+  std::lock_guard lock(s_buffers_mutex);
+  const u32 generation = s_generation.load(std::memory_order_relaxed);
+
+  for (const std::unique_ptr<ThreadBuffer>& buffer : s_buffers)
+  {
+    std::lock_guard buffer_lock(buffer->mutex);
+    if (buffer->generation != generation || buffer->spans.empty())
+      continue;
+
+    begin_event();
+    out += fmt::format(R"({{"ph":"M","pid":1,"tid":{},"name":"thread_name","args":{{"name":")",
+                       buffer->tid);
+    AppendEscaped(&out, buffer->name.empty() ? fmt::format("Thread {}", buffer->tid) :
+                                               buffer->name);
+    out += "\"}}";
+
+    // Write the spans oldest first.
+    const size_t num_spans = buffer->spans.size();
+    const size_t oldest = buffer->count > num_spans ? buffer->count % num_spans : 0;
+    for (size_t i = 0; i < num_spans; ++i)
+    {
+      const Span& span = buffer->spans[(oldest + i) % num_spans];
+      if (span.start < s_start_time)
+        continue;
+
+      begin_event();
+      out += "{\"ph\":\"X\",\"cat\":\"";
+      AppendEscaped(&out, span.category);
+      out += "\",\"name\":\"";
+      AppendEscaped(&out, span.name);
+      out += fmt::format(R"(","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})", buffer->tid,
+                         ToMicroseconds(span.start - s_start_time),
+                         ToMicroseconds(span.end - span.start));
+
+      if (out.size() >= 1 << 20)
+      {
+        if (!file.WriteString(out))
+          return false;
+        out.clear();
+      }
+    }
+  }
+
+  out += "\n]}\n";
+  return file.WriteString(out);
+}
+
+void SetCurrentThreadName(std::string_view name)
+{
+  t_state.name = name;
+  if (!t_state.buffer)
+    return;
+
+  std::lock_guard lock(t_state.buffer->mutex);
+  t_state.buffer->name = name;
+}
+
+const char* InternName(std::string_view name)
+{
+  std::lock_guard lock(s_names_mutex);
+  return s_names.emplace(name).first->c_str();
+}
+}  // namespace Common::Tracing
@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Lightweight span tracing for finding out where time goes across the emulation threads.
+//
+// Code that is worth seeing on a timeline is wrapped in TRACE_SCOPE. While tracing is running,
+// each span is recorded into a buffer that belongs to the recording thread, so threads never
+// contend with each other. When tracing isn't running, a span costs a single relaxed load.
+// The recorded spans can be exported in the Chrome trace event format, which can be opened in
+// chrome://tracing or https://ui.perfetto.dev.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+#include "Common/CommonTypes.h"
+
+namespace Common::Tracing
+{
+namespace detail
+{
+extern std::atomic<bool> s_enabled;
+
+u64 Now();
+void Record(const char* category, const char* name, u64 start, u64 end);
+}  // namespace detail
+
+inline bool IsEnabled()
+{
+  return detail::s_enabled.load(std::memory_order_relaxed);
+}
+
+// Discards all previously recorded spans and starts recording.
+void Start();
+void Stop();
+
+// Writes the spans recorded since the last call to Start to a JSON file.
+bool ExportChromeTrace(const std::string& path);
+
+// Sets the name the current thread is shown with. Common::SetCurrentThreadName calls this.
+void SetCurrentThreadName(std::string_view name);
+
+// Span names and categories must outlive the trace. This returns a copy of the given string
+// which is never freed, for names that are built at runtime.
+const char* InternName(std::string_view name);
+
+class ScopedSpan final
+{
+public:
+  ScopedSpan(const char* category, const char* name) : m_category(category), m_name(name)
+  {
+    if (IsEnabled()) [[unlikely]]
+    {
+      m_active = true;
+      m_start = detail::Now();
+    }
+  }
+
+  ~ScopedSpan()
+  {
+    if (m_active) [[unlikely]]
+      detail::Record(m_category, m_name, m_start, detail::Now());
+  }
+
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+private:
+  const char* m_category;
+  const char* m_name;
+  u64 m_start = 0;
+  bool m_active = false;
+};
+}  // namespace Common::Tracing
+
+#define TRACE_SCOPE_CONCAT_INNER(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(category, name)                                                                \
+  Common::Tracing::ScopedSpan TRACE_SCOPE_CONCAT(trace_scope_, __LINE__)(category, name)
@@ -0,0 +1,60 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// A lock-free way for a producer thread to hand the latest version of a value to a consumer thread.
+// Neither thread ever waits for the other: the producer fills a buffer the consumer can't see and
+// publishes it, and the consumer switches to the most recently published buffer whenever it wants
+// a new snapshot. Intermediate values the consumer didn't pick up in time are skipped.
+
+#include <array>
+#include <atomic>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+template <typename T>
+class TripleBuffer final
+{
+public:
+  TripleBuffer() = default;
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // The following are only safe from the "producer thread":
+  T& GetWriteBuffer() { return m_buffers[m_write_index]; }
+
+  void Publish()
+  {
+    const u8 previous = m_middle.exchange(m_write_index | FRESH_BIT, std::memory_order_acq_rel);
+    m_write_index = previous & INDEX_MASK;
+  }
+
+  // The following are only safe from the "consumer thread":
+  // Returns whether a new value was published since the last call.
+  bool Update()
+  {
+    if (!(m_middle.load(std::memory_order_relaxed) & FRESH_BIT))
+      return false;
+
+    const u8 previous = m_middle.exchange(m_read_index, std::memory_order_acq_rel);
+    m_read_index = previous & INDEX_MASK;
+    return true;
+  }
+
+  const T& GetReadBuffer() const { return m_buffers[m_read_index]; }
+
+private:
+  static constexpr u8 INDEX_MASK = 0x3;
+  // Set in m_middle when it holds a buffer the consumer hasn't seen yet.
+  static constexpr u8 FRESH_BIT = 0x4;
+
+  std::array<T, 3> m_buffers{};
+  u8 m_write_index = 0;
+  std::atomic<u8> m_middle = 1;
+  u8 m_read_index = 2;
+};
+}  // namespace Common
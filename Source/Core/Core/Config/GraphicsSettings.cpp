@@ -117,6 +117,9 @@ const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE{
 const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION{
     {System::GFX, "Settings", "PreferVSForLinePointExpansion"}, false};
 const Info<bool> GFX_CPU_CULL{{System::GFX, "Settings", "CPUCull"}, false};
+const Info<bool> GFX_CACHE_DISPLAY_LISTS{{System::GFX, "Settings", "CacheDisplayLists"}, false};
+const Info<bool> GFX_CACHE_DISPLAY_LIST_VERTICES{
+    {System::GFX, "Settings", "CacheDisplayListVertices"}, false};
 
 const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS{
     {System::GFX, "Settings", "ManuallyUploadBuffers"}, TriState::Auto};
@@ -77,6 +77,8 @@ const Info<int> MAIN_AUDIO_LATENCY{{System::Main, "Core", "AudioLatency"}, 20};
 const Info<int> MAIN_AUDIO_BUFFER_SIZE{{System::Main, "Core", "AudioBufferSize"}, 80};
 const Info<bool> MAIN_AUDIO_FILL_GAPS{{System::Main, "Core", "AudioFillGaps"}, true};
 const Info<bool> MAIN_AUDIO_PRESERVE_PITCH{{System::Main, "Core", "AudioPreservePitch"}, false};
+const Info<AudioCommon::AudioResampler> MAIN_AUDIO_RESAMPLER{
+    {System::Main, "Core", "AudioResampler"}, AudioCommon::AudioResampler::Hermite};
 const Info<std::string> MAIN_MEMCARD_A_PATH{{System::Main, "Core", "MemcardAPath"}, ""};
 const Info<std::string> MAIN_MEMCARD_B_PATH{{System::Main, "Core", "MemcardBPath"}, ""};
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot)
@@ -272,6 +274,10 @@ GPUDeterminismMode GetGPUDeterminismMode()
 }
 
 const Info<std::string> MAIN_PERF_MAP_DIR{{System::Main, "Core", "PerfMapDir"}, ""};
+// If set, spans are traced while the emulation is running and written to this file when it stops.
+const Info<std::string> MAIN_TRACE_FILE{{System::Main, "Core", "TraceFile"}, ""};
+// If set, metrics are served on a unix domain socket at this path while the emulation is running.
+const Info<std::string> MAIN_METRICS_SOCKET{{System::Main, "Core", "MetricsSocket"}, ""};
 const Info<bool> MAIN_CUSTOM_RTC_ENABLE{{System::Main, "Core", "EnableCustomRTC"}, false};
 // Measured in seconds since the unix epoch (1.1.1970).  Default is 1.1.2000; there are 7 leap years
 // between those dates.
@@ -307,8 +313,11 @@ const Info<bool> MAIN_DISABLE_SCREENSAVER{{System::Main, "Display", "DisableScre
 // Main.DSP
 
 const Info<bool> MAIN_DSP_THREAD{{System::Main, "DSP", "DSPThread"}, false};
+const Info<bool> MAIN_DSP_HLE_THREAD{{System::Main, "DSP", "HLEThread"}, false};
 const Info<bool> MAIN_DSP_CAPTURE_LOG{{System::Main, "DSP", "CaptureLog"}, false};
 const Info<bool> MAIN_DSP_JIT{{System::Main, "DSP", "EnableJIT"}, true};
+// Use the cached interpreter even when the DSP JIT is available.
+const Info<bool> MAIN_DSP_CACHED_INTERPRETER{{System::Main, "DSP", "CachedInterpreter"}, false};
 const Info<bool> MAIN_DUMP_AUDIO{{System::Main, "DSP", "DumpAudio"}, false};
 const Info<bool> MAIN_DUMP_AUDIO_SILENT{{System::Main, "DSP", "DumpAudioSilent"}, false};
 const Info<bool> MAIN_DUMP_UCODE{{System::Main, "DSP", "DumpUCode"}, false};
@@ -337,6 +346,7 @@ const Info<std::string> MAIN_WII_SD_CARD_IMAGE_PATH{{System::Main, "General", "W
 const Info<std::string> MAIN_WII_SD_CARD_SYNC_FOLDER_PATH{
     {System::Main, "General", "WiiSDCardSyncFolder"}, ""};
 const Info<std::string> MAIN_WFS_PATH{{System::Main, "General", "WFSPath"}, ""};
+const Info<std::string> MAIN_BASE_USER_PATH{{System::Main, "General", "BaseUserPath"}, ""};
 const Info<bool> MAIN_SHOW_LAG{{System::Main, "General", "ShowLag"}, false};
 const Info<bool> MAIN_SHOW_FRAME_COUNT{{System::Main, "General", "ShowFrameCount"}, false};
 const Info<std::string> MAIN_WIRELESS_MAC{{System::Main, "General", "WirelessMac"}, ""};
@@ -526,6 +536,7 @@ const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY{{System::Main, "Movie", "ShowInpu
 const Info<bool> MAIN_MOVIE_SHOW_RTC{{System::Main, "Movie", "ShowRTC"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RERECORD{{System::Main, "Movie", "ShowRerecord"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_OSD{{System::Main, "Movie", "ShowMovieWindow"}, false};
+const Info<u32> MAIN_MOVIE_KEYFRAME_INTERVAL{{System::Main, "Movie", "KeyframeInterval"}, 0};
 
 // Main.Input
 
@@ -906,6 +917,21 @@ bool IsDefaultGCIFolderPathConfigured(ExpansionInterface::Slot slot)
   return Config::Get(GetInfoForGCIPath(slot)).empty();
 }
 
+std::string GetPathInBaseUserDirectory(std::string_view path)
+{
+  std::string base_user_path = Config::Get(MAIN_BASE_USER_PATH);
+  const std::string& user_path = File::GetUserPath(D_USER_IDX);
+  if (base_user_path.empty() || !path.starts_with(user_path))
+    return {};
+
+  UnifyPathSeparators(base_user_path);
+  if (!base_user_path.ends_with('/'))
+    base_user_path += '/';
+  if (base_user_path == user_path)
+    return {};
+  return base_user_path + std::string(path.substr(user_path.size()));
+}
+
 bool AreCheatsEnabled()
 {
   return Config::Get(::Config::MAIN_ENABLE_CHEATS);
@@ -35,6 +35,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
+#include "Common/Tracing.h"
 #include "Common/Version.h"
 
 #include "Core/AchievementManager.h"
@@ -75,6 +76,7 @@
 
 #ifdef USE_MEMORYWATCHER
 #include "Core/MemoryWatcher.h"
+#include "Core/MetricsServer.h"
 #endif
 
 #include "DiscIO/RiivolutionPatcher.h"
@@ -114,6 +116,7 @@ static std::atomic<State> s_state = State::Uninitialized;
 
 #ifdef USE_MEMORYWATCHER
 static std::unique_ptr<MemoryWatcher> s_memory_watcher;
+static std::unique_ptr<MetricsServer> s_metrics_server;
 #endif
 
 static void Callback_FramePresented(const PresentInfo& present_info);
@@ -341,6 +344,11 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
 
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher = std::make_unique<MemoryWatcher>();
+  if (const std::string metrics_socket = Config::Get(Config::MAIN_METRICS_SOCKET);
+      !metrics_socket.empty())
+  {
+    s_metrics_server = std::make_unique<MetricsServer>(system, metrics_socket);
+  }
 #endif
 
   if (savestate_path)
@@ -388,6 +396,7 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
 
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher.reset();
+  s_metrics_server.reset();
 #endif
 
   if (exception_handler)
@@ -526,6 +535,21 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
   Common::SetCurrentThreadName("Emuthread - Starting");
 
+  // Declared early so that spans from shutting down the other threads are included.
+  const std::string trace_file = Config::Get(Config::MAIN_TRACE_FILE);
+  if (!trace_file.empty())
+    Common::Tracing::Start();
+  Common::ScopeGuard trace_guard{[&trace_file] {
+    if (trace_file.empty())
+      return;
+
+    Common::Tracing::Stop();
+    if (Common::Tracing::ExportChromeTrace(trace_file))
+      NOTICE_LOG_FMT(CORE, "Wrote trace to {}", trace_file);
+    else
+      ERROR_LOG_FMT(CORE, "Failed to write trace to {}", trace_file);
+  }};
+
   // This will become the CPU thread.
   DeclareAsCPUThread();
 
@@ -16,12 +16,14 @@
 #include "Common/Logging/Log.h"
 #include "Common/SPSCQueue.h"
 #include "Common/ScopeGuard.h"
+#include "Common/Tracing.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/Movie.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -70,7 +72,8 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
              "during Init to avoid breaking save states.",
              name);
 
-  auto info = m_event_types.emplace(name, EventType{std::move(callback), nullptr});
+  auto info = m_event_types.emplace(
+      name, EventType{std::move(callback), nullptr, Common::Tracing::InternName(name)});
   EventType* event_type = &info.first->second;
   event_type->name = &info.first->first;
   return event_type;
@@ -366,6 +369,7 @@ void CoreTimingManager::Advance()
     Event evt = m_event_queue.front();
     std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
     m_event_queue.pop_back();
+    TRACE_SCOPE("CoreTiming", evt.type->trace_name);
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
@@ -396,7 +400,8 @@ TimePoint CoreTimingManager::CalculateTargetHostTimeInternal(s64 target_cycle)
 
 bool CoreTimingManager::IsSpeedUnlimited() const
 {
-  return m_throttle_adj_clock_per_sec == 0 || Core::GetIsThrottlerTempDisabled();
+  return m_throttle_adj_clock_per_sec == 0 || Core::GetIsThrottlerTempDisabled() ||
+         m_system.GetMovie().IsSeeking();
 }
 
 TimePoint CoreTimingManager::GetTargetHostTime(s64 target_cycle)
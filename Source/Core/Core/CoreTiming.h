@@ -55,6 +55,8 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+  // Copy of the name that outlives the event type, for span tracing.
+  const char* trace_name;
 };
 
 struct Event
@@ -3,8 +3,10 @@
 
 #include "Core/DSP/DSPAnalyzer.h"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <iterator>
 
 #include "Common/Logging/Log.h"
 
@@ -60,6 +62,81 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0, 0},
 };
 
+// Polling loops are at most this many words long, including the branch back to the start.
+constexpr u16 MAX_IDLE_LOOP_SIZE = 8;
+
+// Hardware registers which are changed by reading them: the accelerator data registers advance the
+// accelerator, and the low halves of the mailboxes clear their full bit. Loops reading these aren't
+// idle.
+constexpr u16 SIDE_EFFECT_READ_REGISTERS[] = {
+    0xff00 | DSP_ACDRAW, 0xff00 | DSP_ACDSAMP, 0xff00 | DSP_DMBL, 0xff00 | DSP_CMBL};
+
+static bool HasReadSideEffects(u16 mem_addr)
+{
+  return std::ranges::find(SIDE_EFFECT_READ_REGISTERS, mem_addr) !=
+         std::end(SIDE_EFFECT_READ_REGISTERS);
+}
+
+// Returns whether loading a value into the register does more than overwrite it: loads into the
+// stack registers push onto the call or loop stacks, and $CR and $SR change how later
+// instructions behave.
+static bool HasLoadSideEffects(u16 reg)
+{
+  return (reg >= DSP_REG_ST0 && reg <= DSP_REG_ST3) || reg == DSP_REG_CR || reg == DSP_REG_SR;
+}
+
+// Returns whether the instruction may be part of a polling loop: it must only read memory or
+// registers and compute flags, so running it again gives the same result unless something
+// outside of the DSP (or the DSP's own hardware) changed memory in the meantime.
+static bool IsIdleLoopInstruction(const SDSP& dsp, u16 addr, bool* reads_memory)
+{
+  const UDSPInstruction inst = dsp.ReadIMEM(addr);
+  const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+  if (!opcode)
+    return false;
+
+  // Only extended instructions that have a no-op extension are allowed, as most extensions
+  // modify addressing registers or store to memory.
+  if (opcode->extended && (inst & 0x00fc) != 0)
+    return false;
+
+  switch (opcode->opcode)
+  {
+  case 0x00c0:  // LR
+  {
+    if (HasLoadSideEffects(inst & 0x1f))
+      return false;
+
+    const u16 mem_addr = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    *reads_memory = true;
+    return !HasReadSideEffects(mem_addr);
+  }
+  case 0x2000:  // LRS
+  {
+    // LRS addresses memory through $CR, which ucodes keep at 0xff to reach hardware registers.
+    const u16 mem_addr = 0xff00 | (inst & 0x00ff);
+    *reads_memory = true;
+    return !HasReadSideEffects(mem_addr);
+  }
+  case 0x0080:  // LRI
+    return !HasLoadSideEffects(inst & 0x1f);
+  case 0x0800:  // LRIS
+  case 0x0240:  // ANDI
+  case 0x0280:  // CMPI
+  case 0x02a0:  // ANDF
+  case 0x02c0:  // ANDCF
+  case 0x0600:  // CMPIS
+  case 0x8200:  // CMP
+  case 0x8500:  // TSTPROD
+  case 0x8600:  // TSTAXH
+  case 0xb100:  // TST
+  case 0xc100:  // CMPAXH
+    return true;
+  default:
+    return false;
+  }
+}
+
 Analyzer::Analyzer() = default;
 Analyzer::~Analyzer() = default;
 
@@ -83,6 +160,7 @@ void Analyzer::AnalyzeRange(const SDSP& dsp, u16 start_addr, u16 end_addr)
 
   // Next, we'll scan for potential idle skips.
   FindIdleSkips(dsp, start_addr, end_addr);
+  FindIdlePollingLoops(dsp, start_addr, end_addr);
 
   INFO_LOG_FMT(DSPLLE, "Finished analysis.");
 }
@@ -172,4 +250,38 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
     }
   }
 }
+
+void Analyzer::FindIdlePollingLoops(const SDSP& dsp, u16 start_addr, u16 end_addr)
+{
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    if (!IsStartOfInstruction(addr))
+      continue;
+
+    // Look for a conditional or unconditional jump back to the start of the loop. Conditional
+    // jumps out of the loop aren't allowed, so the loop can only be left by falling through.
+    const UDSPInstruction inst = dsp.ReadIMEM(addr);
+    if ((inst & 0xfff0) != 0x0290)
+      continue;
+
+    const u16 loop_start = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    if (loop_start >= addr || addr - loop_start >= MAX_IDLE_LOOP_SIZE)
+      continue;
+
+    bool reads_memory = false;
+    u16 loop_addr = loop_start;
+    while (loop_addr < addr && IsStartOfInstruction(loop_addr) &&
+           IsIdleLoopInstruction(dsp, loop_addr, &reads_memory))
+    {
+      loop_addr += GetOpTemplate(dsp.ReadIMEM(loop_addr))->size;
+    }
+
+    // A loop that doesn't read memory can't be waiting for anything.
+    if (loop_addr != addr || !reads_memory)
+      continue;
+
+    INFO_LOG_FMT(DSPLLE, "Idle polling loop found at {:04x}-{:04x}", loop_start, addr);
+    m_code_flags[loop_start] |= CODE_IDLE_SKIP;
+  }
+}
 }  // namespace DSP
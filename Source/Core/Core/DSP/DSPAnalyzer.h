@@ -110,6 +110,11 @@ private:
   // Finds locations within the range [start_addr, end_addr) that may contain idle skips.
   void FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr);
 
+  // Finds small loops within the range [start_addr, end_addr) that do nothing but poll memory or
+  // hardware registers (mailboxes, DMA and accelerator status) until a value changes, and marks
+  // them as idle skips. Requires FindInstructionStarts to have been run on the range.
+  void FindIdlePollingLoops(const SDSP& dsp, u16 start_addr, u16 end_addr);
+
   // Retrieves the flags set during analysis for code in memory.
   [[nodiscard]] u8 GetCodeFlags(u16 address) const { return m_code_flags[address]; }
 
@@ -19,6 +19,7 @@
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DSP/DSPAnalyzer.h"
 #include "Core/DSP/DSPHost.h"
+#include "Core/DSP/Interpreter/DSPCachedInterpreter.h"
 #include "Core/DSP/Interpreter/DSPInterpreter.h"
 #include "Core/DSP/Jit/DSPEmitterBase.h"
 
@@ -432,6 +433,8 @@ bool DSPCore::Initialize(const DSPInitOptions& opts)
   // Initialize JIT, if necessary
   if (opts.core_type == DSPInitOptions::CoreType::JIT64)
     m_dsp_jit = JIT::CreateDSPEmitter(*this);
+  else if (opts.core_type == DSPInitOptions::CoreType::CachedInterpreter)
+    m_dsp_jit = std::make_unique<Interpreter::CachedInterpreter>(*this);
 
   m_dsp_cap.reset(opts.capture_logger);
 
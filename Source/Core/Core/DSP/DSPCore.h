@@ -297,6 +297,7 @@ struct DSPInitOptions
   enum class CoreType
   {
     Interpreter,
+    CachedInterpreter,
     JIT64,
   };
   CoreType core_type = CoreType::JIT64;
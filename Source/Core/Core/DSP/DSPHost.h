@@ -27,6 +27,7 @@ void OSD_AddMessage(std::string str, u32 ms);
 bool OnThread();
 bool IsWiiHost();
 void InterruptRequest();
+void IdleSkipped(u32 cycles);
 void CodeLoaded(DSPCore& dsp, u32 addr, size_t size);
 void CodeLoaded(DSPCore& dsp, const u8* ptr, size_t size);
 }  // namespace DSP::Host
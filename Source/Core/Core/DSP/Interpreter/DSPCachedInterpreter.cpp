@@ -0,0 +1,188 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Interpreter/DSPCachedInterpreter.h"
+
+#include <atomic>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+namespace DSP::Interpreter
+{
+constexpr size_t MAX_BLOCK_SIZE = 250;
+
+CachedInterpreter::CachedInterpreter(DSPCore& dsp)
+    : m_dsp_core{dsp}, m_interpreter{dsp.GetInterpreter()}
+{
+}
+
+CachedInterpreter::~CachedInterpreter() = default;
+
+bool CachedInterpreter::IsCacheableAddress(u16 address)
+{
+  const u16 region = address >> 12;
+  return region == 0 || region == 8;
+}
+
+size_t CachedInterpreter::GetBlockIndex(u16 address)
+{
+  return ((address & 0x8000) >> 3) | (address & DSP_IRAM_MASK);
+}
+
+u16 CachedInterpreter::RunCycles(u16 cycles)
+{
+  auto& state = m_dsp_core.DSPState();
+
+  if (state.external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+    m_dsp_core.CheckExternalInterrupt();
+
+  int cycles_left = cycles;
+  while (cycles_left > 0)
+  {
+    if (m_iram_invalidated)
+    {
+      for (size_t i = 0; i < DSP_IRAM_SIZE; ++i)
+        m_blocks[i].instructions.clear();
+      m_iram_invalidated = false;
+    }
+
+    if ((state.control_reg & CR_HALT) != 0)
+      return 0;
+
+    if (!IsCacheableAddress(state.pc))
+    {
+      // Executing from unmapped memory. This is never going to be fast, so leave it to the
+      // interpreter.
+      m_interpreter.Step();
+      cycles_left--;
+      continue;
+    }
+
+    const Block& block = GetBlock(state.pc);
+    const bool took_no_exception = RunBlock(block, &cycles_left);
+
+    // Like the JIT, give up the rest of the slice once execution has gone back to the start of an
+    // idle loop. Anywhere else, the loop was left or an exception handler has to run first.
+    if (block.idle_skip && took_no_exception && !Host::OnThread() && cycles_left > 0 &&
+        state.pc == block.instructions.front().address)
+    {
+      Host::IdleSkipped(static_cast<u32>(cycles_left));
+      return 0;
+    }
+  }
+
+  return 0;
+}
+
+bool CachedInterpreter::RunBlock(const Block& block, int* cycles)
+{
+  auto& state = m_dsp_core.DSPState();
+
+  for (const Instruction& instruction : block.instructions)
+  {
+    // A taken exception moves execution to its vector, so the rest of the block no longer applies.
+    if (m_dsp_core.CheckExceptions())
+      return false;
+
+    // This matches Interpreter::Step, with the instruction fetch and opcode lookups done ahead of
+    // time. The operand words of multi-word instructions are still fetched by the instruction.
+    state.AdvanceStepCounter();
+    state.pc = static_cast<u16>(instruction.address + 1);
+
+    if (instruction.ext_op != nullptr)
+    {
+      (m_interpreter.*instruction.ext_op)(instruction.inst);
+      (m_interpreter.*instruction.op)(instruction.inst);
+      m_interpreter.ApplyWriteBackLog();
+    }
+    else
+    {
+      (m_interpreter.*instruction.op)(instruction.inst);
+    }
+
+    --*cycles;
+
+    if (state.pc != instruction.next_address || m_iram_invalidated)
+    {
+      // Branches, skipped instructions, IRAM DMAs and the like leave the block.
+      if (state.GetAnalyzer().IsLoopEnd(static_cast<u16>(state.pc - 1)))
+        m_interpreter.HandleLoop();
+      return true;
+    }
+
+    if (instruction.loop_end)
+    {
+      m_interpreter.HandleLoop();
+      if (state.pc != instruction.next_address)
+        return true;
+    }
+
+    if (*cycles <= 0)
+      return true;
+  }
+  return true;
+}
+
+const CachedInterpreter::Block& CachedInterpreter::GetBlock(u16 address)
+{
+  Block& block = m_blocks[GetBlockIndex(address)];
+  if (block.instructions.empty())
+    CompileBlock(address, &block);
+  return block;
+}
+
+void CachedInterpreter::CompileBlock(u16 start_address, Block* block)
+{
+  const auto& state = m_dsp_core.DSPState();
+  const Analyzer& analyzer = state.GetAnalyzer();
+
+  block->instructions.clear();
+  block->idle_skip = analyzer.IsIdleSkip(start_address);
+
+  u16 address = start_address;
+  while (block->instructions.size() < MAX_BLOCK_SIZE)
+  {
+    const UDSPInstruction inst = state.ReadIMEM(address);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+    const u16 next_address = static_cast<u16>(address + opcode->size);
+
+    block->instructions.push_back({
+        .op = GetOp(inst),
+        .ext_op = opcode->extended ? GetExtOp(inst) : nullptr,
+        .inst = inst,
+        .address = address,
+        .next_address = next_address,
+        .loop_end = analyzer.IsLoopEnd(static_cast<u16>(next_address - 1)),
+    });
+
+    if (opcode->branch || opcode->uncond_branch)
+      break;
+
+    // Don't cross into another memory region, and make sure idle skip locations start a block.
+    if (((next_address ^ start_address) & 0xf000) != 0 || analyzer.IsIdleSkip(next_address))
+      break;
+
+    address = next_address;
+  }
+}
+
+void CachedInterpreter::ClearIRAM()
+{
+  // This can be called by an instruction in the middle of a block (through a DMA to IRAM), so
+  // the blocks are only thrown away once that block has been left.
+  m_iram_invalidated = true;
+}
+
+void CachedInterpreter::DoState(PointerWrap& p)
+{
+  // Keep the same savestate layout as the JIT, which stores the cycles left in its slice.
+  u16 cycles_left = 0;
+  p.Do(cycles_left);
+}
+}  // namespace DSP::Interpreter
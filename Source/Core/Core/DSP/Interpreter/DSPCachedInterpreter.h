@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP
+{
+class DSPCore;
+}
+
+namespace DSP::Interpreter
+{
+class Interpreter;
+
+// Interpreter that predecodes IRAM and IROM into blocks of instructions, so that running code
+// doesn't go through the opcode tables and the analyzer for every instruction. It executes
+// instructions through the regular interpreter functions and behaves exactly like
+// Interpreter::Step, which makes it usable on hosts without a DSP JIT as well as a baseline to
+// compare the JIT against.
+class CachedInterpreter final : public JIT::DSPEmitter
+{
+public:
+  explicit CachedInterpreter(DSPCore& dsp);
+  ~CachedInterpreter() override;
+
+  CachedInterpreter(const CachedInterpreter&) = delete;
+  CachedInterpreter& operator=(const CachedInterpreter&) = delete;
+  CachedInterpreter(CachedInterpreter&&) = delete;
+  CachedInterpreter& operator=(CachedInterpreter&&) = delete;
+
+  u16 RunCycles(u16 cycles) override;
+  void ClearIRAM() override;
+  void DoState(PointerWrap& p) override;
+
+private:
+  struct Instruction
+  {
+    InterpreterFunction op;
+    // nullptr if the instruction doesn't have an extended opcode.
+    InterpreterFunction ext_op;
+    UDSPInstruction inst;
+    // Address of the instruction, and of the next one if execution falls through.
+    u16 address;
+    u16 next_address;
+    // Whether the instruction ends a hardware loop when execution falls through.
+    bool loop_end;
+  };
+
+  struct Block
+  {
+    std::vector<Instruction> instructions;
+    bool idle_skip = false;
+  };
+
+  // Blocks are indexed by start address, for both IRAM (0x0000-0x0fff) and IROM (0x8000-0x8fff).
+  static constexpr size_t NUM_BLOCK_ADDRESSES = 0x2000;
+
+  static bool IsCacheableAddress(u16 address);
+  static size_t GetBlockIndex(u16 address);
+
+  const Block& GetBlock(u16 address);
+  void CompileBlock(u16 start_address, Block* block);
+
+  // Runs instructions of the block until it's exited, or <cycles> reaches 0. Returns false if the
+  // block was left because an exception was taken.
+  bool RunBlock(const Block& block, int* cycles);
+
+  DSPCore& m_dsp_core;
+  Interpreter& m_interpreter;
+
+  std::array<Block, NUM_BLOCK_ADDRESSES> m_blocks;
+  bool m_iram_invalidated = false;
+};
+}  // namespace DSP::Interpreter
@@ -190,6 +190,8 @@ public:
   void nop_ext(UDSPInstruction opc);
 
 private:
+  friend class CachedInterpreter;
+
   void ExecuteInstruction(UDSPInstruction inst);
 
   bool CheckCondition(u8 condition) const;
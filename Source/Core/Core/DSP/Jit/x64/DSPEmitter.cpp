@@ -27,7 +27,6 @@ namespace DSP::JIT::x64
 {
 constexpr size_t COMPILED_CODE_SIZE = 2097152;
 constexpr size_t MAX_BLOCK_SIZE = 250;
-constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
 
 DSPEmitter::DSPEmitter(DSPCore& dsp)
     : m_compile_status_register{SR_INT_ENABLE | SR_EXT_INT_ENABLE}, m_blocks(MAX_BLOCKS),
@@ -57,9 +56,13 @@ u16 DSPEmitter::RunCycles(u16 cycles)
   }
 
   m_cycles_left = cycles;
+  m_idle_skipped_cycles = 0;
   auto exec_addr = (DSPCompiledCode)m_enter_dispatcher;
   exec_addr();
 
+  if (m_idle_skipped_cycles != 0)
+    Host::IdleSkipped(m_idle_skipped_cycles);
+
   if (m_dsp_core.DSPState().reset_dspjit_codespace)
     ClearIRAMandDSPJITCodespaceReset();
 
@@ -241,6 +244,7 @@ void DSPEmitter::Compile(u16 start_addr)
 
   m_compile_pc = start_addr;
   bool fixup_pc = false;
+  bool left_idle_loop = false;
   m_block_size[start_addr] = 0;
 
   auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
@@ -285,15 +289,7 @@ void DSPEmitter::Compile(u16 start_addr)
       DSPJitRegCache c(m_gpr);
       HandleLoop();
       m_gpr.SaveRegs();
-      if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-      {
-        MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-      }
-      else
-      {
-        MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-      }
-      JMP(m_return_dispatcher);
+      WriteBlockExit(true);
       m_gpr.LoadRegs(false);
       m_gpr.FlushRegs(c, false);
 
@@ -321,15 +317,7 @@ void DSPEmitter::Compile(u16 start_addr)
         DSPJitRegCache c(m_gpr);
         // don't update g_dsp.pc -- the branch insn already did
         m_gpr.SaveRegs();
-        if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-        {
-          MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-        }
-        else
-        {
-          MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-        }
-        JMP(m_return_dispatcher);
+        WriteBlockExit(true);
         m_gpr.LoadRegs(false);
         m_gpr.FlushRegs(c, false);
 
@@ -342,6 +330,15 @@ void DSPEmitter::Compile(u16 start_addr)
     {
       break;
     }
+
+    // End the block after the jump back to the start of an idle polling loop. Falling through
+    // means that the loop has been left, so the rest of the slice must not be given up then.
+    if ((inst & 0xfff0) == 0x0290 && analyzer.IsIdleSkip(start_addr) &&
+        m_dsp_core.DSPState().ReadIMEM(static_cast<u16>(m_compile_pc - 1)) == start_addr)
+    {
+      left_idle_loop = true;
+      break;
+    }
   }
 
   if (fixup_pc)
@@ -384,15 +381,18 @@ void DSPEmitter::Compile(u16 start_addr)
   }
 
   m_gpr.SaveRegs();
-  if (!Host::OnThread() && analyzer.IsIdleSkip(start_addr))
-  {
-    MOV(16, R(EAX), Imm16(DSP_IDLE_SKIP_CYCLES));
-  }
-  else
-  {
-    MOV(16, R(EAX), Imm16(m_block_size[start_addr]));
-  }
-  JMP(m_return_dispatcher);
+  WriteBlockExit(!left_idle_loop);
+}
+
+void DSPEmitter::WriteBlockExit(bool allow_idle_skip)
+{
+  // At idle skip locations, the DSP is waiting for something that can't happen before the CPU or
+  // the rest of the hardware gets to run again, so the rest of the slice is given up.
+  const bool idle_skip = allow_idle_skip && !Host::OnThread() &&
+                         m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address);
+
+  MOV(16, R(EAX), Imm16(m_block_size[m_start_address]));
+  JMP(idle_skip ? m_idle_skip_dispatcher : m_return_dispatcher);
 }
 
 void DSPEmitter::CompileCurrent(DSPEmitter& emitter)
@@ -461,8 +461,21 @@ void DSPEmitter::CompileDispatcher()
   SUB(16, MatR(RCX), R(EAX));
 
   J_CC(CC_A, dispatcherLoop);
+  FixupBranch slice_done = J();
+
+  // Idle skip: account for the cycles of the block, then skip the rest of the slice.
+  m_idle_skip_dispatcher = GetCodePtr();
+  MOV(64, R(RCX), ImmPtr(&m_cycles_left));
+  SUB(16, MatR(RCX), R(EAX));
+  FixupBranch no_cycles_left = J_CC(CC_BE);
+  MOVZX(32, 16, EAX, MatR(RCX));
+  MOV(16, MatR(RCX), Imm16(0));
+  MOV(64, R(RCX), ImmPtr(&m_idle_skipped_cycles));
+  ADD(32, MatR(RCX), R(EAX));
+  SetJumpTarget(no_cycles_left);
 
   // DSP gave up the remaining cycles.
+  SetJumpTarget(slice_done);
   SetJumpTarget(_halt);
   if (Host::OnThread())
   {
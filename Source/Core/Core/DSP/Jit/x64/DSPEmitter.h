@@ -212,6 +212,7 @@ private:
   void FallBackToInterpreter(UDSPInstruction inst);
 
   void WriteBranchExit();
+  void WriteBlockExit(bool allow_idle_skip);
   void WriteBlockLink(u16 dest);
 
   void ReJitConditional(UDSPInstruction opc, void (DSPEmitter::*conditional_fn)(UDSPInstruction));
@@ -324,6 +325,8 @@ private:
   std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
 
   u16 m_cycles_left = 0;
+  // DSP cycles skipped by idle skipping during the current RunCycles call.
+  u32 m_idle_skipped_cycles = 0;
 
   // The index of the last stored ext value (compile time).
   int m_store_index = -1;
@@ -332,6 +335,7 @@ private:
   // CALL this to start the dispatcher
   const u8* m_enter_dispatcher;
   const u8* m_return_dispatcher;
+  const u8* m_idle_skip_dispatcher;
   const u8* m_stub_entry_point;
 
   DSPCore& m_dsp_core;
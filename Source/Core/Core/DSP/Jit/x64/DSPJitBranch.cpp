@@ -101,15 +101,7 @@ void DSPEmitter::WriteBranchExit()
 {
   DSPJitRegCache c(m_gpr);
   m_gpr.SaveRegs();
-  if (m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
-  {
-    MOV(16, R(EAX), Imm16(0x1000));
-  }
-  else
-  {
-    MOV(16, R(EAX), Imm16(m_block_size[m_start_address]));
-  }
-  JMP(m_return_dispatcher);
+  WriteBlockExit(true);
   m_gpr.LoadRegs(false);
   m_gpr.FlushRegs(c, false);
 }
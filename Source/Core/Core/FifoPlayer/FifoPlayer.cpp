@@ -225,6 +225,7 @@ public:
     m_parent->m_system.GetCPU().SetStepping(false);
 
     m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
+    m_parent->m_LoopCount = 0;
     m_parent->LoadMemory();
   }
 
@@ -272,7 +273,8 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
-    if (!m_Loop)
+    ++m_LoopCount;
+    if (m_LoopLimit != 0 ? m_LoopCount >= m_LoopLimit : !m_Loop)
       return CPU::State::PowerDown;
 
     // When looping, reload the contents of all the BP/CP/CF registers.
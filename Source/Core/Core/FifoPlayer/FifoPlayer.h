@@ -133,6 +133,10 @@ public:
   u32 GetObjectRangeEnd() const { return m_ObjectRangeEnd; }
   void SetObjectRangeEnd(u32 end) { m_ObjectRangeEnd = end; }
 
+  // If non-zero, playback stops once the frame range has been played back this many times,
+  // regardless of the loop setting.
+  void SetLoopLimit(u32 limit) { m_LoopLimit = limit; }
+
   // Callbacks
   void SetFileLoadedCallback(CallbackFunc callback);
   void SetFrameWrittenCallback(CallbackFunc callback) { m_FrameWrittenCb = std::move(callback); }
@@ -194,6 +198,9 @@ private:
   u32 m_ObjectRangeStart = 0;
   u32 m_ObjectRangeEnd = 10000;
 
+  u32 m_LoopLimit = 0;
+  u32 m_LoopCount = 0;
+
   u64 m_CyclesPerFrame = 0;
   u32 m_ElapsedCycles = 0;
   u32 m_FrameFifoSize = 0;
@@ -5,7 +5,9 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Metrics.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -14,6 +16,9 @@
 
 namespace DSP::HLE
 {
+static Common::Metrics::Counter s_time{"dsp_hle_time_ns_total",
+                                      "Time spent emulating the DSP with HLE, in nanoseconds"};
+
 DSPHLE::DSPHLE(Core::System& system) : m_mail_handler(system.GetDSP()), m_system(system)
 {
 }
@@ -22,6 +27,8 @@ DSPHLE::~DSPHLE() = default;
 
 bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 {
+  StopThread();
+
   m_wii = wii;
   m_ucode = nullptr;
   m_last_ucode = nullptr;
@@ -35,6 +42,13 @@ bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 
   m_dsp_state.Reset();
 
+  // uCode work running asynchronously only writes to RAM at synchronization points, which are
+  // deterministic. They are later than when the work runs inline though, so the setting would have
+  // to match between all the peers of a netplay session or a movie and its playback.
+  m_is_on_thread = Config::Get(Config::MAIN_DSP_HLE_THREAD) && !Core::WantsDeterminism();
+  if (m_is_on_thread)
+    m_work_thread.Reset("DSP HLE");
+
   return true;
 }
 
@@ -44,13 +58,60 @@ void DSPHLE::DSP_StopSoundStream()
 
 void DSPHLE::Shutdown()
 {
+  StopThread();
   m_ucode = nullptr;
 }
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  SyncWithThread();
+
+  if (m_is_on_thread && Core::WantsDeterminism())
+    StopThread();
+
   if (m_ucode != nullptr)
+  {
+    Common::Metrics::ScopedTimer timer(s_time);
     m_ucode->Update();
+  }
+}
+
+void DSPHLE::RunUCodeWork(std::function<void()> work, std::function<void()> on_sync)
+{
+  if (!m_is_on_thread || !on_sync)
+  {
+    Common::Metrics::ScopedTimer timer(s_time);
+    work();
+    return;
+  }
+
+  m_on_sync = std::move(on_sync);
+  m_mail_handler.SetDeferring(true);
+  m_work_thread.Push([work = std::move(work)] {
+    Common::Metrics::ScopedTimer timer(s_time);
+    work();
+  });
+}
+
+void DSPHLE::SyncWithThread()
+{
+  if (!m_is_on_thread)
+    return;
+
+  m_work_thread.WaitForCompletion();
+  if (m_on_sync)
+  {
+    m_on_sync();
+    m_on_sync = nullptr;
+  }
+  m_mail_handler.FlushDeferred();
+}
+
+void DSPHLE::StopThread()
+{
+  SyncWithThread();
+  m_work_thread.Shutdown();
+  m_is_on_thread = false;
 }
 
 u32 DSPHLE::DSP_UpdateRate()
@@ -62,6 +123,8 @@ u32 DSPHLE::DSP_UpdateRate()
 
 void DSPHLE::SendMailToDSP(u32 mail)
 {
+  SyncWithThread();
+
   if (m_ucode != nullptr)
   {
     DEBUG_LOG_FMT(DSP_MAIL, "CPU writes {:#010x}", mail);
@@ -98,6 +161,8 @@ void DSPHLE::SwapUCode(u32 crc)
 
 void DSPHLE::DoState(PointerWrap& p)
 {
+  SyncWithThread();
+
   bool is_hle = true;
   p.Do(is_hle);
   if (!is_hle && p.IsReadMode())
@@ -148,6 +213,7 @@ u16 DSPHLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
   }
   else
   {
+    SyncWithThread();
     return AccessMailHandler().ReadDSPMailboxHigh();
   }
 }
@@ -160,6 +226,7 @@ u16 DSPHLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
   }
   else
   {
+    SyncWithThread();
     return AccessMailHandler().ReadDSPMailboxLow();
   }
 }
@@ -194,6 +261,8 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 // Other DSP functions
 u16 DSPHLE::DSP_WriteControlRegister(u16 value)
 {
+  SyncWithThread();
+
   DSP::UDSPControl temp(value);
 
   if (m_dsp_control.DSPHalt != temp.DSPHalt)
@@ -244,6 +313,10 @@ u16 DSPHLE::DSP_ReadControlRegister()
 
 void DSPHLE::PauseAndLock()
 {
+  // Only wait for the work to complete. Its mail is still delivered at the next synchronization
+  // point, so that pausing doesn't affect emulation.
+  if (m_is_on_thread)
+    m_work_thread.WaitForCompletion();
 }
 
 void DSPHLE::UnpauseAndUnlock()
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/DSPEmulator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -51,11 +53,24 @@ public:
   void SetUCode(u32 crc);
   void SwapUCode(u32 crc);
 
+  // Runs uCode work that doesn't need to interact with the CPU until it is done, such as mixing an
+  // AX frame. With the DSP HLE thread enabled, the work is queued on that thread, and any mail it
+  // sends is held back until the next synchronization point (the next DSP update, or the next
+  // time the CPU accesses the DSP), where on_sync is called on the CPU thread first. The work must
+  // not access emulated memory, so on_sync is where its results are written to RAM. If there is no
+  // on_sync, or the thread is disabled, the work runs immediately.
+  void RunUCodeWork(std::function<void()> work, std::function<void()> on_sync = {});
+  bool IsOnThread() const { return m_is_on_thread; }
+
   Core::System& GetSystem() const { return m_system; }
 
 private:
   void SendMailToDSP(u32 mail);
 
+  // Waits for outstanding work on the DSP HLE thread and delivers the mail it produced.
+  void SyncWithThread();
+  void StopThread();
+
   // Fake mailbox utility
   struct DSPState
   {
@@ -79,6 +94,10 @@ private:
   u64 m_control_reg_init_code_clear_time = 0;
   CMailHandler m_mail_handler;
 
+  Common::AsyncWorkThreadSP m_work_thread;
+  std::function<void()> m_on_sync;
+  bool m_is_on_thread = false;
+
   Core::System& m_system;
 };
 }  // namespace DSP::HLE
@@ -20,6 +20,12 @@ CMailHandler::~CMailHandler()
 
 void CMailHandler::PushMail(u32 mail, bool interrupt, int cycles_into_future)
 {
+  if (m_deferring)
+  {
+    m_deferred_mails.push_back({mail, interrupt, cycles_into_future});
+    return;
+  }
+
   if (interrupt)
   {
     if (m_pending_mails.empty())
@@ -68,6 +74,14 @@ u16 CMailHandler::ReadDSPMailboxLow()
   return u16(m_last_mail & 0xffff);
 }
 
+void CMailHandler::FlushDeferred()
+{
+  m_deferring = false;
+  for (const DeferredMail& deferred : m_deferred_mails)
+    PushMail(deferred.mail, deferred.interrupt, deferred.cycles_into_future);
+  m_deferred_mails.clear();
+}
+
 void CMailHandler::ClearPending()
 {
   m_pending_mails.clear();
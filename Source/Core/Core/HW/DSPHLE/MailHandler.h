@@ -5,6 +5,7 @@
 
 #include <deque>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -42,7 +43,20 @@ public:
   u16 ReadDSPMailboxHigh();
   u16 ReadDSPMailboxLow();
 
+  // While deferring, pushed mails are held back instead of being made visible to the CPU. This is
+  // used when uCode work runs on the DSP HLE thread: the mails are released by FlushDeferred, which
+  // must be called on the CPU thread once that work has completed.
+  void SetDeferring(bool deferring) { m_deferring = deferring; }
+  void FlushDeferred();
+
 private:
+  struct DeferredMail
+  {
+    u32 mail;
+    bool interrupt;
+    int cycles_into_future;
+  };
+
   // The actual DSP only has a single pair of mail registers, and doesn't keep track of pending
   // mails. But for HLE, it's a lot easier to write all the mails that will be read ahead of time,
   // and then give them to the CPU in the requested order.
@@ -53,6 +67,9 @@ private:
   // When halted, the DSP itself is not running, but the last mail can be read.
   bool m_halted = false;
 
+  std::vector<DeferredMail> m_deferred_mails;
+  bool m_deferring = false;
+
   DSP::DSPManager& m_dsp;
 };
 }  // namespace DSP::HLE
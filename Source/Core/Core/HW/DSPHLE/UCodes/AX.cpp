@@ -3,9 +3,12 @@
 
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -27,7 +30,9 @@
 
 namespace DSP::HLE
 {
-AXUCode::AXUCode(DSPHLE* dsphle, u32 crc, bool dummy) : UCodeInterface(dsphle, crc)
+AXUCode::AXUCode(DSPHLE* dsphle, u32 crc, bool dummy)
+    : UCodeInterface(dsphle, crc),
+      m_memory(dsphle->GetSystem().GetMemory(), dsphle->GetSystem().GetDSP())
 {
 }
 
@@ -35,7 +40,7 @@ AXUCode::AXUCode(DSPHLE* dsphle, u32 crc) : AXUCode(dsphle, crc, false)
 {
   INFO_LOG_FMT(DSPHLE, "Instantiating AXUCode: crc={:08x}", crc);
 
-  m_accelerator = std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP());
+  m_accelerator = std::make_unique<HLEAccelerator>(m_memory);
 }
 
 AXUCode::~AXUCode() = default;
@@ -285,6 +290,194 @@ void AXUCode::HandleCommandList()
   }
 }
 
+bool AXUCode::SnapshotCommandList()
+{
+  m_memory.StartRecording();
+  if (!RecordCommandList())
+  {
+    m_memory.Reset();
+    return false;
+  }
+
+  m_memory.StartReplaying();
+  return true;
+}
+
+bool AXUCode::RecordCommandList()
+{
+  // Walk the command list like HandleCommandList does, recording what each command reads.
+  std::array<u16, std::extent_v<decltype(m_cmdlist)>> cmdlist;
+  std::copy(std::begin(m_cmdlist), std::end(m_cmdlist), cmdlist.begin());
+
+  bool out_of_bounds = false;
+  u32 curr_idx = 0;
+  const auto next = [&] {
+    if (curr_idx >= cmdlist.size())
+    {
+      out_of_bounds = true;
+      return u16(0);
+    }
+    return cmdlist[curr_idx++];
+  };
+  const auto next_addr = [&] {
+    const u16 hi = next();
+    const u16 lo = next();
+    return (u32(hi) << 16) | lo;
+  };
+
+  constexpr u32 buffer_size = 5 * 32 * sizeof(int);
+
+  // Which compressor ramp gets read depends on the mixed samples, so keep track of every value
+  // m_compressor_pos can take.
+  std::vector<u16> compressor_positions{m_compressor_pos};
+
+  std::vector<u32> processed_pbs;
+  std::vector<u32> copied_cmdlists;
+  u32 pb_addr = 0;
+
+  bool end = false;
+  while (!end && !out_of_bounds)
+  {
+    const u16 cmd = next();
+
+    switch (cmd)
+    {
+    case CMD_SETUP:
+      m_memory.RecordRange(next_addr(), 3 * 9 * sizeof(u16));
+      break;
+
+    case CMD_DL_AND_VOL_MIX:
+      m_memory.RecordRange(next_addr(), 3 * buffer_size);
+      curr_idx += 3;
+      break;
+
+    case CMD_PB_ADDR:
+      pb_addr = next_addr();
+      break;
+
+    case CMD_PROCESS:
+      if (!RecordPBList(pb_addr, &processed_pbs))
+        return false;
+      break;
+
+    case CMD_MIX_AUXA:
+    case CMD_MIX_AUXB:
+      next_addr();
+      m_memory.RecordRange(next_addr(), 3 * buffer_size);
+      break;
+
+    case CMD_UPLOAD_LRS:
+      next_addr();
+      break;
+
+    case CMD_SET_LR:
+    case CMD_SET_OPPOSITE_LR:
+      m_memory.RecordRange(next_addr(), buffer_size);
+      break;
+
+    case CMD_UNK_08:
+      curr_idx += 10;
+      break;
+
+    case CMD_MIX_AUXB_NOWRITE:
+      m_memory.RecordRange(next_addr(), 3 * buffer_size);
+      break;
+
+    case CMD_UNK_0A:
+    case CMD_UNK_0B:
+    case CMD_UNK_0C:
+      break;
+
+    case CMD_MORE:
+    {
+      const u32 addr = next_addr();
+      const u16 size = next();
+      // Command lists that are too large or loop forever aren't handled on the DSP HLE thread.
+      if (size >= cmdlist.size() ||
+          std::find(copied_cmdlists.begin(), copied_cmdlists.end(), addr) != copied_cmdlists.end())
+      {
+        return false;
+      }
+      copied_cmdlists.push_back(addr);
+      m_memory.CopyFromEmuSwapped(cmdlist.data(), addr, size * sizeof(u16));
+      curr_idx = 0;
+      break;
+    }
+
+    case CMD_OUTPUT:
+      curr_idx += 4;
+      break;
+
+    case CMD_END:
+      end = true;
+      break;
+
+    case CMD_MIX_AUXB_LR:
+      next_addr();
+      m_memory.RecordRange(next_addr(), 2 * buffer_size);
+      break;
+
+    case CMD_COMPRESSOR:
+    {
+      next();
+      const u16 frames = next();
+      if (!RecordCompressorTable(next_addr(), frames, 5, &compressor_positions))
+        return false;
+      break;
+    }
+
+    case CMD_SEND_AUX_AND_MIX:
+      next_addr();
+      next_addr();
+      for (int i = 0; i < 4; ++i)
+        m_memory.RecordRange(next_addr(), buffer_size);
+      break;
+
+    default:
+      end = true;
+      break;
+    }
+  }
+
+  return !out_of_bounds;
+}
+
+bool AXUCode::RecordCompressorTable(u32 table_addr, u16 release_frames, u32 millis,
+                                    std::vector<u16>* positions)
+{
+  // Many different positions would mean recording much of the table, which never happens in
+  // practice. Leave these command lists to the CPU thread.
+  constexpr size_t MAX_POSITIONS = 16;
+
+  const u32 frame_byte_size = 32 * millis * sizeof(s16);
+  std::vector<u16> next_positions{release_frames};
+  for (const u16 position : *positions)
+  {
+    // Attack ramp
+    m_memory.RecordRange(table_addr + position * frame_byte_size, frame_byte_size);
+
+    if (position != 0)
+    {
+      // Release ramp
+      const u16 next_position = position - 1;
+      m_memory.RecordRange(
+          table_addr + (COMPRESSOR_ATTACK_ENTRY_COUNT + next_position) * frame_byte_size,
+          frame_byte_size);
+      next_positions.push_back(next_position);
+    }
+    else
+    {
+      next_positions.push_back(0);
+    }
+  }
+
+  std::sort(next_positions.begin(), next_positions.end());
+  next_positions.erase(std::unique(next_positions.begin(), next_positions.end()),
+                       next_positions.end());
+  *positions = std::move(next_positions);
+  return positions->size() <= MAX_POSITIONS;
+}
+
 AXMixControl AXUCode::ConvertMixerControl(u32 mixer_control)
 {
   u32 ret = 0;
@@ -387,10 +580,10 @@ void AXUCode::DownloadAndMixWithVolume(u32 addr, u16 vol_main, u16 vol_auxa, u16
   int** buffers[3] = {buffers_main, buffers_auxa, buffers_auxb};
   u16 volumes[3] = {vol_main, vol_auxa, vol_auxb};
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
   for (u32 i = 0; i < 3; ++i)
   {
-    int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(addr, 3 * 5 * 32 * sizeof(int)));
+    const int* ptr =
+        reinterpret_cast<const int*>(m_memory.GetPointerForRange(addr, 3 * 5 * 32 * sizeof(int)));
     u16 volume = volumes[i];
     for (u32 j = 0; j < 3; ++j)
     {
@@ -412,12 +605,12 @@ static bool HasLpf(u32 crc)
 }
 
 // Read a PB from MRAM/ARAM
-void AXUCode::ReadPB(Memory::MemoryManager& memory, u32 addr, AXPB& pb)
+void AXUCode::ReadPB(u32 addr, AXPB& pb)
 {
   if (HasLpf(m_crc))
   {
     u16* dst = (u16*)&pb;
-    memory.CopyFromEmuSwapped<u16>(dst, addr, sizeof(pb));
+    m_memory.CopyFromEmuSwapped<u16>(dst, addr, sizeof(pb));
   }
   else
   {
@@ -428,19 +621,19 @@ void AXUCode::ReadPB(Memory::MemoryManager& memory, u32 addr, AXPB& pb)
     constexpr size_t lpf_off = offsetof(AXPB, lpf);
     constexpr size_t lc_off = offsetof(AXPB, loop_counter);
 
-    memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, lpf_off);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, lpf_off);
     memset(dst + lpf_off, 0, lc_off - lpf_off);
-    memory.CopyFromEmuSwapped<u16>((u16*)(dst + lc_off), addr + lpf_off, sizeof(pb) - lc_off);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)(dst + lc_off), addr + lpf_off, sizeof(pb) - lc_off);
   }
 }
 
 // Write a PB back to MRAM/ARAM
-void AXUCode::WritePB(Memory::MemoryManager& memory, u32 addr, const AXPB& pb)
+void AXUCode::WritePB(u32 addr, const AXPB& pb)
 {
   if (HasLpf(m_crc))
   {
     const u16* src = (const u16*)&pb;
-    memory.CopyToEmuSwapped<u16>(addr, src, sizeof(pb));
+    m_memory.CopyToEmuSwapped<u16>(addr, src, sizeof(pb));
   }
   else
   {
@@ -450,8 +643,9 @@ void AXUCode::WritePB(Memory::MemoryManager& memory, u32 addr, const AXPB& pb)
     constexpr size_t lpf_off = offsetof(AXPB, lpf);
     constexpr size_t lc_off = offsetof(AXPB, loop_counter);
 
-    memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, lpf_off);
-    memory.CopyToEmuSwapped<u16>(addr + lpf_off, (const u16*)(src + lc_off), sizeof(pb) - lc_off);
+    m_memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, lpf_off);
+    m_memory.CopyToEmuSwapped<u16>(addr + lpf_off, (const u16*)(src + lc_off),
+                                   sizeof(pb) - lc_off);
   }
 }
 
@@ -463,16 +657,15 @@ void AXUCode::ProcessPBList(u32 pb_addr)
 
   AXPB pb;
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
   {
     AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
                           m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
                           m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
 
-    ReadPB(memory, pb_addr, pb);
+    ReadPB(pb_addr, pb);
 
-    PBUpdateData updates = LoadPBUpdates(memory, pb);
+    PBUpdateData updates = LoadPBUpdates(m_memory, pb);
 
     for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
     {
@@ -487,9 +680,42 @@ void AXUCode::ProcessPBList(u32 pb_addr)
         ptr += spms;
     }
 
-    WritePB(memory, pb_addr, pb);
+    WritePB(pb_addr, pb);
+    pb_addr = HILO_TO_32(pb.next_pb);
+  }
+}
+
+bool AXUCode::RecordPBList(u32 pb_addr, std::vector<u32>* processed_pbs)
+{
+  constexpr u32 spms = 32;
+
+  // Voices are simulated with a separate accelerator, so that the real one is left as it is for
+  // HandleCommandList.
+  HLEAccelerator accelerator(m_memory);
+  AXPB pb;
+
+  while (pb_addr)
+  {
+    // A PB that is processed twice would be read again after it has been written, which the
+    // simulation below doesn't handle. This never happens in practice.
+    if (std::find(processed_pbs->begin(), processed_pbs->end(), pb_addr) != processed_pbs->end())
+      return false;
+    processed_pbs->push_back(pb_addr);
+
+    ReadPB(pb_addr, pb);
+
+    PBUpdateData updates = LoadPBUpdates(m_memory, pb);
+
+    for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+    {
+      ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
+      SkipInputSamples(&accelerator, pb, spms);
+    }
+
     pb_addr = HILO_TO_32(pb.next_pb);
   }
+
+  return true;
 }
 
 void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
@@ -512,19 +738,18 @@ void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
   }
 
   // First, we need to send the contents of our AUX buffers to the CPU.
-  auto& memory = m_dsphle->GetSystem().GetMemory();
   if (write_addr)
   {
     for (auto& buffer : buffers)
     {
-      memory.CopyToEmuSwapped(write_addr, buffer, 5 * 32 * sizeof(int));
+      m_memory.CopyToEmuSwapped(write_addr, buffer, 5 * 32 * sizeof(int));
       write_addr += 5 * 32 * sizeof(int);
     }
   }
 
   // Then, we read the new temp from the CPU and add to our current
   // temp.
-  int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(
+  const int* ptr = reinterpret_cast<const int*>(m_memory.GetPointerForRange(
       read_addr, sizeof(m_samples_main_left) + sizeof(m_samples_main_right) +
                      sizeof(m_samples_main_surround)));
 
@@ -538,19 +763,17 @@ void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
 
 void AXUCode::UploadLRS(u32 dst_addr)
 {
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-
   for (const auto& samples : {m_samples_main_left, m_samples_main_right, m_samples_main_surround})
   {
-    memory.CopyToEmuSwapped(dst_addr, samples, 5 * 32 * sizeof(int));
+    m_memory.CopyToEmuSwapped(dst_addr, samples, 5 * 32 * sizeof(int));
     dst_addr += 5 * 32 * sizeof(int);
   }
 }
 
 void AXUCode::SetMainLR(u32 src_addr)
 {
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(src_addr, 5 * 32 * sizeof(int)));
+  const int* ptr =
+      reinterpret_cast<const int*>(m_memory.GetPointerForRange(src_addr, 5 * 32 * sizeof(int)));
   for (u32 i = 0; i < 5 * 32; ++i)
   {
     int samp = (int)Common::swap32(*ptr++);
@@ -588,8 +811,7 @@ void AXUCode::RunCompressor(u16 threshold, u16 release_frames, u32 table_addr, u
     // release
     --m_compressor_pos;
     // the release ramps are located after the attack ramps
-    constexpr u32 ATTACK_ENTRY_COUNT = 11;
-    table_offset = (ATTACK_ENTRY_COUNT + m_compressor_pos) * frame_byte_size;
+    table_offset = (COMPRESSOR_ATTACK_ENTRY_COUNT + m_compressor_pos) * frame_byte_size;
   }
   else
   {
@@ -597,9 +819,8 @@ void AXUCode::RunCompressor(u16 threshold, u16 release_frames, u32 table_addr, u
   }
 
   // apply the selected ramp
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  u16* ramp = reinterpret_cast<u16*>(
-      memory.GetPointerForRange(table_addr + table_offset, 32 * millis * sizeof(u16)));
+  const u16* ramp = reinterpret_cast<const u16*>(
+      m_memory.GetPointerForRange(table_addr + table_offset, 32 * millis * sizeof(u16)));
   for (u32 i = 0; i < 32 * millis; ++i)
   {
     u16 coef = Common::swap16(*ramp++);
@@ -610,8 +831,7 @@ void AXUCode::RunCompressor(u16 threshold, u16 release_frames, u32 table_addr, u
 
 void AXUCode::OutputSamples(u32 lr_addr, u32 surround_addr)
 {
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  memory.CopyToEmuSwapped(surround_addr, m_samples_main_surround, 5 * 32 * sizeof(int));
+  m_memory.CopyToEmuSwapped(surround_addr, m_samples_main_surround, 5 * 32 * sizeof(int));
 
   // 32 samples per ms, 5 ms, 2 channels
   short buffer[5 * 32 * 2];
@@ -626,19 +846,19 @@ void AXUCode::OutputSamples(u32 lr_addr, u32 surround_addr)
     buffer[2 * i + 1] = Common::swap16(left);
   }
 
-  memory.CopyToEmu(lr_addr, buffer, sizeof(buffer));
+  m_memory.CopyToEmu(lr_addr, buffer, sizeof(buffer));
 }
 
 void AXUCode::MixAUXBLR(u32 ul_addr, u32 dl_addr)
 {
   // Upload AUXB L/R
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  memory.CopyToEmuSwapped(ul_addr, m_samples_auxB_left, sizeof(m_samples_auxB_left));
-  memory.CopyToEmuSwapped(ul_addr + sizeof(m_samples_auxB_left), m_samples_auxB_right,
-                          sizeof(m_samples_auxB_right));
+  m_memory.CopyToEmuSwapped(ul_addr, m_samples_auxB_left, sizeof(m_samples_auxB_left));
+  m_memory.CopyToEmuSwapped(ul_addr + sizeof(m_samples_auxB_left), m_samples_auxB_right,
+                            sizeof(m_samples_auxB_right));
 
   // Mix AUXB L/R to MAIN L/R, and replace AUXB L/R
-  int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(dl_addr, 2 * 5 * 32 * sizeof(int)));
+  const int* ptr =
+      reinterpret_cast<const int*>(m_memory.GetPointerForRange(dl_addr, 2 * 5 * 32 * sizeof(int)));
   for (u32 i = 0; i < 5 * 32; ++i)
   {
     int samp = Common::swap32(*ptr++);
@@ -655,8 +875,8 @@ void AXUCode::MixAUXBLR(u32 ul_addr, u32 dl_addr)
 
 void AXUCode::SetOppositeLR(u32 src_addr)
 {
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(src_addr, 5 * 32 * sizeof(int)));
+  const int* ptr =
+      reinterpret_cast<const int*>(m_memory.GetPointerForRange(src_addr, 5 * 32 * sizeof(int)));
   for (u32 i = 0; i < 5 * 32; ++i)
   {
     int inp = Common::swap32(*ptr++);
@@ -670,15 +890,14 @@ void AXUCode::SendAUXAndMix(u32 auxa_lrs_up, u32 auxb_s_up, u32 main_l_dl, u32 m
                             u32 auxb_l_dl, u32 auxb_r_dl)
 {
   // Upload AUXA LRS
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  memory.CopyToEmuSwapped(auxa_lrs_up, m_samples_auxA_left, 32 * 5 * sizeof(int));
-  memory.CopyToEmuSwapped(auxa_lrs_up + 32 * 5 * sizeof(int), m_samples_auxA_right,
-                          32 * 5 * sizeof(int));
-  memory.CopyToEmuSwapped(auxa_lrs_up + 2 * 32 * 5 * sizeof(int), m_samples_auxA_surround,
-                          32 * 5 * sizeof(int));
+  m_memory.CopyToEmuSwapped(auxa_lrs_up, m_samples_auxA_left, 32 * 5 * sizeof(int));
+  m_memory.CopyToEmuSwapped(auxa_lrs_up + 32 * 5 * sizeof(int), m_samples_auxA_right,
+                            32 * 5 * sizeof(int));
+  m_memory.CopyToEmuSwapped(auxa_lrs_up + 2 * 32 * 5 * sizeof(int), m_samples_auxA_surround,
+                            32 * 5 * sizeof(int));
 
   // Upload AUXB S
-  memory.CopyToEmuSwapped(auxb_s_up, m_samples_auxB_surround, sizeof(m_samples_auxB_surround));
+  m_memory.CopyToEmuSwapped(auxb_s_up, m_samples_auxB_surround, sizeof(m_samples_auxB_surround));
 
   // Download buffers and addresses
   const std::array<int*, 4> dl_buffers{
@@ -697,8 +916,8 @@ void AXUCode::SendAUXAndMix(u32 auxa_lrs_up, u32 auxb_s_up, u32 main_l_dl, u32 m
   // Download and mix
   for (size_t i = 0; i < dl_buffers.size(); ++i)
   {
-    const int* dl_src =
-        reinterpret_cast<int*>(memory.GetPointerForRange(dl_addrs[i], 32 * 5 * sizeof(int)));
+    const int* dl_src = reinterpret_cast<const int*>(
+        m_memory.GetPointerForRange(dl_addrs[i], 32 * 5 * sizeof(int)));
     for (size_t j = 0; j < 32 * 5; ++j)
       dl_buffers[i][j] += (int)Common::swap32(*dl_src++);
   }
@@ -730,10 +949,22 @@ void AXUCode::HandleMail(u32 mail)
 
   case MailState::WaitingForCmdListAddress:
     CopyCmdList(mail, m_cmdlist_size);
-    HandleCommandList();
     m_cmdlist_size = 0;
-    SignalWorkEnd();
     m_mail_state = MailState::WaitingForNextTask;
+    {
+      // On the DSP HLE thread, the command list only reads what was recorded here, and its writes
+      // are applied to RAM at the next synchronization point.
+      std::function<void()> on_sync;
+      if (m_dsphle->IsOnThread() && SnapshotCommandList())
+        on_sync = [this] { m_memory.ApplyWrites(); };
+
+      m_dsphle->RunUCodeWork(
+          [this] {
+            HandleCommandList();
+            SignalWorkEnd();
+          },
+          std::move(on_sync));
+    }
     break;
 
   case MailState::WaitingForNextTask:
@@ -786,8 +1017,7 @@ void AXUCode::CopyCmdList(u32 addr, u16 size)
     return;
   }
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  memory.CopyFromEmuSwapped(m_cmdlist, addr, size * sizeof(u16));
+  m_memory.CopyFromEmuSwapped(m_cmdlist, addr, size * sizeof(u16));
 }
 
 void AXUCode::Update()
@@ -14,11 +14,13 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
+#include "Core/HW/DSPHLE/UCodes/AXMemory.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -109,6 +111,12 @@ protected:
 
   u16 m_compressor_pos = 0;
 
+  // Number of attack ramps in a compressor table. The release ramps are located after them.
+  static constexpr u32 COMPRESSOR_ATTACK_ENTRY_COUNT = 11;
+
+  // All emulated memory accesses made while handling a command list go through this.
+  AXMemory m_memory;
+
   std::unique_ptr<Accelerator> m_accelerator;
 
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
@@ -129,6 +137,16 @@ protected:
   virtual void HandleCommandList();
   void SignalWorkEnd();
 
+  // Records everything the command list in m_cmdlist reads, so that HandleCommandList can run
+  // without accessing emulated memory. Returns false if it couldn't be recorded, in which case the
+  // command list has to be handled on the CPU thread.
+  bool SnapshotCommandList();
+  virtual bool RecordCommandList();
+  // Records the compressor ramps that may be read for each of the possible <positions>, and
+  // replaces them with the positions the compressor may be at afterwards.
+  bool RecordCompressorTable(u32 table_addr, u16 release_frames, u32 millis,
+                             std::vector<u16>* positions);
+
   struct BufferDesc
   {
     int* ptr;
@@ -138,10 +156,8 @@ protected:
   template <int Millis, size_t BufCount>
   void InitMixingBuffers(u32 init_addr, const std::array<BufferDesc, BufCount>& buffers)
   {
-    auto& system = m_dsphle->GetSystem();
-    auto& memory = system.GetMemory();
     std::array<u16, 3 * BufCount> init_array;
-    memory.CopyFromEmuSwapped(init_array.data(), init_addr, sizeof(init_array));
+    m_memory.CopyFromEmuSwapped(init_array.data(), init_addr, sizeof(init_array));
     for (size_t i = 0; i < BufCount; ++i)
     {
       const BufferDesc& buf = buffers[i];
@@ -175,8 +191,9 @@ protected:
   void DoAXState(PointerWrap& p);
 
 private:
-  void ReadPB(Memory::MemoryManager& memory, u32 addr, AXPB& pb);
-  void WritePB(Memory::MemoryManager& memory, u32 addr, const AXPB& pb);
+  void ReadPB(u32 addr, AXPB& pb);
+  void WritePB(u32 addr, const AXPB& pb);
+  bool RecordPBList(u32 pb_addr, std::vector<u32>* processed_pbs);
 
   enum CmdType
   {
@@ -0,0 +1,183 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMemory.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/Align.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/DSP.h"
+#include "Core/HW/Memmap.h"
+
+namespace DSP::HLE
+{
+AXMemory::AXMemory(Memory::MemoryManager& memory, DSPManager& dsp) : m_memory(memory), m_dsp(dsp)
+{
+}
+
+void AXMemory::StartRecording()
+{
+  Reset();
+  m_mode = Mode::Recording;
+}
+
+void AXMemory::RecordRange(u32 address, size_t size)
+{
+  // Invalid ranges aren't recorded, so reading them while replaying fails as reading RAM would.
+  const u8* src = m_memory.GetPointerForRange(address, size);
+  if (src == nullptr)
+    return;
+
+  const size_t offset = AppendRange(&m_recorded_ranges, &m_recorded_data, address, size);
+  std::copy_n(src, size, m_recorded_data.begin() + offset);
+}
+
+void AXMemory::StartReplaying()
+{
+  m_mode = Mode::Replaying;
+  m_next_range = 0;
+  m_next_aram_read = 0;
+}
+
+void AXMemory::ApplyWrites()
+{
+  for (const Range& range : m_write_ranges)
+    m_memory.CopyToEmu(range.address, m_write_data.data() + range.offset, range.size);
+
+  Reset();
+}
+
+void AXMemory::Reset()
+{
+  m_mode = Mode::Direct;
+  m_recorded_ranges.clear();
+  m_recorded_data.clear();
+  m_next_range = 0;
+  m_aram_reads.clear();
+  m_next_aram_read = 0;
+  m_write_ranges.clear();
+  m_write_data.clear();
+}
+
+size_t AXMemory::AppendRange(std::vector<Range>* ranges, std::vector<u8>* data, u32 address,
+                             size_t size)
+{
+  // Keep the data aligned, as the uCode reads it as arrays of 32-bit samples.
+  const size_t offset = Common::AlignUp(data->size(), sizeof(u64));
+  data->resize(offset + size);
+  ranges->push_back({address, static_cast<u32>(size), offset});
+  return offset;
+}
+
+const u8* AXMemory::GetPointerForRange(u32 address, size_t size)
+{
+  switch (m_mode)
+  {
+  case Mode::Direct:
+    return m_memory.GetPointerForRange(address, size);
+
+  case Mode::Recording:
+  {
+    const size_t num_ranges = m_recorded_ranges.size();
+    RecordRange(address, size);
+    if (m_recorded_ranges.size() == num_ranges)
+      return nullptr;
+    return m_recorded_data.data() + m_recorded_ranges.back().offset;
+  }
+
+  case Mode::Replaying:
+    for (size_t i = 0; i < m_recorded_ranges.size(); ++i)
+    {
+      const size_t index = (m_next_range + i) % m_recorded_ranges.size();
+      const Range& range = m_recorded_ranges[index];
+      if (address >= range.address && address - range.address <= range.size &&
+          size <= range.size - (address - range.address))
+      {
+        m_next_range = index + 1;
+        return m_recorded_data.data() + range.offset + (address - range.address);
+      }
+    }
+
+    ERROR_LOG_FMT(DSPHLE, "AX read {:#x} bytes at {:#010x}, which were not recorded", size,
+                  address);
+    if (m_zeros.size() < size)
+      m_zeros.resize(size);
+    return m_zeros.data();
+  }
+
+  return nullptr;
+}
+
+void AXMemory::CopyToEmu(u32 address, const void* data, size_t size)
+{
+  u8* dest = BeginWrite(address, size);
+  if (dest == nullptr)
+    return;
+
+  std::memcpy(dest, data, size);
+  EndWrite(address, dest, size);
+}
+
+u8* AXMemory::BeginWrite(u32 address, size_t size)
+{
+  if (m_mode == Mode::Direct)
+    return m_memory.GetPointerForRange(address, size);
+
+  const size_t offset = AppendRange(&m_write_ranges, &m_write_data, address, size);
+  return m_write_data.data() + offset;
+}
+
+void AXMemory::EndWrite(u32 address, const u8* data, size_t size)
+{
+  if (m_mode == Mode::Direct)
+    return;
+
+  for (const Range& range : m_recorded_ranges)
+  {
+    const u32 begin = std::max(address, range.address);
+    const u64 end = std::min<u64>(u64(address) + size, u64(range.address) + range.size);
+    if (begin < end)
+    {
+      std::copy_n(data + (begin - address), end - begin,
+                  m_recorded_data.begin() + range.offset + (begin - range.address));
+    }
+  }
+}
+
+u8 AXMemory::ReadARAM(u32 address)
+{
+  switch (m_mode)
+  {
+  case Mode::Direct:
+    break;
+
+  case Mode::Recording:
+    m_aram_reads.push_back(m_dsp.ReadARAM(address));
+    return m_aram_reads.back();
+
+  case Mode::Replaying:
+    if (m_next_aram_read < m_aram_reads.size())
+      return m_aram_reads[m_next_aram_read++];
+
+    ERROR_LOG_FMT(DSPHLE, "AX read ARAM at {:#010x}, which was not recorded", address);
+    return 0;
+  }
+
+  return m_dsp.ReadARAM(address);
+}
+
+void AXMemory::WriteARAM(u8 value, u32 address)
+{
+  // AX only reads sample data through the accelerator.
+  if (m_mode != Mode::Direct)
+  {
+    ERROR_LOG_FMT(DSPHLE, "AX wrote ARAM at {:#010x} while processing a command list", address);
+    return;
+  }
+
+  m_dsp.WriteARAM(value, address);
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,131 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+namespace DSP
+{
+class DSPManager;
+}
+namespace Memory
+{
+class MemoryManager;
+}
+
+namespace DSP::HLE
+{
+// Emulated memory as seen by the AX uCode while it processes a command list.
+//
+// Command lists are normally processed on the CPU thread, which accesses RAM and ARAM directly.
+// To process one on the DSP HLE thread instead, everything it reads is recorded on the CPU thread
+// when the command list is received: RAM ranges are copied, and the bytes read by the accelerator
+// are logged. The DSP HLE thread then only replays these reads, and logs its writes to RAM. The
+// CPU thread applies them at the next synchronization point. This way, the two threads never
+// access emulated memory at the same time, and neither what the command list reads nor when its
+// results become visible depends on host timing.
+class AXMemory
+{
+public:
+  AXMemory(Memory::MemoryManager& memory, DSPManager& dsp);
+
+  // Starts recording. Reads access emulated memory, and are recorded so they can be replayed.
+  void StartRecording();
+  // Copies a range of RAM that is going to be read while replaying.
+  void RecordRange(u32 address, size_t size);
+  // Stops recording. Reads now replay what was recorded, and writes are logged.
+  void StartReplaying();
+  // Writes the logged writes to RAM, and goes back to accessing emulated memory directly.
+  void ApplyWrites();
+  // Discards anything recorded or logged, and goes back to accessing emulated memory directly.
+  void Reset();
+
+  // Returns nullptr if the range isn't valid memory, like MemoryManager::GetPointerForRange. While
+  // recording, the returned data is only valid until the next read.
+  const u8* GetPointerForRange(u32 address, size_t size);
+  void CopyToEmu(u32 address, const void* data, size_t size);
+
+  template <typename T>
+  void CopyFromEmuSwapped(T* data, u32 address, size_t size)
+  {
+    const u8* src = GetPointerForRange(address, size);
+    if (src == nullptr)
+      return;
+
+    for (size_t i = 0; i < size / sizeof(T); i++)
+    {
+      T value;
+      std::memcpy(&value, src + i * sizeof(T), sizeof(T));
+      data[i] = Common::FromBigEndian(value);
+    }
+  }
+
+  template <typename T>
+  void CopyToEmuSwapped(u32 address, const T* data, size_t size)
+  {
+    u8* dest = BeginWrite(address, size);
+    if (dest == nullptr)
+      return;
+
+    for (size_t i = 0; i < size / sizeof(T); i++)
+    {
+      const T value = Common::FromBigEndian(data[i]);
+      std::memcpy(dest + i * sizeof(T), &value, sizeof(T));
+    }
+    EndWrite(address, dest, size);
+  }
+
+  // Accessed by the accelerator when reading sample data.
+  u8 ReadARAM(u32 address);
+  void WriteARAM(u8 value, u32 address);
+
+private:
+  enum class Mode
+  {
+    Direct,
+    Recording,
+    Replaying,
+  };
+
+  struct Range
+  {
+    u32 address;
+    u32 size;
+    size_t offset;
+  };
+
+  // Returns where the data of a write has to be stored, and EndWrite must be called once it is.
+  u8* BeginWrite(u32 address, size_t size);
+  void EndWrite(u32 address, const u8* data, size_t size);
+  static size_t AppendRange(std::vector<Range>* ranges, std::vector<u8>* data, u32 address,
+                            size_t size);
+
+  Memory::MemoryManager& m_memory;
+  DSPManager& m_dsp;
+
+  Mode m_mode = Mode::Direct;
+
+  // RAM copied while recording. Writes made while replaying are also applied to these copies, so
+  // that reading a range again returns what the command list wrote to it, as it would in RAM.
+  std::vector<Range> m_recorded_ranges;
+  std::vector<u8> m_recorded_data;
+  // Index of the range after the last one that was read. Ranges are replayed in the order they
+  // were recorded, so the next read usually finds its range there.
+  size_t m_next_range = 0;
+
+  std::vector<u8> m_aram_reads;
+  size_t m_next_aram_read = 0;
+
+  std::vector<Range> m_write_ranges;
+  std::vector<u8> m_write_data;
+
+  // Returned for reads of ranges that weren't recorded.
+  std::vector<u8> m_zeros;
+};
+}  // namespace DSP::HLE
@@ -0,0 +1,169 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMixer.h"
+
+#include <algorithm>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE::AXMixer
+{
+namespace
+{
+// Number of samples processed per SIMD iteration.
+constexpr u32 BLOCK_SIZE = 8;
+
+s16 ScaleSample(s16 sample, u16 volume, bool signed_volume)
+{
+  const s32 vol = signed_volume ? s32(s16(volume)) : s32(volume);
+  return static_cast<s16>(std::clamp<s32>((s32(sample) * vol) >> 15, -0x8000, 0x7FFF));
+}
+
+#if defined(_M_X86_64)
+__m128i RampStart(u16 volume, u16 volume_delta)
+{
+  const __m128i lanes = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(s16(volume)),
+                       _mm_mullo_epi16(_mm_set1_epi16(s16(volume_delta)), lanes));
+}
+
+// Computes saturate_s16((x * v) >> 15) for 8 lanes, matching ScaleSample.
+__m128i ScaleSamples(__m128i x, __m128i v, bool signed_volume)
+{
+  const __m128i lo = _mm_mullo_epi16(x, v);
+  __m128i hi = _mm_mulhi_epi16(x, v);
+  // mulhi treats the volume as signed. For unsigned volumes >= 0x8000 that product is short by
+  // x << 16, which only affects the high half.
+  if (!signed_volume)
+    hi = _mm_add_epi16(hi, _mm_and_si128(x, _mm_srai_epi16(v, 15)));
+  const __m128i p0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+  const __m128i p1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+  return _mm_packs_epi32(p0, p1);
+}
+#elif defined(_M_ARM_64)
+uint16x8_t RampStart(u16 volume, u16 volume_delta)
+{
+  static constexpr u16 lanes[BLOCK_SIZE] = {0, 1, 2, 3, 4, 5, 6, 7};
+  return vmlaq_u16(vdupq_n_u16(volume), vld1q_u16(lanes), vdupq_n_u16(volume_delta));
+}
+
+// Computes saturate_s16((x * v) >> 15) for 8 lanes, matching ScaleSample.
+int16x8_t ScaleSamples(int16x8_t x, uint16x8_t v, bool signed_volume)
+{
+  int32x4_t p0, p1;
+  if (signed_volume)
+  {
+    const int16x8_t sv = vreinterpretq_s16_u16(v);
+    p0 = vmull_s16(vget_low_s16(x), vget_low_s16(sv));
+    p1 = vmull_high_s16(x, sv);
+  }
+  else
+  {
+    p0 = vmulq_s32(vmovl_s16(vget_low_s16(x)), vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v))));
+    p1 = vmulq_s32(vmovl_high_s16(x), vreinterpretq_s32_u32(vmovl_high_u16(v)));
+  }
+  return vcombine_s16(vqshrn_n_s32(p0, 15), vqshrn_n_s32(p1, 15));
+}
+#endif
+}  // namespace
+
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  if (count >= BLOCK_SIZE)
+  {
+    __m128i vol = RampStart(volume, volume_delta);
+    const __m128i step = _mm_set1_epi16(s16(volume_delta * BLOCK_SIZE));
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+      __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+      _mm_storeu_si128(ptr, ScaleSamples(_mm_loadu_si128(ptr), vol, signed_volume));
+      vol = _mm_add_epi16(vol, step);
+    }
+    volume += static_cast<u16>(volume_delta * i);
+  }
+#elif defined(_M_ARM_64)
+  if (count >= BLOCK_SIZE)
+  {
+    uint16x8_t vol = RampStart(volume, volume_delta);
+    const uint16x8_t step = vdupq_n_u16(u16(volume_delta * BLOCK_SIZE));
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+      vst1q_s16(samples + i, ScaleSamples(vld1q_s16(samples + i), vol, signed_volume));
+      vol = vaddq_u16(vol, step);
+    }
+    volume += static_cast<u16>(volume_delta * i);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    samples[i] = ScaleSample(samples[i], volume, signed_volume);
+    volume += volume_delta;
+  }
+
+  return volume;
+}
+
+u16 MixAdd(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta, s16* last_sample)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  if (count >= BLOCK_SIZE)
+  {
+    __m128i vol = RampStart(volume, volume_delta);
+    const __m128i step = _mm_set1_epi16(s16(volume_delta * BLOCK_SIZE));
+    __m128i result = _mm_setzero_si128();
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+      const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      result = ScaleSamples(in, vol, false);
+      vol = _mm_add_epi16(vol, step);
+
+      __m128i* out_ptr = reinterpret_cast<__m128i*>(out + i);
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(result, result), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(result, result), 16);
+      _mm_storeu_si128(out_ptr, _mm_add_epi32(_mm_loadu_si128(out_ptr), lo));
+      _mm_storeu_si128(out_ptr + 1, _mm_add_epi32(_mm_loadu_si128(out_ptr + 1), hi));
+    }
+    volume += static_cast<u16>(volume_delta * i);
+    *last_sample = static_cast<s16>(_mm_extract_epi16(result, 7));
+  }
+#elif defined(_M_ARM_64)
+  if (count >= BLOCK_SIZE)
+  {
+    uint16x8_t vol = RampStart(volume, volume_delta);
+    const uint16x8_t step = vdupq_n_u16(u16(volume_delta * BLOCK_SIZE));
+    int16x8_t result = vdupq_n_s16(0);
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+      result = ScaleSamples(vld1q_s16(input + i), vol, false);
+      vol = vaddq_u16(vol, step);
+
+      vst1q_s32(out + i, vaddq_s32(vld1q_s32(out + i), vmovl_s16(vget_low_s16(result))));
+      vst1q_s32(out + i + 4, vaddq_s32(vld1q_s32(out + i + 4), vmovl_high_s16(result)));
+    }
+    volume += static_cast<u16>(volume_delta * i);
+    *last_sample = vgetq_lane_s16(result, 7);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    const s16 sample = ScaleSample(input[i], volume, false);
+    out[i] += sample;
+    volume += volume_delta;
+    *last_sample = sample;
+  }
+
+  return volume;
+}
+}  // namespace DSP::HLE::AXMixer
@@ -0,0 +1,28 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Sample processing kernels shared by the AX GC and AX Wii voice code. These operate on whole
+// blocks of samples so that they can be vectorized, and produce results that are bit-identical to
+// the per-sample reference implementation.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE::AXMixer
+{
+// Multiplies each sample by a volume that starts at <volume> and is incremented (with 16-bit
+// wraparound) by <volume_delta> after every sample. The product is shifted right by 15 and
+// saturated to 16 bits. If <signed_volume> is set, the volume is interpreted as an s16 (AX GC),
+// otherwise as an u16 (AX Wii).
+//
+// Returns the volume after the last sample.
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume);
+
+// Same volume computation as ApplyVolumeRamp (with an unsigned volume), but the result is added
+// to <out> instead of being stored. The last computed sample is written to <last_sample> when
+// <count> is not zero.
+//
+// Returns the volume after the last sample.
+u16 MixAdd(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta, s16* last_sample);
+}  // namespace DSP::HLE::AXMixer
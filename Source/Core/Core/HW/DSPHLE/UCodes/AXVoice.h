@@ -12,18 +12,20 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <functional>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXMemory.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixer.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
-#include "Core/HW/Memmap.h"
-#include "Core/System.h"
 
 namespace DSP::HLE
 {
@@ -48,7 +50,7 @@ namespace
 // Useful macro to convert xxx_hi + xxx_lo to xxx for 32 bits.
 #define HILO_TO_32(name) ((u32(name##_hi) << 16) | name##_lo)
 
-PBUpdateData LoadPBUpdates(Memory::MemoryManager& memory, const PB_TYPE& pb)
+PBUpdateData LoadPBUpdates(AXMemory& memory, const PB_TYPE& pb)
 {
   PBUpdateData updates;
   u32 updates_addr = HILO_TO_32(pb.updates.data);
@@ -129,7 +131,7 @@ union AXBuffers
 class HLEAccelerator final : public Accelerator
 {
 public:
-  explicit HLEAccelerator(DSPManager& dsp) : m_dsp(dsp) {}
+  explicit HLEAccelerator(AXMemory& memory) : m_memory(memory) {}
   HLEAccelerator(const HLEAccelerator&) = delete;
   HLEAccelerator(HLEAccelerator&&) = delete;
   HLEAccelerator& operator=(const HLEAccelerator&) = delete;
@@ -170,12 +172,12 @@ protected:
     }
   }
 
-  u8 ReadMemory(u32 address) override { return m_dsp.ReadARAM(address); }
+  u8 ReadMemory(u32 address) override { return m_memory.ReadARAM(address); }
 
-  void WriteMemory(u32 address, u8 value) override { m_dsp.WriteARAM(value, address); }
+  void WriteMemory(u32 address, u8 value) override { m_memory.WriteARAM(value, address); }
 
 private:
-  DSPManager& m_dsp;
+  AXMemory& m_memory;
 };
 
 // Sets up the simulated accelerator.
@@ -200,8 +202,34 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
   return accelerator->ReadSample(accelerator->acc_pb->adpcm.coefs);
 }
 
-// Reads samples from the input callback, resamples them to <count> samples at
-// the wanted sample rate (computed from the ratio, see below).
+// Maximum number of input samples that GetInputSamples decodes into a stack buffer. Higher
+// resampling ratios are legal but never seen in practice, and fall back to a heap buffer.
+constexpr u32 MAX_INPUT_SAMPLES_PER_FRAME = MAX_SAMPLES_PER_FRAME * 8;
+
+// Number of history samples that precede the input samples passed to ResampleAudio.
+constexpr u32 RESAMPLE_HISTORY = 4;
+
+// Returns the number of input samples ResampleAudio will consume to produce <count> samples.
+u32 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio, int srctype)
+{
+  if (srctype != SRCTYPE_LINEAR && srctype != SRCTYPE_POLYPHASE)
+    return count;
+
+  u32 input_count = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    input_count += curr_pos >> 16;
+    curr_pos &= 0xFFFF;
+  }
+  return input_count;
+}
+
+// Resamples input samples to <count> samples at the wanted sample rate (computed from the ratio,
+// see below).
+//
+// <input> must contain the four <last_samples> values followed by the number of input samples
+// returned by GetResampleInputCount.
 //
 // If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
 // (or the srctype will automatically be changed to LINEAR).
@@ -220,73 +248,39 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
-                  u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
+u32 ResampleAudio(const s16* input, s16* output, u32 count, s16* last_samples, u32 curr_pos,
+                  u32 ratio, int srctype, const s16* coeffs)
 {
-  int read_samples_count = 0;
+  // Index of the oldest of the four most recently read samples. The interpolation uses the
+  // samples starting from there, which introduces the same delay as the hardware.
+  u32 read_pos = 0;
 
   // If DSP DROM coefficients are available, support polyphase resampling.
   if (coeffs && srctype == SRCTYPE_POLYPHASE)
   {
-    s16 temp[4];
-    u32 idx = 0;
-
-    temp[idx++ & 3] = last_samples[0];
-    temp[idx++ & 3] = last_samples[1];
-    temp[idx++ & 3] = last_samples[2];
-    temp[idx++ & 3] = last_samples[3];
-
     for (u32 i = 0; i < count; ++i)
     {
       curr_pos += ratio;
-      while (curr_pos >= 0x10000)
-      {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
-        curr_pos -= 0x10000;
-      }
+      read_pos += curr_pos >> 16;
+      curr_pos &= 0xFFFF;
 
       u16 curr_pos_frac = ((curr_pos & 0xFFFF) >> 9) << 2;
       const s16* c = &coeffs[curr_pos_frac];
+      const s16* t = &input[read_pos];
 
-      s64 t0 = temp[idx++ & 3];
-      s64 t1 = temp[idx++ & 3];
-      s64 t2 = temp[idx++ & 3];
-      s64 t3 = temp[idx++ & 3];
-
-      s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
+      s64 samp = (s64(t[0]) * c[0] + s64(t[1]) * c[1] + s64(t[2]) * c[2] + s64(t[3]) * c[3]) >> 15;
 
       output[i] = MathUtil::SaturatingCast<s16>(samp);
     }
-
-    last_samples[3] = temp[--idx & 3];
-    last_samples[2] = temp[--idx & 3];
-    last_samples[1] = temp[--idx & 3];
-    last_samples[0] = temp[--idx & 3];
   }
   else if (srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE)
   {
-    // This is the circular buffer containing samples to use for the
-    // interpolation. It is initialized with the values from the PB, and it
-    // will be stored back to the PB at the end.
-    s16 temp[4];
-    u32 idx = 0;
-
-    temp[idx++ & 3] = last_samples[0];
-    temp[idx++ & 3] = last_samples[1];
-    temp[idx++ & 3] = last_samples[2];
-    temp[idx++ & 3] = last_samples[3];
-
     for (u32 i = 0; i < count; ++i)
     {
+      // While our current position is >= 1.0, advance in the input stream.
       curr_pos += ratio;
-
-      // While our current position is >= 1.0, push new samples to the
-      // circular buffer.
-      while (curr_pos >= 0x10000)
-      {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
-        curr_pos -= 0x10000;
-      }
+      read_pos += curr_pos >> 16;
+      curr_pos &= 0xFFFF;
 
       // Get our current fractional position, used to know how much of
       // curr0 and how much of curr1 the output sample should be.
@@ -298,40 +292,43 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       s16 sample;
       if (curr_frac)
       {
-        s32 s0 = temp[idx++ & 3];
-        s32 s1 = temp[idx++ & 3];
+        s32 s0 = input[read_pos];
+        s32 s1 = input[read_pos + 1];
 
         sample = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
-        idx += 2;
       }
       else
       {
-        sample = temp[idx++ & 3];
-        idx += 3;
+        sample = input[read_pos];
       }
 
       output[i] = sample;
     }
-
-    // Update the four last_samples values.
-    last_samples[3] = temp[--idx & 3];
-    last_samples[2] = temp[--idx & 3];
-    last_samples[1] = temp[--idx & 3];
-    last_samples[0] = temp[--idx & 3];
   }
   else  // SRCTYPE_NEAREST
   {
-    // No sample rate conversion here: simply read samples from the
-    // accelerator to the output buffer.
-    for (u32 i = 0; i < count; ++i)
-      output[i] = input_callback(i);
-
-    memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
+    // No sample rate conversion here: simply copy the input samples to the
+    // output buffer.
+    read_pos = count;
+    memcpy(output, input + RESAMPLE_HISTORY, count * sizeof(s16));
   }
 
+  // Update the four last_samples values.
+  memcpy(last_samples, input + read_pos, RESAMPLE_HISTORY * sizeof(s16));
+
   return curr_pos;
 }
 
+// Update current position, YN1, YN2 and pred scale in the PB.
+void UpdatePBFromAccelerator(HLEAccelerator* accelerator, PB_TYPE& pb)
+{
+  pb.audio_addr.cur_addr_hi = static_cast<u16>(accelerator->GetCurrentAddress() >> 16);
+  pb.audio_addr.cur_addr_lo = static_cast<u16>(accelerator->GetCurrentAddress());
+  pb.adpcm.yn1 = accelerator->GetYn1();
+  pb.adpcm.yn2 = accelerator->GetYn2();
+  pb.adpcm.pred_scale = accelerator->GetPredScale();
+}
+
 // Read <count> input samples from ARAM, decoding and converting rate
 // if required.
 void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
@@ -341,17 +338,50 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const u32 input_count = GetResampleInputCount(count, pb.src.cur_addr_frac, ratio, pb.src_type);
+
+  // Decode the whole block of input samples first, so that resampling can work on a plain buffer
+  // instead of going back to the accelerator for every sample.
+  std::array<s16, RESAMPLE_HISTORY + MAX_INPUT_SAMPLES_PER_FRAME> input_buffer;
+  std::vector<s16> large_input_buffer;
+  s16* input = input_buffer.data();
+  if (input_count > MAX_INPUT_SAMPLES_PER_FRAME)
+  {
+    large_input_buffer.resize(RESAMPLE_HISTORY + input_count);
+    input = large_input_buffer.data();
+  }
+
+  memcpy(input, pb.src.last_samples, RESAMPLE_HISTORY * sizeof(s16));
+  for (u32 i = 0; i < input_count; ++i)
+    input[RESAMPLE_HISTORY + i] = AcceleratorGetSample(accelerator);
+
+  u32 curr_pos = ResampleAudio(input, samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
+                               ratio, pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
-  // Update current position, YN1, YN2 and pred scale in the PB.
-  pb.audio_addr.cur_addr_hi = static_cast<u16>(accelerator->GetCurrentAddress() >> 16);
-  pb.audio_addr.cur_addr_lo = static_cast<u16>(accelerator->GetCurrentAddress());
-  pb.adpcm.yn1 = accelerator->GetYn1();
-  pb.adpcm.yn2 = accelerator->GetYn2();
-  pb.adpcm.pred_scale = accelerator->GetPredScale();
+  UpdatePBFromAccelerator(accelerator, pb);
+}
+
+// Reads the ARAM that GetInputSamples would read for <count> samples, and updates the PB in the
+// same way, without decoding or resampling anything. Used to record what a command list reads.
+void SkipInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, u16 count)
+{
+  if (pb.running != 1)
+    return;
+
+  AcceleratorSetup(accelerator, &pb);
+
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const u32 input_count = GetResampleInputCount(count, pb.src.cur_addr_frac, ratio, pb.src_type);
+  for (u32 i = 0; i < input_count; ++i)
+    AcceleratorGetSample(accelerator);
+
+  if (pb.src_type == SRCTYPE_LINEAR || pb.src_type == SRCTYPE_POLYPHASE)
+    pb.src.cur_addr_frac = (pb.src.cur_addr_frac + count * ratio) & 0xFFFF;
+
+  UpdatePBFromAccelerator(accelerator, pb);
 }
 
 s16 ClampS16(s64 sample)
@@ -362,48 +392,38 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
-  // mixing loop can avoid testing if volume ramping is enabled at each step,
-  // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
-
-    out[i] += sample16;
-    volume += volume_delta;
-
-    *dpop = sample16;
-  }
+  // If volume ramping is disabled, use a volume_delta of 0. That way, the
+  // mixing kernel doesn't need to test if volume ramping is enabled.
+  vd->volume = AXMixer::MixAdd(out, input, count, vd->volume, ramp ? vd->volume_delta : 0, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value.
 static void LowPassFilter(s16* samples, u32 count, PBLowPassFilter& f)
 {
+  // Keep the filter state in locals so that it stays in registers across the loop.
+  const s32 a0 = f.a0;
+  const s32 b0 = f.b0;
+  s16 yn1 = f.yn1;
   for (u32 i = 0; i < count; ++i)
-    f.yn1 = samples[i] = ClampS16((f.a0 * (s32)samples[i] + f.b0 * (s32)f.yn1) >> 15);
+    yn1 = samples[i] = ClampS16((a0 * (s32)samples[i] + b0 * (s32)yn1) >> 15);
+  f.yn1 = yn1;
 }
 
 #ifdef AX_WII
 static void BiquadFilter(s16* samples, u32 count, PBBiquadFilter& f)
 {
+  // Keep the filter state in locals so that it stays in registers across the loop.
+  const s32 b0 = f.b0, b1 = f.b1, b2 = f.b2, a1 = f.a1, a2 = f.a2;
+  s16 xn1 = f.xn1, xn2 = f.xn2, yn1 = f.yn1, yn2 = f.yn2;
   for (u32 i = 0; i < count; ++i)
   {
     s16 xn0 = samples[i];
     s64 tmp = 0;
-    tmp += f.b0 * s32(xn0);
-    tmp += f.b1 * s32(f.xn1);
-    tmp += f.b2 * s32(f.xn2);
-    tmp += f.a1 * s32(f.yn1);
-    tmp += f.a2 * s32(f.yn2);
+    tmp += b0 * s32(xn0);
+    tmp += b1 * s32(xn1);
+    tmp += b2 * s32(xn2);
+    tmp += a1 * s32(yn1);
+    tmp += a2 * s32(yn2);
     tmp <<= 2;
     // CLRL
     if (tmp & 0x10000)
@@ -412,12 +432,16 @@ static void BiquadFilter(s16* samples, u32 count, PBBiquadFilter& f)
       tmp += 0x7FFF;
     tmp >>= 16;
     s16 yn0 = ClampS16(tmp);
-    f.xn2 = f.xn1;
-    f.yn2 = f.yn1;
-    f.xn1 = xn0;
-    f.yn1 = yn0;
+    xn2 = xn1;
+    yn2 = yn1;
+    xn1 = xn0;
+    yn1 = yn0;
     samples[i] = yn0;
   }
+  f.xn1 = xn1;
+  f.xn2 = xn2;
+  f.yn1 = yn1;
+  f.yn2 = yn2;
 }
 #endif
 
@@ -435,19 +459,16 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  pb.vol_env.cur_volume = static_cast<s16>(
+      AXMixer::ApplyVolumeRamp(samples, count, static_cast<u16>(pb.vol_env.cur_volume),
+                               static_cast<u16>(pb.vol_env.cur_volume_delta), signed_volume));
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
@@ -571,9 +592,11 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 
     // We use ratio 0x55555 == (5 * 65536 + 21845) / 65536 == 5.3333 which
     // is the nearest we can get to 96/18
-    u32 curr_pos = ResampleAudio([&samples](u32 i) { return samples[i]; }, wm_samples, wm_count,
-                                 pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
-                                 SRCTYPE_POLYPHASE, coeffs);
+    s16 wm_input[RESAMPLE_HISTORY + MAX_SAMPLES_PER_FRAME];
+    memcpy(wm_input, pb.remote_src.last_samples, RESAMPLE_HISTORY * sizeof(s16));
+    memcpy(wm_input + RESAMPLE_HISTORY, samples, count * sizeof(s16));
+    u32 curr_pos = ResampleAudio(wm_input, wm_samples, wm_count, pb.remote_src.last_samples,
+                                 pb.remote_src.cur_addr_frac, 0x55555, SRCTYPE_POLYPHASE, coeffs);
     pb.remote_src.cur_addr_frac = curr_pos & 0xFFFF;
 
 // Mix to main[0-3] and aux[0-3]
@@ -5,7 +5,10 @@
 
 #include "Core/HW/DSPHLE/UCodes/AXWii.h"
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -31,7 +34,7 @@ AXWiiUCode::AXWiiUCode(DSPHLE* dsphle, u32 crc)
   m_old_axwii = crc == 0xfa450138 || crc == 0x7699af32;
   m_new_filter = crc == 0x347112ba || crc == 0x4cc52064;
 
-  m_accelerator = std::make_unique<HLEAccelerator>(dsphle->GetSystem().GetDSP());
+  m_accelerator = std::make_unique<HLEAccelerator>(m_memory);
 }
 
 void AXWiiUCode::Initialize()
@@ -256,6 +259,121 @@ void AXWiiUCode::HandleCommandList()
   }
 }
 
+bool AXWiiUCode::RecordCommandList()
+{
+  // Walk the command list like HandleCommandList does, recording what each command reads.
+  bool out_of_bounds = false;
+  u32 curr_idx = 0;
+  const auto next = [&] {
+    if (curr_idx >= std::size(m_cmdlist))
+    {
+      out_of_bounds = true;
+      return u16(0);
+    }
+    return m_cmdlist[curr_idx++];
+  };
+  const auto next_addr = [&] {
+    const u16 hi = next();
+    const u16 lo = next();
+    return (u32(hi) << 16) | lo;
+  };
+
+  constexpr u32 buffer_size = 3 * 32 * sizeof(int);
+
+  // Which compressor ramp gets read depends on the mixed samples, so keep track of every value
+  // m_compressor_pos can take.
+  std::vector<u16> compressor_positions{m_compressor_pos};
+
+  std::vector<u32> processed_pbs;
+  u32 pb_addr = 0;
+
+  // The old command set has an additional PB_ADDR command. Map the other commands to the new set.
+  const auto convert_old_command = [](u16 cmd) -> int {
+    if (cmd < CMD_PB_ADDR_OLD)
+      return cmd;
+    if (cmd == CMD_PB_ADDR_OLD)
+      return -1;
+    return cmd - 1;
+  };
+
+  bool end = false;
+  while (!end && !out_of_bounds)
+  {
+    const u16 raw_cmd = next();
+    const int cmd = m_old_axwii ? convert_old_command(raw_cmd) : raw_cmd;
+
+    switch (cmd)
+    {
+    case -1:
+      pb_addr = next_addr();
+      break;
+
+    case CMD_SETUP:
+      m_memory.RecordRange(next_addr(), 3 * 20 * sizeof(u16));
+      break;
+
+    case CMD_ADD_TO_LR:
+    case CMD_SUB_TO_LR:
+      m_memory.RecordRange(next_addr(), buffer_size);
+      break;
+
+    case CMD_ADD_SUB_TO_LR:
+      m_memory.RecordRange(next_addr(), 2 * buffer_size);
+      break;
+
+    case CMD_PROCESS:
+      if (!m_old_axwii)
+        pb_addr = next_addr();
+      if (!RecordPBList(pb_addr, &processed_pbs))
+        return false;
+      break;
+
+    case CMD_MIX_AUXA:
+    case CMD_MIX_AUXB:
+    case CMD_MIX_AUXC:
+      next();
+      next_addr();
+      m_memory.RecordRange(next_addr(), 3 * buffer_size);
+      break;
+
+    case CMD_UPL_AUXA_MIX_LRSC:
+    case CMD_UPL_AUXB_MIX_LRSC:
+      next();
+      next_addr();
+      next_addr();
+      for (int i = 0; i < 4; ++i)
+        m_memory.RecordRange(next_addr(), buffer_size);
+      break;
+
+    case CMD_COMPRESSOR:
+    {
+      next();
+      const u16 frames = next();
+      if (!RecordCompressorTable(next_addr(), frames, 3, &compressor_positions))
+        return false;
+      break;
+    }
+
+    case CMD_OUTPUT:
+    case CMD_OUTPUT_DPL2:
+      if (!m_old_axwii && m_crc != 0xd9c4bf34)
+        next();
+      curr_idx += 4;
+      break;
+
+    case CMD_WM_OUTPUT:
+      curr_idx += 8;
+      break;
+
+    case CMD_END:
+      end = true;
+      break;
+    }
+  }
+
+  return !out_of_bounds;
+}
+
 void AXWiiUCode::SetupProcessing(u32 init_addr)
 {
   const std::array<BufferDesc, 20> buffers = {{
@@ -273,8 +391,8 @@ void AXWiiUCode::SetupProcessing(u32 init_addr)
 
 void AXWiiUCode::AddToLR(u32 val_addr, bool neg)
 {
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(val_addr, 32 * 3 * sizeof(int)));
+  const int* ptr =
+      reinterpret_cast<const int*>(m_memory.GetPointerForRange(val_addr, 32 * 3 * sizeof(int)));
   for (int i = 0; i < 32 * 3; ++i)
   {
     int val = (int)Common::swap32(*ptr++);
@@ -288,8 +406,8 @@ void AXWiiUCode::AddToLR(u32 val_addr, bool neg)
 
 void AXWiiUCode::AddSubToLR(u32 val_addr)
 {
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  int* ptr = reinterpret_cast<int*>(memory.GetPointerForRange(val_addr, 2 * 32 * 3 * sizeof(int)));
+  const int* ptr = reinterpret_cast<const int*>(
+      m_memory.GetPointerForRange(val_addr, 2 * 32 * 3 * sizeof(int)));
   for (int i = 0; i < 32 * 3; ++i)
   {
     int val = (int)Common::swap32(*ptr++);
@@ -360,7 +478,7 @@ void AXWiiUCode::GenerateVolumeRamp(u16* output, u16 vol1, u16 vol2, size_t nval
   }
 }
 
-void AXWiiUCode::ReadPB(Memory::MemoryManager& memory, u32 addr, AXPBWii& pb)
+void AXWiiUCode::ReadPB(u32 addr, AXPBWii& pb)
 {
   // The Wii PB memory layout changed twice.
   // For HLE, we use the largest struct version.
@@ -374,32 +492,32 @@ void AXWiiUCode::ReadPB(Memory::MemoryManager& memory, u32 addr, AXPBWii& pb)
   case 0x7699af32:
   case 0xfa450138:
     // The hpf field is a bit smaller than the biquad. Skip the difference.
-    memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, gap_begin);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, gap_begin);
     memset(dst + gap_begin, 0, gap_end - gap_begin);
-    memory.CopyFromEmuSwapped<u16>((u16*)(dst + gap_end), addr + gap_begin, sizeof(pb) - gap_end);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)(dst + gap_end), addr + gap_begin, sizeof(pb) - gap_end);
     break;
   case 0xd9c4bf34:
   case 0xadbc06bd:
     // Skip updates field and skip gap after hpf.
-    memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, updates_begin);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, updates_begin);
     memset(dst + updates_begin, 0, sizeof(PBUpdatesWii));
-    memory.CopyFromEmuSwapped<u16>((u16*)(dst + updates_end), addr + updates_begin,
+    m_memory.CopyFromEmuSwapped<u16>((u16*)(dst + updates_end), addr + updates_begin,
                                    gap_begin - updates_end);
     memset(dst + gap_begin, 0, gap_end - gap_begin);
-    memory.CopyFromEmuSwapped<u16>((u16*)(dst + gap_end), addr + gap_begin, sizeof(pb) - gap_end);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)(dst + gap_end), addr + gap_begin, sizeof(pb) - gap_end);
     break;
   case 0x347112ba:
   case 0x4cc52064:
     // Just skip updates field.
-    memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, updates_begin);
+    m_memory.CopyFromEmuSwapped<u16>((u16*)dst, addr, updates_begin);
     memset(dst + updates_begin, 0, sizeof(PBUpdatesWii));
-    memory.CopyFromEmuSwapped<u16>((u16*)(dst + updates_end), addr + updates_begin,
+    m_memory.CopyFromEmuSwapped<u16>((u16*)(dst + updates_end), addr + updates_begin,
                                    sizeof(pb) - updates_end);
     break;
   }
 }
 
-void AXWiiUCode::WritePB(Memory::MemoryManager& memory, u32 addr, const AXPBWii& pb)
+void AXWiiUCode::WritePB(u32 addr, const AXPBWii& pb)
 {
   const char* src = (const char*)&pb;
   constexpr size_t updates_begin = offsetof(AXPBWii, updates);
@@ -410,22 +528,22 @@ void AXWiiUCode::WritePB(Memory::MemoryManager& memory, u32 addr, const AXPBWii&
   {
   case 0x7699af32:
   case 0xfa450138:
-    memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, gap_begin);
-    memory.CopyToEmuSwapped<u16>(addr + gap_begin, (const u16*)(src + gap_end),
+    m_memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, gap_begin);
+    m_memory.CopyToEmuSwapped<u16>(addr + gap_begin, (const u16*)(src + gap_end),
                                  sizeof(pb) - gap_end);
     break;
   case 0xd9c4bf34:
   case 0xadbc06bd:
-    memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, updates_begin);
-    memory.CopyToEmuSwapped<u16>(addr + updates_begin, (const u16*)(src + updates_end),
+    m_memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, updates_begin);
+    m_memory.CopyToEmuSwapped<u16>(addr + updates_begin, (const u16*)(src + updates_end),
                                  gap_begin - updates_end);
-    memory.CopyToEmuSwapped<u16>(addr + gap_begin, (const u16*)(src + gap_end),
+    m_memory.CopyToEmuSwapped<u16>(addr + gap_begin, (const u16*)(src + gap_end),
                                  sizeof(pb) - gap_end);
     break;
   case 0x347112ba:
   case 0x4cc52064:
-    memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, updates_begin);
-    memory.CopyToEmuSwapped<u16>(addr + updates_begin, (const u16*)(src + updates_end),
+    m_memory.CopyToEmuSwapped<u16>(addr, (const u16*)src, updates_begin);
+    m_memory.CopyToEmuSwapped<u16>(addr + updates_begin, (const u16*)(src + updates_end),
                                  sizeof(pb) - updates_end);
     break;
   }
@@ -439,7 +557,6 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
 
   AXPBWii pb;
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
   {
     AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
@@ -450,12 +567,12 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
                           m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
                           m_samples_wm3,       m_samples_aux3}};
 
-    ReadPB(memory, pb_addr, pb);
+    ReadPB(pb_addr, pb);
 
     if (m_old_axwii &&
         (pb.updates.num_updates[0] | pb.updates.num_updates[1] | pb.updates.num_updates[2]))
     {
-      PBUpdateData updates = LoadPBUpdates(memory, pb);
+      PBUpdateData updates = LoadPBUpdates(m_memory, pb);
       for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
       {
         ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
@@ -477,11 +594,51 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
                    m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
     }
 
-    WritePB(memory, pb_addr, pb);
+    WritePB(pb_addr, pb);
     pb_addr = HILO_TO_32(pb.next_pb);
   }
 }
 
+bool AXWiiUCode::RecordPBList(u32 pb_addr, std::vector<u32>* processed_pbs)
+{
+  constexpr u32 spms = 32;
+
+  // Voices are simulated with a separate accelerator, so that the real one is left as it is for
+  // HandleCommandList.
+  HLEAccelerator accelerator(m_memory);
+  AXPBWii pb;
+
+  while (pb_addr)
+  {
+    // A PB that is processed twice would be read again after it has been written, which the
+    // simulation below doesn't handle. This never happens in practice.
+    if (std::find(processed_pbs->begin(), processed_pbs->end(), pb_addr) != processed_pbs->end())
+      return false;
+    processed_pbs->push_back(pb_addr);
+
+    ReadPB(pb_addr, pb);
+
+    if (m_old_axwii &&
+        (pb.updates.num_updates[0] | pb.updates.num_updates[1] | pb.updates.num_updates[2]))
+    {
+      PBUpdateData updates = LoadPBUpdates(m_memory, pb);
+      for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
+      {
+        ApplyUpdatesForMs(curr_ms, pb, pb.updates.num_updates, updates);
+        SkipInputSamples(&accelerator, pb, spms);
+      }
+    }
+    else
+    {
+      SkipInputSamples(&accelerator, pb, 96);
+    }
+
+    pb_addr = HILO_TO_32(pb.next_pb);
+  }
+
+  return true;
+}
+
 void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 volume)
 {
   std::array<u16, 96> volume_ramp;
@@ -523,19 +680,18 @@ void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 vo
   }
 
   // Send the content of AUX buffers to the CPU
-  auto& memory = m_dsphle->GetSystem().GetMemory();
   if (write_addr)
   {
     for (const auto& buffer : buffers)
     {
-      memory.CopyToEmuSwapped(write_addr, buffer, 3 * 32 * sizeof(int));
+      m_memory.CopyToEmuSwapped(write_addr, buffer, 3 * 32 * sizeof(int));
       write_addr += 3 * 32 * sizeof(int);
     }
   }
 
   // Then read the buffers from the CPU and add to our main buffers.
-  const int* ptr = reinterpret_cast<int*>(
-      memory.GetPointerForRange(read_addr, main_buffers.size() * 3 * 32 * sizeof(int)));
+  const int* ptr = reinterpret_cast<const int*>(
+      m_memory.GetPointerForRange(read_addr, main_buffers.size() * 3 * 32 * sizeof(int)));
   for (auto& main_buffer : main_buffers)
   {
     for (u32 j = 0; j < 3 * 32; ++j)
@@ -554,12 +710,11 @@ void AXWiiUCode::UploadAUXMixLRSC(int aux_id, u32* addresses, u16 volume)
   int* aux_surround = aux_id ? m_samples_auxB_surround : m_samples_auxA_surround;
   int* auxc_buffer = aux_id ? m_samples_auxC_surround : m_samples_auxC_right;
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  memory.CopyToEmuSwapped(addresses[0], aux_left, 96 * sizeof(int));
-  memory.CopyToEmuSwapped(addresses[0] + 96 * sizeof(int), aux_right, 96 * sizeof(int));
-  memory.CopyToEmuSwapped(addresses[0] + 2 * 96 * sizeof(int), aux_surround, 96 * sizeof(int));
+  m_memory.CopyToEmuSwapped(addresses[0], aux_left, 96 * sizeof(int));
+  m_memory.CopyToEmuSwapped(addresses[0] + 96 * sizeof(int), aux_right, 96 * sizeof(int));
+  m_memory.CopyToEmuSwapped(addresses[0] + 2 * 96 * sizeof(int), aux_surround, 96 * sizeof(int));
 
-  memory.CopyToEmuSwapped(addresses[1], auxc_buffer, 96 * sizeof(int));
+  m_memory.CopyToEmuSwapped(addresses[1], auxc_buffer, 96 * sizeof(int));
 
   u16 volume_ramp[96];
   GenerateVolumeRamp(volume_ramp, m_last_aux_volumes[aux_id], volume, 96);
@@ -569,7 +724,7 @@ void AXWiiUCode::UploadAUXMixLRSC(int aux_id, u32* addresses, u16 volume)
                       m_samples_auxC_left};
   for (u32 mix_i = 0; mix_i < 4; ++mix_i)
   {
-    memory.CopyFromEmuSwapped(aux_left, addresses[2 + mix_i], 96 * sizeof(int));
+    m_memory.CopyFromEmuSwapped(aux_left, addresses[2 + mix_i], 96 * sizeof(int));
 
     for (u32 i = 0; i < 96; ++i)
     {
@@ -586,13 +741,12 @@ void AXWiiUCode::OutputSamples(u32 lr_addr, u32 surround_addr, u16 volume, bool
   GenerateVolumeRamp(volume_ramp.data(), m_last_main_volume, volume, volume_ramp.size());
   m_last_main_volume = volume;
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
-  memory.CopyToEmuSwapped(surround_addr, m_samples_main_surround, 3 * 32 * sizeof(int));
+  m_memory.CopyToEmuSwapped(surround_addr, m_samples_main_surround, 3 * 32 * sizeof(int));
 
   if (upload_auxc)
   {
-    memory.CopyToEmuSwapped(surround_addr + 3 * 32 * sizeof(int), m_samples_auxC_left,
-                            3 * 32 * sizeof(int));
+    m_memory.CopyToEmuSwapped(surround_addr + 3 * 32 * sizeof(int), m_samples_auxC_left,
+                              3 * 32 * sizeof(int));
   }
 
   // Clamp internal buffers to 16 bits.
@@ -617,7 +771,7 @@ void AXWiiUCode::OutputSamples(u32 lr_addr, u32 surround_addr, u16 volume, bool
     buffer[2 * i + 1] = Common::swap16(m_samples_main_left[i]);
   }
 
-  memory.CopyToEmu(lr_addr, buffer.data(), sizeof(buffer));
+  m_memory.CopyToEmu(lr_addr, buffer.data(), sizeof(buffer));
   m_mail_handler.PushMail(DSP_SYNC, true);
 }
 
@@ -625,16 +779,13 @@ void AXWiiUCode::OutputWMSamples(u32* addresses)
 {
   int* buffers[] = {m_samples_wm0, m_samples_wm1, m_samples_wm2, m_samples_wm3};
 
-  auto& memory = m_dsphle->GetSystem().GetMemory();
   for (u32 i = 0; i < 4; ++i)
   {
     int* in = buffers[i];
-    u16* out = reinterpret_cast<u16*>(memory.GetPointerForRange(addresses[i], 3 * 6 * sizeof(s16)));
+    std::array<s16, 3 * 6> out;
     for (u32 j = 0; j < 3 * 6; ++j)
-    {
-      s16 sample = ClampS16(in[j]);
-      out[j] = Common::swap16((u16)sample);
-    }
+      out[j] = ClampS16(in[j]);
+    m_memory.CopyToEmuSwapped(addresses[i], out.data(), sizeof(out));
   }
 }
 
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 
@@ -57,6 +59,7 @@ protected:
   static void GenerateVolumeRamp(u16* output, u16 vol1, u16 vol2, size_t nvals);
 
   void HandleCommandList() override;
+  bool RecordCommandList() override;
 
   void SetupProcessing(u32 init_addr);
   void AddToLR(u32 val_addr, bool neg);
@@ -68,8 +71,9 @@ protected:
   void OutputWMSamples(u32* addresses);  // 4 addresses
 
 private:
-  void ReadPB(Memory::MemoryManager& memory, u32 addr, AXPBWii& pb);
-  void WritePB(Memory::MemoryManager& memory, u32 addr, const AXPBWii& pb);
+  void ReadPB(u32 addr, AXPBWii& pb);
+  void WritePB(u32 addr, const AXPBWii& pb);
+  bool RecordPBList(u32 pb_addr, std::vector<u32>* processed_pbs);
 
   enum CmdType
   {
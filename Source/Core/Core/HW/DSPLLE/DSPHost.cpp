@@ -17,6 +17,7 @@
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
 
 // The user of the DSPCore library must supply a few functions so that the
 // emulation core can access the environment it runs in. If the emulation
@@ -70,6 +71,11 @@ void InterruptRequest()
   Core::System::GetInstance().GetDSP().GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP);
 }
 
+void IdleSkipped(u32 cycles)
+{
+  Core::System::GetInstance().GetPerfMetrics().CountDSPIdleSkip(cycles);
+}
+
 void CodeLoaded(DSPCore& dsp, u32 addr, size_t size)
 {
   auto& system = Core::System::GetInstance();
@@ -13,7 +13,9 @@
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
+#include "Common/Metrics.h"
 #include "Common/Thread.h"
+#include "Common/Tracing.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DSP/DSPAccelerator.h"
@@ -50,6 +52,9 @@ void DSPLLE::DoState(PointerWrap& p)
   p.Do(m_cycle_count);
 }
 
+static Common::Metrics::Counter s_time{"dsp_lle_time_ns_total",
+                                      "Time spent emulating the DSP with LLE, in nanoseconds"};
+
 // Regular thread
 void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
@@ -63,6 +68,8 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
       std::unique_lock dsp_thread_lock(dsp_lle->m_dsp_thread_mutex, std::try_to_lock);
       if (dsp_thread_lock)
       {
+        TRACE_SCOPE("DSP", "Run cycles");
+        Common::Metrics::ScopedTimer timer(s_time);
         if (dsp_lle->m_dsp_core.IsJITCreated())
         {
           dsp_lle->m_dsp_core.RunCycles(cycles);
@@ -117,10 +124,15 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
     return false;
 
   opts->core_type = DSPInitOptions::CoreType::Interpreter;
-#ifdef _M_X86_64
   if (Config::Get(Config::MAIN_DSP_JIT))
-    opts->core_type = DSPInitOptions::CoreType::JIT64;
+  {
+    // Hosts without a DSP JIT get the cached interpreter instead.
+    opts->core_type = DSPInitOptions::CoreType::CachedInterpreter;
+#ifdef _M_X86_64
+    if (!Config::Get(Config::MAIN_DSP_CACHED_INTERPRETER))
+      opts->core_type = DSPInitOptions::CoreType::JIT64;
 #endif
+  }
 
   if (Config::Get(Config::MAIN_DSP_CAPTURE_LOG))
   {
@@ -268,6 +280,7 @@ void DSPLLE::DSP_Update(int cycles)
   if (!m_is_dsp_on_thread)
   {
     // ~1/6th as many cycles as the period PPC-side.
+    Common::Metrics::ScopedTimer timer(s_time);
     m_dsp_core.RunCycles(dsp_cycles);
   }
   else
@@ -15,6 +15,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
+#include "Common/Tracing.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -295,6 +296,7 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
 
 void DVDThread::ProcessReadRequest(ReadRequest&& request)
 {
+  TRACE_SCOPE("DVD", "Read");
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
   std::vector<u8> buffer(request.length);
@@ -183,10 +183,15 @@ void CEXIMemoryCard::SetupGciFolder(const Memcard::HeaderData& header_data)
   const auto [dir_path, migrate] =
       GetGCIFolderPath(m_card_slot, AllowMovieFolder::Yes, m_system.GetMovie());
 
+  // The movie folder has to start out empty, so it never has a base directory.
+  std::string base_dir_path = migrate ? Config::GetPathInBaseUserDirectory(dir_path) : "";
+  if (!base_dir_path.empty() && !File::IsDirectory(base_dir_path))
+    base_dir_path.clear();
+
   const File::FileInfo file_info(dir_path);
   if (!file_info.Exists())
   {
-    if (migrate)  // first use of memcard folder, migrate automatically
+    if (migrate && base_dir_path.empty())  // first use of memcard folder, migrate automatically
       MigrateFromMemcardFile(dir_path + DIR_SEP, m_card_slot, SConfig::GetInstance().m_region);
     else
       File::CreateFullPath(dir_path + DIR_SEP);
@@ -211,13 +216,15 @@ void CEXIMemoryCard::SetupGciFolder(const Memcard::HeaderData& header_data)
     }
   }
 
-  m_memory_card = std::make_unique<GCMemcardDirectory>(dir_path + DIR_SEP, m_card_slot, header_data,
-                                                       current_game_id);
+  m_memory_card = std::make_unique<GCMemcardDirectory>(
+      dir_path + DIR_SEP, m_card_slot, header_data, current_game_id,
+      base_dir_path.empty() ? "" : base_dir_path + DIR_SEP);
 }
 
 void CEXIMemoryCard::SetupRawMemcard(u16 size_mb)
 {
   std::string filename;
+  std::string base_filename;
   auto& movie = m_system.GetMovie();
   if (movie.IsPlayingInput() && movie.IsConfigSaved() && movie.IsUsingMemcard(m_card_slot) &&
       movie.IsStartingFromClearSave())
@@ -228,9 +235,11 @@ void CEXIMemoryCard::SetupRawMemcard(u16 size_mb)
   else
   {
     filename = Config::GetMemcardPath(m_card_slot, SConfig::GetInstance().m_region, size_mb);
+    base_filename = Config::GetPathInBaseUserDirectory(filename);
   }
 
-  m_memory_card = std::make_unique<MemoryCard>(filename, m_card_slot, size_mb);
+  m_memory_card =
+      std::make_unique<MemoryCard>(filename, m_card_slot, size_mb, std::move(base_filename));
 }
 
 CEXIMemoryCard::~CEXIMemoryCard()
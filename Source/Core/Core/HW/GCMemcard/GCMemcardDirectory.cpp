@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstring>
 #include <mutex>
+#include <set>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -178,18 +179,23 @@ std::vector<std::string> GCMemcardDirectory::GetFileNamesForGameID(const std::st
 }
 
 GCMemcardDirectory::GCMemcardDirectory(std::string directory, ExpansionInterface::Slot slot,
-                                       const Memcard::HeaderData& header_data, u32 game_id)
+                                       const Memcard::HeaderData& header_data, u32 game_id,
+                                       std::string base_directory)
     : MemoryCardBase(slot, header_data.m_size_mb), m_game_id(game_id), m_last_block(-1),
       m_hdr(header_data), m_bat1(header_data.m_size_mb), m_saves(0),
-      m_save_directory(std::move(directory)), m_exiting(false)
+      m_save_directory(std::move(directory)), m_base_directory(std::move(base_directory)),
+      m_exiting(false)
 {
   // Use existing header data if available
   {
-    File::IOFile((m_save_directory + MC_HDR), "rb").ReadBytes(&m_hdr, Memcard::BLOCK_SIZE);
+    File::IOFile header_file(m_save_directory + MC_HDR, "rb");
+    if (!header_file && !m_base_directory.empty())
+      header_file.Open(m_base_directory + MC_HDR, "rb");
+    header_file.ReadBytes(&m_hdr, Memcard::BLOCK_SIZE);
   }
 
   const bool current_game_only = Config::Get(Config::SESSION_GCI_FOLDER_CURRENT_GAME_ONLY);
-  const std::vector<std::string> filenames = Common::DoFileSearch(m_save_directory, ".gci");
+  const std::vector<std::string> filenames = FindSaveFiles();
 
   // split up into files for current games we should definitely load,
   // and files for other games that we don't care too much about
@@ -583,6 +589,43 @@ s32 GCMemcardDirectory::DirectoryWrite(u32 dest_address, u32 length, const u8* s
   return length;
 }
 
+std::vector<std::string> GCMemcardDirectory::FindSaveFiles() const
+{
+  std::vector<std::string> filenames = Common::DoFileSearch(m_save_directory, ".gci");
+  if (m_base_directory.empty())
+    return filenames;
+
+  const auto get_file_name = [](const std::string& path) {
+    std::string name;
+    std::string extension;
+    SplitPath(path, nullptr, &name, &extension);
+    return name + extension;
+  };
+
+  std::set<std::string> own_file_names;
+  for (const std::string& filename : filenames)
+    own_file_names.insert(get_file_name(filename));
+
+  // Saves in the base directory are hidden by saves of the same name, and by the backups that are
+  // left behind when saves are deleted.
+  for (std::string& filename : Common::DoFileSearch(m_base_directory, ".gci"))
+  {
+    const std::string file_name = get_file_name(filename);
+    if (!own_file_names.contains(file_name) &&
+        !File::Exists(m_save_directory + file_name + ".deleted"))
+    {
+      filenames.push_back(std::move(filename));
+    }
+  }
+
+  return filenames;
+}
+
+bool GCMemcardDirectory::IsInBaseDirectory(const std::string& filename) const
+{
+  return !m_base_directory.empty() && filename.starts_with(m_base_directory);
+}
+
 bool GCMemcardDirectory::SetUsedBlocks(int save_index)
 {
   Memcard::BlockAlloc* current_bat;
@@ -645,17 +688,27 @@ void GCMemcardDirectory::FlushToFile()
           // Check to see if another file is using the same name
           // This seems unlikely except in the case of file corruption
           // otherwise what user would name another file this way?
-          for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+          const auto is_name_used = [this](const std::string& name) {
+            return File::Exists(name) ||
+                   (!m_base_directory.empty() &&
+                    File::Exists(m_base_directory + name.substr(m_save_directory.size())));
+          };
+          for (int j = 0; is_name_used(default_save_name) && j < 10; ++j)
           {
             default_save_name.insert(default_save_name.end() - 4, '0');
           }
-          if (File::Exists(default_save_name))
+          if (is_name_used(default_save_name))
           {
             PanicAlertFmtT("Failed to find new filename.\n{0}\n will be overwritten",
                            default_save_name);
           }
           save.m_filename = default_save_name;
         }
+        else if (IsInBaseDirectory(save.m_filename))
+        {
+          // Changed saves from the base directory are written to the save directory.
+          save.m_filename = m_save_directory + save.m_filename.substr(m_base_directory.size());
+        }
         File::IOFile gci(save.m_filename, "wb");
         if (gci)
         {
@@ -686,10 +739,20 @@ void GCMemcardDirectory::FlushToFile()
       {
         save.m_dirty = false;
         std::string& old_name = save.m_filename;
-        std::string deleted_name = old_name + ".deleted";
-        if (File::Exists(deleted_name))
-          File::Delete(deleted_name);
-        File::Rename(old_name, deleted_name);
+        if (IsInBaseDirectory(old_name))
+        {
+          // The backup also hides the save in the base directory, which is left as it is.
+          const std::string deleted_name =
+              m_save_directory + old_name.substr(m_base_directory.size()) + ".deleted";
+          File::CopyRegularFile(old_name, deleted_name);
+        }
+        else
+        {
+          std::string deleted_name = old_name + ".deleted";
+          if (File::Exists(deleted_name))
+            File::Delete(deleted_name);
+          File::Rename(old_name, deleted_name);
+        }
         save.m_filename.clear();
         save.m_save_data.clear();
         save.m_used_blocks.clear();
@@ -22,8 +22,12 @@ void MigrateFromMemcardFile(const std::string& directory_name, ExpansionInterfac
 class GCMemcardDirectory : public MemoryCardBase
 {
 public:
+  // Saves in base_directory are also loaded, unless the directory has a save (or a deleted save)
+  // of the same file name. They are written to directory once they change, and never modified in
+  // base_directory.
   GCMemcardDirectory(std::string directory, ExpansionInterface::Slot slot,
-                     const Memcard::HeaderData& header_data, u32 game_id);
+                     const Memcard::HeaderData& header_data, u32 game_id,
+                     std::string base_directory = {});
   ~GCMemcardDirectory() override;
 
   GCMemcardDirectory(const GCMemcardDirectory&) = delete;
@@ -48,6 +52,8 @@ private:
   s32 DirectoryWrite(u32 dest_address, u32 length, const u8* src_address);
   inline void SyncSaves();
   bool SetUsedBlocks(int save_index);
+  std::vector<std::string> FindSaveFiles() const;
+  bool IsInBaseDirectory(const std::string& filename) const;
 
   u32 m_game_id;
   s32 m_last_block;
@@ -61,6 +67,7 @@ private:
   std::vector<Memcard::GCIFile> m_saves;
 
   std::string m_save_directory;
+  std::string m_base_directory;
   Common::Event m_flush_trigger;
   std::mutex m_write_mutex;
   Common::Flag m_exiting;
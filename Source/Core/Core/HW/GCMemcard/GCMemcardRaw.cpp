@@ -35,10 +35,17 @@
 #define SIZE_TO_Mb (1024 * 8 * 16)
 #define MC_HDR_SIZE 0xA000
 
-MemoryCard::MemoryCard(std::string filename, ExpansionInterface::Slot card_slot, u16 size_mbits)
+MemoryCard::MemoryCard(std::string filename, ExpansionInterface::Slot card_slot, u16 size_mbits,
+                       std::string base_filename)
     : MemoryCardBase(card_slot, size_mbits), m_filename(std::move(filename))
 {
   File::IOFile file(m_filename, "rb");
+  if (!file && !base_filename.empty())
+  {
+    file.Open(base_filename, "rb");
+    m_unchanged_from_base = file.IsOpen();
+  }
+
   if (file)
   {
     // Measure size of the existing memcard file.
@@ -47,7 +54,8 @@ MemoryCard::MemoryCard(std::string filename, ExpansionInterface::Slot card_slot,
     m_memcard_data = std::make_unique<u8[]>(m_memory_card_size);
     memset(&m_memcard_data[0], 0xFF, m_memory_card_size);
 
-    INFO_LOG_FMT(EXPANSIONINTERFACE, "Reading memory card {}", m_filename);
+    INFO_LOG_FMT(EXPANSIONINTERFACE, "Reading memory card {}",
+                 m_unchanged_from_base ? base_filename : m_filename);
     file.ReadBytes(&m_memcard_data[0], m_memory_card_size);
   }
   else
@@ -107,11 +115,14 @@ void MemoryCard::FlushThread()
     // If triggered, we're exiting.
     // If timed out, check if we need to flush.
     const bool do_exit = m_flush_trigger.WaitFor(flush_interval);
-    if (!do_exit)
+    if (!do_exit || m_unchanged_from_base)
     {
       const bool is_dirty = m_dirty.TestAndClear();
       if (!is_dirty)
       {
+        // There's no need to write a card read from the base user directory until it changes.
+        if (do_exit)
+          return;
         continue;
       }
     }
@@ -151,6 +162,7 @@ void MemoryCard::FlushThread()
       memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
     }
     file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
+    m_unchanged_from_base = false;
 
     if (do_exit)
       return;
@@ -224,4 +236,6 @@ void MemoryCard::DoState(PointerWrap& p)
   p.Do(m_card_slot);
   p.Do(m_memory_card_size);
   p.DoArray(&m_memcard_data[0], m_memory_card_size);
+  if (p.IsReadMode())
+    MakeDirty();
 }
@@ -17,8 +17,11 @@ class PointerWrap;
 class MemoryCard : public MemoryCardBase
 {
 public:
+  // If the card doesn't exist at filename but does at base_filename, it is read from there, and
+  // only written to filename once it changes. The file at base_filename is never written to.
   MemoryCard(std::string filename, ExpansionInterface::Slot card_slot,
-             u16 size_mbits = Memcard::MBIT_SIZE_MEMORY_CARD_2043);
+             u16 size_mbits = Memcard::MBIT_SIZE_MEMORY_CARD_2043,
+             std::string base_filename = {});
   ~MemoryCard() override;
   void FlushThread();
   void MakeDirty();
@@ -44,4 +47,5 @@ private:
   Common::Event m_flush_trigger;
   Common::Flag m_dirty;
   u32 m_memory_card_size;
+  bool m_unchanged_from_base = false;
 };
@@ -3,6 +3,10 @@
 
 #include "Core/HW/WiimoteCommon/DataReport.h"
 
+#include <memory>
+#include <new>
+#include <type_traits>
+
 #include "Common/Assert.h"
 #include "Common/BitUtils.h"
 
@@ -267,59 +271,55 @@ struct ReportInterleave2 : IncludeCore, IncludeIR<IRReportFormat::Full2, 3, 18,
 #pragma warning(pop)
 #endif
 
-std::unique_ptr<DataReportManipulator> MakeDataReportManipulator(InputReportID rpt_id, u8* data_ptr)
+// Calls create with the type of manipulator for the given report, and returns its result.
+template <typename CreateFunc>
+static DataReportManipulator* CreateDataReportManipulator(InputReportID rpt_id,
+                                                          CreateFunc&& create)
 {
-  std::unique_ptr<DataReportManipulator> ptr;
-
   switch (rpt_id)
   {
   case InputReportID::ReportCore:
     // 0x30: Core Buttons
-    ptr = std::make_unique<ReportCore>();
-    break;
+    return create(std::type_identity<ReportCore>{});
   case InputReportID::ReportCoreAccel:
     // 0x31: Core Buttons and Accelerometer
-    ptr = std::make_unique<ReportCoreAccel>();
-    break;
+    return create(std::type_identity<ReportCoreAccel>{});
   case InputReportID::ReportCoreExt8:
     // 0x32: Core Buttons with 8 Extension bytes
-    ptr = std::make_unique<ReportCoreExt8>();
-    break;
+    return create(std::type_identity<ReportCoreExt8>{});
   case InputReportID::ReportCoreAccelIR12:
     // 0x33: Core Buttons and Accelerometer with 12 IR bytes
-    ptr = std::make_unique<ReportCoreAccelIR12>();
-    break;
+    return create(std::type_identity<ReportCoreAccelIR12>{});
   case InputReportID::ReportCoreExt19:
     // 0x34: Core Buttons with 19 Extension bytes
-    ptr = std::make_unique<ReportCoreExt19>();
-    break;
+    return create(std::type_identity<ReportCoreExt19>{});
   case InputReportID::ReportCoreAccelExt16:
     // 0x35: Core Buttons and Accelerometer with 16 Extension Bytes
-    ptr = std::make_unique<ReportCoreAccelExt16>();
-    break;
+    return create(std::type_identity<ReportCoreAccelExt16>{});
   case InputReportID::ReportCoreIR10Ext9:
     // 0x36: Core Buttons with 10 IR bytes and 9 Extension Bytes
-    ptr = std::make_unique<ReportCoreIR10Ext9>();
-    break;
+    return create(std::type_identity<ReportCoreIR10Ext9>{});
   case InputReportID::ReportCoreAccelIR10Ext6:
     // 0x37: Core Buttons and Accelerometer with 10 IR bytes and 6 Extension Bytes
-    ptr = std::make_unique<ReportCoreAccelIR10Ext6>();
-    break;
+    return create(std::type_identity<ReportCoreAccelIR10Ext6>{});
   case InputReportID::ReportExt21:
     // 0x3d: 21 Extension Bytes
-    ptr = std::make_unique<ReportExt21>();
-    break;
+    return create(std::type_identity<ReportExt21>{});
   case InputReportID::ReportInterleave1:
     // 0x3e - 0x3f: Interleaved Core Buttons and Accelerometer with 36 IR bytes
-    ptr = std::make_unique<ReportInterleave1>();
-    break;
+    return create(std::type_identity<ReportInterleave1>{});
   case InputReportID::ReportInterleave2:
-    ptr = std::make_unique<ReportInterleave2>();
-    break;
+    return create(std::type_identity<ReportInterleave2>{});
   default:
     ASSERT(false);
-    break;
+    return nullptr;
   }
+}
+
+std::unique_ptr<DataReportManipulator> MakeDataReportManipulator(InputReportID rpt_id, u8* data_ptr)
+{
+  std::unique_ptr<DataReportManipulator> ptr(CreateDataReportManipulator(
+      rpt_id, []<typename T>(std::type_identity<T>) -> DataReportManipulator* { return new T; }));
 
   ptr->data_ptr = data_ptr;
   return ptr;
@@ -330,10 +330,25 @@ DataReportBuilder::DataReportBuilder(InputReportID rpt_id) : m_data(rpt_id)
   SetMode(rpt_id);
 }
 
+DataReportBuilder::~DataReportBuilder()
+{
+  if (m_manip)
+    std::destroy_at(m_manip);
+}
+
 void DataReportBuilder::SetMode(InputReportID rpt_id)
 {
+  if (m_manip)
+    std::destroy_at(m_manip);
+
   m_data.report_id = rpt_id;
-  m_manip = MakeDataReportManipulator(rpt_id, GetDataPtr() + sizeof(m_data.report_id));
+  m_manip = CreateDataReportManipulator(
+      rpt_id, [this]<typename T>(std::type_identity<T>) -> DataReportManipulator* {
+        static_assert(sizeof(T) <= sizeof(m_manip_storage));
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        return new (m_manip_storage.data()) T;
+      });
+  m_manip->data_ptr = GetDataPtr() + sizeof(m_data.report_id);
 }
 
 InputReportID DataReportBuilder::GetMode() const
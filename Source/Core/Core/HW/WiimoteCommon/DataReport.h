@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -60,6 +61,10 @@ class DataReportBuilder
 {
 public:
   explicit DataReportBuilder(InputReportID rpt_id);
+  ~DataReportBuilder();
+
+  DataReportBuilder(const DataReportBuilder&) = delete;
+  DataReportBuilder& operator=(const DataReportBuilder&) = delete;
 
   using CoreData = ButtonData;
 
@@ -101,7 +106,10 @@ public:
 private:
   TypedInputData<std::array<u8, MAX_DATA_SIZE>> m_data;
 
-  std::unique_ptr<DataReportManipulator> m_manip;
+  // A report is built for every input update, so the manipulator is constructed in place rather
+  // than allocated.
+  alignas(std::max_align_t) std::array<u8, 8 * sizeof(void*)> m_manip_storage;
+  DataReportManipulator* m_manip = nullptr;
 };
 
 }  // namespace WiimoteCommon
@@ -57,19 +57,21 @@ CameraLogic::GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 fie
   using Common::Vec3;
   using Common::Vec4;
 
-  const std::array<Vec3, 2> leds{
-      Vec3{-SENSOR_BAR_LED_SEPARATION / 2, 0, 0},
-      Vec3{SENSOR_BAR_LED_SEPARATION / 2, 0, 0},
-  };
-
-  const auto camera_view =
+  // The LEDs are symmetric around the center of the sensor bar, so only the center and the offset
+  // to the LEDs have to go through the transformation. This avoids building the full camera view
+  // matrix on every update.
+  const Vec3 center = transform.Transform(Vec3{}, 1);
+  const Vec3 offset = transform.Transform(Vec3{SENSOR_BAR_LED_SEPARATION / 2, 0, 0}, 0);
+  const std::array<Vec3, 2> leds{center - offset, center + offset};
+
+  const auto projection =
       Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
-      Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4))) * transform;
+      Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4)));
 
   std::array<CameraPoint, CameraLogic::NUM_POINTS> camera_points;
 
   std::ranges::transform(leds, camera_points.begin(), [&](const Vec3& v) {
-    const auto point = camera_view * Vec4(v, 1.0);
+    const auto point = projection * Vec4(v, 1.0);
 
     // Check if LED is behind camera.
     if (point.z < 0)
@@ -404,8 +404,20 @@ Common::Quaternion GetRotationFromGyroscope(const Common::Vec3& gyro)
 
 Common::Matrix33 GetRotationalMatrix(const Common::Vec3& angle)
 {
-  return Common::Matrix33::RotateZ(angle.z) * Common::Matrix33::RotateY(angle.y) *
-         Common::Matrix33::RotateX(angle.x);
+  // RotateZ(z) * RotateY(y) * RotateX(x), multiplied out.
+  // This is used several times per Wii Remote and extension on every update.
+  const float sx = std::sin(angle.x);
+  const float cx = std::cos(angle.x);
+  const float sy = std::sin(angle.y);
+  const float cy = std::cos(angle.y);
+  const float sz = std::sin(angle.z);
+  const float cz = std::cos(angle.z);
+
+  return {
+      cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx,
+      sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx,
+      -sy,     cy * sx,                cy * cx,
+  };
 }
 
 float GetPitch(const Common::Quaternion& world_rotation)
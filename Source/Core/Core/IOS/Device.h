@@ -207,7 +207,13 @@ public:
   {
     return Unsupported(ioctlv);
   }
+  // Called on every update tick for polled devices, and on the first update tick after the device
+  // was woken up with EmulationKernel::WakeDevice for other devices. Devices are only updated
+  // while they are open.
   virtual void Update() {}
+  // Devices which can't tell when they have work to do, e.g. because they check host input, must
+  // be updated on every tick.
+  virtual bool IsPolled() const { return false; }
   virtual void UpdateWantDeterminism(bool new_want_determinism) {}
   virtual DeviceType GetDeviceType() const { return m_device_type; }
   virtual bool IsOpened() const { return m_is_active; }
@@ -9,6 +9,7 @@
 
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/FS/HostBackend/FS.h"
 
@@ -43,9 +44,16 @@ SplitPathResult SplitPathAndBasename(std::string_view path)
 std::unique_ptr<FileSystem> MakeFileSystem(Location location,
                                            std::vector<NandRedirect> nand_redirects)
 {
-  const std::string nand_root =
-      File::GetUserPath(location == Location::Session ? D_SESSION_WIIROOT_IDX : D_WIIROOT_IDX);
-  return std::make_unique<HostFileSystem>(nand_root, std::move(nand_redirects));
+  if (location == Location::Session)
+  {
+    return std::make_unique<HostFileSystem>(File::GetUserPath(D_SESSION_WIIROOT_IDX),
+                                            std::move(nand_redirects));
+  }
+
+  // Temporary NANDs are filled from scratch, so only the configured one can have a base NAND.
+  const std::string nand_root = File::GetUserPath(D_WIIROOT_IDX);
+  return std::make_unique<HostFileSystem>(nand_root, std::move(nand_redirects),
+                                          Config::GetPathInBaseUserDirectory(nand_root));
 }
 
 IOS::HLE::ReturnCode ConvertResult(ResultCode code)
@@ -51,6 +51,147 @@ HostFileSystem::HostFilename HostFileSystem::BuildFilename(const std::string& wi
   return HostFilename{m_root_path, false};
 }
 
+HostFileSystem::HostFilename HostFileSystem::ResolveFilename(const std::string& wii_path) const
+{
+  HostFilename host_file = BuildFilename(wii_path);
+  if (m_base_root_path.empty() || host_file.is_redirect || !wii_path.starts_with('/') ||
+      File::Exists(host_file.host_path) || IsHiddenInBase(wii_path))
+  {
+    return host_file;
+  }
+
+  std::string base_path = m_base_root_path + Common::EscapePath(wii_path);
+  if (!File::Exists(base_path))
+    return host_file;
+
+  return HostFilename{std::move(base_path), false, true};
+}
+
+bool HostFileSystem::IsHiddenInBase(const std::string& wii_path) const
+{
+  if (m_hidden_base_paths.empty())
+    return false;
+
+  // Deleting a directory also hides everything inside of it.
+  std::string_view path = wii_path;
+  while (!m_hidden_base_paths.contains(path))
+  {
+    if (path.size() <= 1)
+      return false;
+    path = path.substr(0, std::max<size_t>(path.rfind('/'), 1));
+  }
+  return true;
+}
+
+void HostFileSystem::HideInBase(const std::string& wii_path)
+{
+  if (m_base_root_path.empty() || BuildFilename(wii_path).is_redirect ||
+      IsHiddenInBase(wii_path) || !File::Exists(m_base_root_path + Common::EscapePath(wii_path)))
+  {
+    return;
+  }
+
+  m_hidden_base_paths.emplace(wii_path);
+  SaveHiddenBasePaths();
+}
+
+bool HostFileSystem::CopyToOverlay(const std::string& wii_path)
+{
+  const HostFilename host_file = ResolveFilename(wii_path);
+  if (!host_file.is_in_base)
+    return true;
+
+  const std::string overlay_path = BuildFilename(wii_path).host_path;
+  if (File::IsDirectory(host_file.host_path))
+    return File::CreateFullPath(overlay_path + '/');
+
+  INFO_LOG_FMT(IOS_FS, "Copying {} from the base NAND", wii_path);
+  return File::CreateFullPath(overlay_path) &&
+         File::CopyRegularFile(host_file.host_path, overlay_path);
+}
+
+bool HostFileSystem::CopyTreeToOverlay(const std::string& wii_path)
+{
+  if (!CopyToOverlay(wii_path))
+    return false;
+
+  const std::string host_path = BuildFilename(wii_path).host_path;
+  if (m_base_root_path.empty() || !File::IsDirectory(host_path))
+    return true;
+
+  // Entries from the overlay can start with the base path too, if it is a prefix of the root.
+  const std::string base_prefix = m_base_root_path + '/';
+  const auto copy_children = [&](const auto& copy, const File::FSTEntry& entry) -> bool {
+    for (const File::FSTEntry& child : entry.children)
+    {
+      if (child.physicalName.starts_with(base_prefix))
+      {
+        const std::string overlay_path =
+            m_root_path + child.physicalName.substr(m_base_root_path.size());
+        const bool copied = child.isDirectory ?
+                                File::CreateDir(overlay_path) :
+                                File::CopyRegularFile(child.physicalName, overlay_path);
+        if (!copied)
+          return false;
+      }
+      if (child.isDirectory && !copy(copy, child))
+        return false;
+    }
+    return true;
+  };
+  return copy_children(copy_children, ScanDirectory(wii_path, true));
+}
+
+File::FSTEntry HostFileSystem::ScanDirectory(const std::string& wii_path, bool recursive) const
+{
+  const HostFilename host_file = BuildFilename(wii_path);
+  File::FSTEntry entry = File::ScanDirectoryTree(host_file.host_path, recursive);
+  if (!m_base_root_path.empty() && !host_file.is_redirect)
+    MergeBaseDirectory(&entry, wii_path, recursive);
+  return entry;
+}
+
+void HostFileSystem::MergeBaseDirectory(File::FSTEntry* entry, const std::string& wii_path,
+                                        bool recursive) const
+{
+  if (IsHiddenInBase(wii_path))
+    return;
+
+  const std::string parent_path = wii_path == "/" ? "" : wii_path;
+  File::FSTEntry base_entry =
+      File::ScanDirectoryTree(m_base_root_path + Common::EscapePath(wii_path), false);
+  for (File::FSTEntry& base_child : base_entry.children)
+  {
+    const std::string child_path =
+        parent_path + '/' + Common::UnescapeFileName(base_child.virtualName);
+    const auto it = std::ranges::find(entry->children, base_child.virtualName,
+                                      &File::FSTEntry::virtualName);
+    if (it != entry->children.end())
+    {
+      // Directories which exist in both are merged, but files in the overlay replace those in the
+      // base NAND.
+      if (recursive && it->isDirectory && base_child.isDirectory)
+        MergeBaseDirectory(&*it, child_path, true);
+      continue;
+    }
+
+    if (IsHiddenInBase(child_path))
+      continue;
+
+    if (recursive && base_child.isDirectory)
+      MergeBaseDirectory(&base_child, child_path, true);
+    entry->children.push_back(std::move(base_child));
+  }
+
+  // For directories, the size is the number of entries inside of it.
+  entry->size = entry->children.size();
+  for (const File::FSTEntry& child : entry->children)
+  {
+    if (child.isDirectory)
+      entry->size += child.size;
+  }
+}
+
 namespace
 {
 struct SerializedFstEntry
@@ -140,14 +281,22 @@ bool HostFileSystem::FstEntry::CheckPermission(Uid caller_uid, Gid caller_gid,
   return (u8(requested_mode) & u8(file_mode)) == u8(requested_mode);
 }
 
-HostFileSystem::HostFileSystem(std::string root_path, std::vector<NandRedirect> nand_redirects)
-    : m_root_path{std::move(root_path)}, m_nand_redirects(std::move(nand_redirects))
+HostFileSystem::HostFileSystem(std::string root_path, std::vector<NandRedirect> nand_redirects,
+                               std::string base_root_path)
+    : m_root_path{std::move(root_path)}, m_base_root_path{std::move(base_root_path)},
+      m_nand_redirects(std::move(nand_redirects))
 {
   while (m_root_path.ends_with('/'))
     m_root_path.pop_back();
+  while (m_base_root_path.ends_with('/'))
+    m_base_root_path.pop_back();
+  if (!m_base_root_path.empty() && !File::IsDirectory(m_base_root_path))
+    m_base_root_path.clear();
+
   File::CreateFullPath(m_root_path + '/');
   ResetFst();
   LoadFst();
+  LoadHiddenBasePaths();
 }
 
 HostFileSystem::~HostFileSystem() = default;
@@ -165,9 +314,46 @@ void HostFileSystem::ResetFst()
   m_root_entry.data.modes = {Mode::None, Mode::Read, Mode::Read};
 }
 
+std::string HostFileSystem::GetHiddenBasePathsFilePath() const
+{
+  return fmt::format("{}/hidden_base_paths.txt", m_root_path);
+}
+
+void HostFileSystem::LoadHiddenBasePaths()
+{
+  m_hidden_base_paths.clear();
+  if (m_base_root_path.empty())
+    return;
+
+  std::string contents;
+  if (!File::ReadFileToString(GetHiddenBasePathsFilePath(), contents))
+    return;
+
+  for (std::string& path : SplitString(contents, '\n'))
+  {
+    if (IsValidPath(path))
+      m_hidden_base_paths.emplace(std::move(path));
+  }
+}
+
+void HostFileSystem::SaveHiddenBasePaths()
+{
+  std::string contents;
+  for (const std::string& path : m_hidden_base_paths)
+    contents += path + '\n';
+
+  const std::string dest_path = GetHiddenBasePathsFilePath();
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(dest_path);
+  if (!File::WriteStringToFile(temp_path, contents) || !File::Rename(temp_path, dest_path))
+    PanicAlertFmt("IOS_FS: Failed to write the deleted paths of the base NAND");
+}
+
 void HostFileSystem::LoadFst()
 {
   File::IOFile file{GetFstFilePath(), "rb"};
+  // The overlay only gets its own FST once something has changed.
+  if (!file && !m_base_root_path.empty())
+    file.Open(fmt::format("{}/fst.bin", m_base_root_path), "rb");
   // Existing filesystems will not have a FST. This is not a problem,
   // as the rest of HostFileSystem will use sane defaults.
   if (!file)
@@ -239,7 +425,7 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
   if (!IsValidNonRootPath(path))
     return nullptr;
 
-  auto host_file = BuildFilename(path);
+  auto host_file = ResolveFilename(path);
   const File::FileInfo host_file_info{host_file.host_path};
   if (!host_file_info.Exists())
     return nullptr;
@@ -352,7 +538,7 @@ void HostFileSystem::DoState(PointerWrap& p)
     p.Do(handle.wii_path);
     p.Do(handle.file_offset);
     if (handle.opened)
-      handle.host_file = OpenHostFile(BuildFilename(handle.wii_path).host_path);
+      handle.host_file = OpenHostFileForHandle(handle.wii_path, handle.mode);
   }
 }
 
@@ -367,6 +553,8 @@ ResultCode HostFileSystem::Format(Uid uid)
     return ResultCode::UnknownError;
   ResetFst();
   SaveFst();
+  m_hidden_base_paths.clear();
+  HideInBase("/");
   // Reset and close all handles.
   m_handles = {};
   return ResultCode::Success;
@@ -393,9 +581,15 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   if (!parent->CheckPermission(uid, gid, Mode::Write))
     return ResultCode::AccessDenied;
 
-  if (File::Exists(host_path))
+  if (File::Exists(ResolveFilename(path).host_path))
     return ResultCode::AlreadyExists;
 
+  if (!CopyToOverlay(split_path.parent))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to copy {} from the base NAND", split_path.parent);
+    return ResultCode::UnknownError;
+  }
+
   const bool ok = is_file ? File::CreateEmptyFile(host_path) : File::CreateDir(host_path);
   if (!ok)
   {
@@ -446,7 +640,8 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   if (!IsValidNonRootPath(path))
     return ResultCode::Invalid;
 
-  const std::string host_path = BuildFilename(path).host_path;
+  const HostFilename host_file = ResolveFilename(path);
+  const std::string& host_path = host_file.host_path;
   const auto split_path = SplitPathAndBasename(path);
 
   FstEntry* parent = GetFstEntryForPath(split_path.parent);
@@ -460,11 +655,20 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
     return ResultCode::NotFound;
 
   if (File::IsFile(host_path) && !IsFileOpened(path))
-    File::Delete(host_path);
+  {
+    if (!host_file.is_in_base)
+      File::Delete(host_path);
+  }
   else if (File::IsDirectory(host_path) && !IsDirectoryInUse(path))
-    File::DeleteDirRecursively(host_path);
+  {
+    if (!host_file.is_in_base)
+      File::DeleteDirRecursively(host_path);
+  }
   else
+  {
     return ResultCode::InUse;
+  }
+  HideInBase(path);
 
   const auto it = std::ranges::find(parent->children, split_path.file_name, &FstEntry::name);
   if (it != parent->children.end())
@@ -513,17 +717,26 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
   const std::string& host_old_path = host_old_info.host_path;
   const std::string& host_new_path = host_new_info.host_path;
 
+  // Only the overlay can be changed, so anything from the base NAND has to be copied to it first.
+  if (!CopyTreeToOverlay(old_path) || !CopyToOverlay(split_new_path.parent))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to copy {} from the base NAND", old_path);
+    return ResultCode::UnknownError;
+  }
+
   // If there is already something of the same type at the new path, delete it.
-  if (File::Exists(host_new_path))
+  const auto existing_new_info = ResolveFilename(new_path);
+  if (File::Exists(existing_new_info.host_path))
   {
     const bool old_is_file = File::IsFile(host_old_path);
-    const bool new_is_file = File::IsFile(host_new_path);
-    if (old_is_file && new_is_file)
+    const bool new_is_file = File::IsFile(existing_new_info.host_path);
+    if (old_is_file != new_is_file)
+      return ResultCode::Invalid;
+    if (!existing_new_info.is_in_base && new_is_file)
       File::Delete(host_new_path);
-    else if (!old_is_file && !new_is_file)
+    else if (!existing_new_info.is_in_base)
       File::DeleteDirRecursively(host_new_path);
-    else
-      return ResultCode::Invalid;
+    HideInBase(new_path);
   }
 
   if (!File::Rename(host_old_path, host_new_path))
@@ -550,6 +763,7 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
       return ResultCode::NotFound;
     }
   }
+  HideInBase(old_path);
 
   FstEntry* new_entry = GetFstEntryForPath(new_path);
   new_entry->name = split_new_path.file_name;
@@ -586,8 +800,7 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid uid, Gid gid,
   if (entry->data.is_file)
     return std::unexpected{ResultCode::Invalid};
 
-  const std::string host_path = BuildFilename(path).host_path;
-  File::FSTEntry host_entry = File::ScanDirectoryTree(host_path, false);
+  File::FSTEntry host_entry = ScanDirectory(path, false);
   FixupDirectoryEntries(&host_entry, path == "/");
 
   // Sort files according to their order in the FST tree (issue 10234).
@@ -649,7 +862,7 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid uid, Gid gid, const std::string
     return std::unexpected{ResultCode::NotFound};
 
   Metadata metadata = entry->data;
-  metadata.size = File::GetSize(BuildFilename(path).host_path);
+  metadata.size = File::GetSize(ResolveFilename(path).host_path);
   return metadata;
 }
 
@@ -668,7 +881,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
   if (caller_uid != 0 && uid != entry->data.uid)
     return ResultCode::AccessDenied;
 
-  const bool is_empty = File::GetSize(BuildFilename(path).host_path) == 0;
+  const bool is_empty = File::GetSize(ResolveFilename(path).host_path) == 0;
   if (entry->data.uid != uid && entry->data.is_file && !is_empty)
     return ResultCode::FileNotEmpty;
 
@@ -735,15 +948,14 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
     return std::unexpected{ResultCode::Invalid};
 
   ExtendedDirectoryStats stats{};
-  std::string path(BuildFilename(wii_path).host_path);
-  File::FileInfo info(path);
+  File::FileInfo info(ResolveFilename(wii_path).host_path);
   if (!info.Exists())
   {
     return std::unexpected{ResultCode::NotFound};
   }
   if (info.IsDirectory())
   {
-    File::FSTEntry parent_dir = File::ScanDirectoryTree(path, true);
+    File::FSTEntry parent_dir = ScanDirectory(wii_path, true);
     FixupDirectoryEntries(&parent_dir, wii_path == "/");
 
     // add one for the folder itself
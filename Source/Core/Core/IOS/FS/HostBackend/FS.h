@@ -6,10 +6,12 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Core/IOS/FS/FileSystem.h"
 
@@ -19,10 +21,17 @@ namespace IOS::HLE::FS
 ///
 /// Ignores metadata like permissions, attributes and various checks and also
 /// sometimes returns wrong information because metadata is not available.
+///
+/// If a base root path is given, the NAND at the root path is an overlay over the base NAND:
+/// anything that does not exist in the overlay is read from the base NAND, but all changes are
+/// made to the overlay. Files are copied to the overlay when they are first opened for writing,
+/// and files and directories deleted from the base NAND are only hidden. The base NAND is never
+/// modified, so it can be shared by any number of overlays.
 class HostFileSystem final : public FileSystem
 {
 public:
-  HostFileSystem(std::string root_path, std::vector<NandRedirect> nand_redirects = {});
+  HostFileSystem(std::string root_path, std::vector<NandRedirect> nand_redirects = {},
+                 std::string base_root_path = {});
   ~HostFileSystem() override;
 
   void DoState(PointerWrap& p) override;
@@ -89,9 +98,29 @@ private:
   {
     std::string host_path;
     bool is_redirect;
+    bool is_in_base = false;
   };
+  /// Where a file or directory is on the host, or would be if it was created.
   HostFilename BuildFilename(const std::string& wii_path) const;
-  std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
+  /// Like BuildFilename, but returns the path in the base NAND for anything that only exists
+  /// there. This is where the current contents of a file or directory are read from.
+  HostFilename ResolveFilename(const std::string& wii_path) const;
+  std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path, bool read_only = false);
+  /// Opens the host file for a new handle to a file. Files in the base NAND are copied to the
+  /// overlay first if the handle can write to them.
+  std::shared_ptr<File::IOFile> OpenHostFileForHandle(const std::string& wii_path, Mode mode);
+
+  bool IsHiddenInBase(const std::string& wii_path) const;
+  void HideInBase(const std::string& wii_path);
+  /// Copies a file from the base NAND to the overlay so that it can be modified. Directories are
+  /// created empty, as their contents are still merged from the base NAND.
+  bool CopyToOverlay(const std::string& wii_path);
+  /// Like CopyToOverlay, but also copies everything inside of a directory.
+  bool CopyTreeToOverlay(const std::string& wii_path);
+  /// Lists the contents of a directory, including the contents in the base NAND.
+  File::FSTEntry ScanDirectory(const std::string& wii_path, bool recursive) const;
+  void MergeBaseDirectory(File::FSTEntry* entry, const std::string& wii_path,
+                          bool recursive) const;
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
                                    FileAttribute attribute, Modes modes, bool is_file);
@@ -99,6 +128,9 @@ private:
   bool IsDirectoryInUse(const std::string& path) const;
 
   std::string GetFstFilePath() const;
+  std::string GetHiddenBasePathsFilePath() const;
+  void LoadHiddenBasePaths();
+  void SaveHiddenBasePaths();
   void ResetFst();
   void LoadFst();
   void SaveFst();
@@ -117,6 +149,9 @@ private:
   /// filesystem root manually.
   FstEntry m_root_entry{};
   std::string m_root_path;
+  std::string m_base_root_path;
+  /// Paths whose contents in the base NAND have been deleted.
+  std::set<std::string, std::less<>> m_hidden_base_paths;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
 
@@ -15,7 +15,8 @@
 namespace IOS::HLE::FS
 {
 // This isn't theadsafe, but it's only called from the CPU thread.
-std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path)
+std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path,
+                                                           bool read_only)
 {
   // On the wii, all file operations are strongly ordered.
   // If a game opens the same file twice (or 8 times, looking at you PokePark Wii)
@@ -42,9 +43,10 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   }
 
   // All files are opened read/write. Actual access rights will be controlled per handle by the
-  // read/write functions below
+  // read/write functions below. The exception are files in the base NAND, which must never be
+  // written to and are copied to the overlay before a handle which can write is opened.
   File::IOFile file;
-  while (!file.Open(host_path, "r+b"))
+  while (!file.Open(host_path, read_only ? "rb" : "r+b"))
   {
     const bool try_again =
         PanicYesNoFmt("File \"{}\" could not be opened!\n"
@@ -75,13 +77,41 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   return file_ptr;
 }
 
+std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFileForHandle(const std::string& wii_path,
+                                                                    Mode mode)
+{
+  const HostFilename host_file = ResolveFilename(wii_path);
+  if (!host_file.is_in_base || (u8(mode) & u8(Mode::Write)) == 0)
+    return OpenHostFile(host_file.host_path, host_file.is_in_base);
+
+  if (!CopyToOverlay(wii_path))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to copy {} from the base NAND", wii_path);
+    return nullptr;
+  }
+
+  // Handles which were opened for reading before still use the file in the base NAND. Switch them
+  // to the copy, so that all handles to the file see each other's writes (see OpenHostFile).
+  std::shared_ptr<File::IOFile> file = OpenHostFile(BuildFilename(wii_path).host_path);
+  if (file)
+  {
+    for (Handle& handle : m_handles)
+    {
+      if (handle.opened && handle.host_file && handle.wii_path == wii_path)
+        handle.host_file = file;
+    }
+  }
+  return file;
+}
+
 Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
 {
   Handle* handle = AssignFreeHandle();
   if (!handle)
     return std::unexpected{ResultCode::NoFreeHandle};
 
-  const std::string host_path = BuildFilename(path).host_path;
+  const HostFilename host_file = ResolveFilename(path);
+  const std::string& host_path = host_file.host_path;
   if (File::IsDirectory(host_path))
   {
     *handle = Handle{};
@@ -94,7 +124,7 @@ Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, M
     return std::unexpected{ResultCode::NotFound};
   }
 
-  handle->host_file = OpenHostFile(host_path);
+  handle->host_file = OpenHostFileForHandle(path, mode);
   if (!handle->host_file)
   {
     *handle = Handle{};
@@ -543,6 +543,13 @@ void EmulationKernel::InitIPC()
 void EmulationKernel::AddDevice(std::unique_ptr<Device> device)
 {
   ASSERT(device->GetDeviceType() == Device::DeviceType::Static);
+  if (device->IsPolled())
+  {
+    // Keep the same order as the device map.
+    const auto position = std::ranges::upper_bound(m_polled_devices, device->GetDeviceName(), {},
+                                                   &Device::GetDeviceName);
+    m_polled_devices.insert(position, device.get());
+  }
   m_device_map.insert_or_assign(device->GetDeviceName(), std::move(device));
 }
 
@@ -705,6 +712,10 @@ std::optional<IPCReply> EmulationKernel::OpenDevice(OpenRequest& request)
     m_fdmap[new_fd] = device;
     result->return_value = new_fd;
   }
+
+  // Devices aren't updated while they are closed, so they may have work left over.
+  if (device->GetDeviceType() == Device::DeviceType::Static && device->IsOpened())
+    WakeDevice(*device);
   return result;
 }
 
@@ -845,16 +856,46 @@ void EmulationKernel::UpdateIPC()
 
 void EmulationKernel::UpdateDevices()
 {
-  // Check if a hardware device must be updated
-  for (const auto& entry : m_device_map)
+  if (!m_has_woken_devices.load(std::memory_order_acquire))
   {
-    if (entry.second->IsOpened())
+    for (Device* device : m_polled_devices)
     {
-      entry.second->Update();
+      if (device->IsOpened())
+        device->Update();
     }
+    return;
+  }
+
+  m_devices_to_update = m_polled_devices;
+  {
+    std::lock_guard guard(m_woken_devices_lock);
+    m_devices_to_update.insert(m_devices_to_update.end(), m_woken_devices.begin(),
+                               m_woken_devices.end());
+    m_woken_devices.clear();
+    m_has_woken_devices.store(false, std::memory_order_relaxed);
+  }
+
+  // Update the devices in the same order as the device map, as the order in which they reply to
+  // requests is visible to the emulated software.
+  std::ranges::sort(m_devices_to_update, {}, &Device::GetDeviceName);
+  const auto duplicates = std::ranges::unique(m_devices_to_update);
+  m_devices_to_update.erase(duplicates.begin(), duplicates.end());
+
+  for (Device* device : m_devices_to_update)
+  {
+    if (device->IsOpened())
+      device->Update();
   }
 }
 
+void EmulationKernel::WakeDevice(Device& device)
+{
+  std::lock_guard guard(m_woken_devices_lock);
+  if (std::ranges::find(m_woken_devices, &device) == m_woken_devices.end())
+    m_woken_devices.push_back(&device);
+  m_has_woken_devices.store(true, std::memory_order_release);
+}
+
 void EmulationKernel::UpdateWantDeterminism(const bool new_want_determinism)
 {
   if (m_socket_manager)
@@ -887,6 +928,10 @@ void EmulationKernel::DoState(PointerWrap& p)
 
   if (p.IsReadMode())
   {
+    // The loaded state may have left any device with work to do.
+    for (const auto& entry : m_device_map)
+      WakeDevice(*entry.second);
+
     for (u32 i = 0; i < IPC_MAX_FDS; i++)
     {
       u32 exists = 0;
@@ -4,12 +4,15 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/CoreTiming.h"
@@ -166,6 +169,9 @@ public:
   void UpdateDevices();
   void UpdateWantDeterminism(bool new_want_determinism);
 
+  // Makes the device be updated on the next update tick. This can be called from any thread.
+  void WakeDevice(Device& device);
+
   std::shared_ptr<WiiSockMan> GetSocketManager();
 
   void HandleIPCEvent(u64 userdata);
@@ -201,6 +207,12 @@ private:
 
   static constexpr u8 IPC_MAX_FDS = 0x18;
   std::map<std::string, std::shared_ptr<Device>, std::less<>> m_device_map;
+  // Devices which are updated on every tick, and devices which were woken up since the last tick.
+  std::vector<Device*> m_polled_devices;
+  std::mutex m_woken_devices_lock;
+  std::vector<Device*> m_woken_devices;
+  std::atomic_bool m_has_woken_devices = false;
+  std::vector<Device*> m_devices_to_update;
   // TODO: make this fdmap per process.
   std::array<std::shared_ptr<Device>, IPC_MAX_FDS> m_fdmap;
 
@@ -24,6 +24,7 @@
 #include "Common/IOFile.h"
 #include "Common/ScopeGuard.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/ES/Formats.h"
 
@@ -626,7 +627,14 @@ void IOSC::LoadDefaultEntries()
 
 void IOSC::LoadEntries()
 {
-  File::IOFile file{File::GetUserPath(D_WIIROOT_IDX) + "keys.bin", "rb"};
+  const std::string keys_path = File::GetUserPath(D_WIIROOT_IDX) + "keys.bin";
+  File::IOFile file{keys_path, "rb"};
+  if (!file)
+  {
+    const std::string base_keys_path = Config::GetPathInBaseUserDirectory(keys_path);
+    if (!base_keys_path.empty())
+      file.Open(base_keys_path, "rb");
+  }
   if (!file)
   {
     WARN_LOG_FMT(IOS, "keys.bin could not be found. Default values will be used.");
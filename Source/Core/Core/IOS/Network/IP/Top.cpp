@@ -96,6 +96,7 @@ NetIPTopDevice::NetIPTopDevice(EmulationKernel& ios, const std::string& device_n
       std::lock_guard lg(m_async_reply_lock);
       m_async_replies.emplace(AsyncReply{task.request, reply.return_value});
     }
+    GetEmulationKernel().WakeDevice(*this);
   });
 }
 
@@ -565,7 +566,11 @@ void NetIPTopDevice::Update()
       m_async_replies.pop();
     }
   }
-  GetEmulationKernel().GetSocketManager()->Update();
+
+  const auto socket_manager = GetEmulationKernel().GetSocketManager();
+  socket_manager->Update();
+  if (socket_manager->HasPendingWork())
+    GetEmulationKernel().WakeDevice(*this);
 }
 
 IPCReply NetIPTopDevice::HandleInitInterfaceRequest(const IOCtlRequest& request)
@@ -165,6 +165,7 @@ NetKDRequestDevice::NetKDRequestDevice(EmulationKernel& ios, const std::string&
       std::lock_guard lg(m_async_reply_lock);
       m_async_replies.emplace(AsyncReply{task.request, reply.return_value});
     }
+    GetEmulationKernel().WakeDevice(*this);
   });
 
   m_handle_mail = !ios.GetIOSC().IsUsingDefaultId() && !m_send_list.IsDisabled();
@@ -5,6 +5,7 @@
 #include "Core/IOS/Network/Socket.h"
 
 #include <algorithm>
+#include <array>
 #include <numeric>
 
 #include <mbedtls/error.h>
@@ -15,7 +16,11 @@
 #ifdef __HAIKU__
 #include <sys/select.h>
 #endif
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 
+#include "Common/CommonFuncs.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Network.h"
@@ -87,9 +92,24 @@ static s32 TranslateErrorCode(s32 native_error, bool is_rw)
 
 WiiSockMan::WiiSockMan(EmulationKernel& ios) : m_ios(ios)
 {
+#ifdef __linux__
+  m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (m_epoll_fd < 0)
+  {
+    ERROR_LOG_FMT(IOS_NET, "Failed to create epoll instance, polling all sockets instead: {}",
+                  Common::LastStrerrorString());
+  }
+#endif
 }
 
-WiiSockMan::~WiiSockMan() = default;
+WiiSockMan::~WiiSockMan()
+{
+  Clean();
+#ifdef __linux__
+  if (m_epoll_fd >= 0)
+    close(m_epoll_fd);
+#endif
+}
 
 // Don't use string! (see https://github.com/dolphin-emu/dolphin/pull/3143)
 s32 WiiSockMan::GetNetErrorCode(s32 ret, std::string_view caller, bool is_rw)
@@ -208,6 +228,7 @@ s32 WiiSocket::Shutdown(u32 how)
       break;
     }
   }
+  needs_update = true;
   return ret;
 }
 
@@ -216,6 +237,7 @@ s32 WiiSocket::CloseFd()
   s32 ReturnValue = 0;
   if (fd >= 0)
   {
+    m_socket_manager.UnwatchSocket(*this);
     s32 ret = closesocket(fd);
     ReturnValue = m_socket_manager.GetNetErrorCode(ret, "CloseFd", false);
   }
@@ -262,7 +284,21 @@ s32 WiiSocket::FCntl(u32 cmd, u32 arg)
   return ret;
 }
 
-void WiiSocket::Update(bool read, bool write, bool except)
+bool WiiSocket::NeedsUpdate() const
+{
+  if (pending_sockops.empty())
+    return false;
+  if (needs_update || !m_socket_manager.IsWatchingSockets())
+    return true;
+
+  // SSL contexts can hold data which was already read from the socket, and blocking connects have
+  // to time out, so neither can wait for a socket event.
+  return std::ranges::any_of(pending_sockops, [](const sockop& op) {
+    return op.is_ssl || op.net_type == IOCTL_SO_CONNECT;
+  });
+}
+
+void WiiSocket::Update()
 {
   auto& system = m_socket_manager.m_ios.GetSystem();
   auto& memory = system.GetMemory();
@@ -857,6 +893,7 @@ void WiiSocket::DoSock(const Request& request, NET_IOCTL type)
   sockop so = {request, false};
   so.net_type = type;
   pending_sockops.push_back(so);
+  needs_update = true;
 }
 
 void WiiSocket::DoSock(const Request& request, SSL_IOCTL type)
@@ -864,6 +901,7 @@ void WiiSocket::DoSock(const Request& request, SSL_IOCTL type)
   sockop so = {request, true};
   so.ssl_type = type;
   pending_sockops.push_back(so);
+  needs_update = true;
 }
 
 s32 WiiSockMan::AddSocket(s32 fd, bool is_rw)
@@ -893,6 +931,7 @@ s32 WiiSockMan::AddSocket(s32 fd, bool is_rw)
     WiiSocket& sock = WiiSockets.emplace(wii_fd, *this).first->second;
     sock.SetFd(fd);
     sock.SetWiiFd(wii_fd);
+    WatchSocket(sock);
     m_ios.GetSystem().GetPowerPC().GetDebugInterface().NetworkLogger()->OnNewSocket(fd);
 
     Common::SetPlatformSocketOptions(fd);
@@ -970,9 +1009,12 @@ s32 WiiSockMan::GetHostSocket(s32 wii_fd) const
 s32 WiiSockMan::ShutdownSocket(s32 wii_fd, u32 how)
 {
   auto socket_entry = WiiSockets.find(wii_fd);
-  if (socket_entry != WiiSockets.end())
-    return socket_entry->second.Shutdown(how);
-  return -SO_EBADF;
+  if (socket_entry == WiiSockets.end())
+    return -SO_EBADF;
+
+  const s32 result = socket_entry->second.Shutdown(how);
+  WakeUpdateDevice();
+  return result;
 }
 
 s32 WiiSockMan::DeleteSocket(s32 wii_fd)
@@ -992,57 +1034,101 @@ void WiiSockMan::EnqueueIPCReply(const Request& request, s32 return_value) const
   m_ios.EnqueueIPCReply(request, return_value);
 }
 
-void WiiSockMan::Update()
+void WiiSockMan::WakeUpdateDevice()
 {
-  s32 nfds = 0;
-  fd_set read_fds, write_fds, except_fds;
-  timeval t = {0, 0};
-  FD_ZERO(&read_fds);
-  FD_ZERO(&write_fds);
-  FD_ZERO(&except_fds);
+  // Sockets are updated by /dev/net/ip/top, even when the operations come from another device.
+  if (const auto device = m_ios.GetDeviceByName("/dev/net/ip/top"))
+    m_ios.WakeDevice(*device);
+}
 
-  auto socket_iter = WiiSockets.begin();
-  auto end_socks = WiiSockets.end();
+void WiiSockMan::WatchSocket(const WiiSocket& socket)
+{
+  ++m_event_generation;
+#ifdef __linux__
+  if (m_epoll_fd < 0)
+    return;
 
-  while (socket_iter != end_socks)
+  // Edge-triggered, as pending operations are attempted until they would block, and are only
+  // worth retrying once the socket changed state.
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLOUT | EPOLLPRI | EPOLLRDHUP | EPOLLET;
+  event.data.u32 = static_cast<u32>(socket.wii_fd);
+  if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, socket.fd, &event) != 0)
   {
-    const WiiSocket& sock = socket_iter->second;
-    if (sock.IsValid())
-    {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
-      ++socket_iter;
-    }
-    else
-    {
-      // Good time to clean up invalid sockets.
-      socket_iter = WiiSockets.erase(socket_iter);
-    }
+    ERROR_LOG_FMT(IOS_NET, "Failed to watch socket (fd={}), polling all sockets instead: {}",
+                  socket.wii_fd, Common::LastStrerrorString());
+    close(m_epoll_fd);
+    m_epoll_fd = -1;
   }
+#endif
+}
+
+void WiiSockMan::UnwatchSocket(const WiiSocket& socket)
+{
+  ++m_event_generation;
+#ifdef __linux__
+  if (m_epoll_fd >= 0)
+    epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, socket.fd, nullptr);
+#endif
+}
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
+bool WiiSockMan::IsWatchingSockets() const
+{
+#ifdef __linux__
+  return m_epoll_fd >= 0;
+#else
+  return false;
+#endif
+}
 
-  if (ret >= 0)
+void WiiSockMan::UpdateSocketEvents()
+{
+  if (!IsWatchingSockets())
   {
-    for (auto& pair : WiiSockets)
-    {
-      WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
+    // Anything could have changed since the last update.
+    ++m_event_generation;
+    return;
   }
-  else
+
+#ifdef __linux__
+  std::array<epoll_event, WII_SOCKET_FD_MAX> events;
+  const int count = epoll_wait(m_epoll_fd, events.data(), static_cast<int>(events.size()), 0);
+  for (int i = 0; i < count; ++i)
   {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
-    }
+    const auto socket_entry = WiiSockets.find(static_cast<s32>(events[i].data.u32));
+    if (socket_entry != WiiSockets.end())
+      socket_entry->second.needs_update = true;
+  }
+  if (count != 0)
+    ++m_event_generation;
+#endif
+}
+
+void WiiSockMan::Update()
+{
+  // Good time to clean up invalid sockets.
+  std::erase_if(WiiSockets, [](const auto& entry) { return !entry.second.IsValid(); });
+
+  UpdateSocketEvents();
+
+  for (auto& [wii_fd, sock] : WiiSockets)
+  {
+    if (!sock.NeedsUpdate())
+      continue;
+
+    sock.needs_update = false;
+    sock.Update();
   }
   UpdatePollCommands();
 }
 
+bool WiiSockMan::HasPendingWork() const
+{
+  return !pending_polls.empty() || std::ranges::any_of(WiiSockets, [](const auto& entry) {
+           return !entry.second.pending_sockops.empty();
+         });
+}
+
 void WiiSockMan::UpdatePollCommands()
 {
   static constexpr int error_event = (POLLHUP | POLLERR);
@@ -1075,12 +1161,19 @@ void WiiSockMan::UpdatePollCommands()
     {
       ret = static_cast<int>(pfds.size());
     }
+    else if (pcmd.polled_generation == m_event_generation)
+    {
+      // None of the sockets changed state since the last poll, which found nothing.
+    }
     else
     {
+      pcmd.polled_generation = m_event_generation;
+
       // Make the behavior of poll consistent across platforms by not passing:
       //  - Set with invalid fds, revents is set to 0 (Linux) or POLLNVAL (Windows)
       //  - Set without a valid socket, raises an error on Windows
-      std::vector<int> original_order(pfds.size());
+      std::vector<int>& original_order = m_poll_order;
+      original_order.resize(pfds.size());
       std::iota(original_order.begin(), original_order.end(), 0);
       // Select indices with valid fds
       const auto partition_result = std::ranges::partition(original_order, [&](auto i) {
@@ -1208,6 +1301,7 @@ void WiiSockMan::DoState(PointerWrap& p)
 void WiiSockMan::AddPollCommand(const PollCommand& cmd)
 {
   pending_polls.push_back(cmd);
+  WakeUpdateDevice();
 }
 
 void WiiSockMan::UpdateWantDeterminism(bool want)
@@ -211,7 +211,8 @@ private:
 
   void DoSock(const Request& request, NET_IOCTL type);
   void DoSock(const Request& request, SSL_IOCTL type);
-  void Update(bool read, bool write, bool except);
+  bool NeedsUpdate() const;
+  void Update();
   void UpdateConnectingState(s32 connect_rv);
   ConnectingState GetConnectingState() const;
   bool IsValid() const { return fd >= 0; }
@@ -224,6 +225,9 @@ private:
   bool nonBlock = false;
   ConnectingState connecting_state = ConnectingState::None;
   std::list<sockop> pending_sockops;
+  // Set when an operation was queued or the socket reported an event since the pending operations
+  // were last attempted.
+  bool needs_update = false;
 
   std::optional<Timeout> timeout;
 };
@@ -243,6 +247,8 @@ public:
     u32 buffer_out = 0;
     std::vector<pollfd_t> wii_fds;
     s64 timeout = 0;
+    // The event generation of the last poll, or 0 if the command hasn't been polled yet.
+    u64 polled_generation = 0;
   };
 
   explicit WiiSockMan(EmulationKernel& ios);
@@ -255,6 +261,8 @@ public:
   s32 GetNetErrorCode(s32 ret, std::string_view caller, bool is_rw);
 
   void Update();
+  // Whether there are socket operations or polls which are waiting for a socket.
+  bool HasPendingWork() const;
   static sockaddr_in ToNativeAddrIn(WiiSockAddrIn from);
   static WiiSockAddrIn ToWiiAddrIn(const sockaddr_in& from,
                                    socklen_t addrlen = sizeof(WiiSockAddrIn));
@@ -286,12 +294,18 @@ public:
     else
     {
       socket_entry->second.DoSock(request, type);
+      WakeUpdateDevice();
     }
   }
 
   void UpdateWantDeterminism(bool want);
 
 private:
+  void WakeUpdateDevice();
+  void WatchSocket(const WiiSocket& socket);
+  void UnwatchSocket(const WiiSocket& socket);
+  bool IsWatchingSockets() const;
+  void UpdateSocketEvents();
   void UpdatePollCommands();
 
   friend class WiiSocket;
@@ -300,6 +314,15 @@ private:
   std::unordered_map<s32, WiiSocket> WiiSockets;
   s32 errno_last = 0;
   std::vector<PollCommand> pending_polls;
+  std::vector<int> m_poll_order;
+#ifdef __linux__
+  // All open host sockets are registered with this epoll instance, so that updates only have to
+  // look at the sockets which changed state.
+  int m_epoll_fd = -1;
+#endif
+  // Incremented whenever a socket may have changed state, so that pending polls are only retried
+  // when there is something new to report.
+  u64 m_event_generation = 1;
   std::chrono::time_point<std::chrono::high_resolution_clock> last_time =
       std::chrono::high_resolution_clock::now();
 };
@@ -82,7 +82,12 @@ void NetWDCommandDevice::Update()
 {
   Device::Update();
   ProcessRecvRequests();
+
+  // Some status changes take several steps.
+  const auto previous_status = m_status;
   HandleStateChange();
+  if (m_status != previous_status && m_status != m_target_status)
+    GetEmulationKernel().WakeDevice(*this);
 }
 
 void NetWDCommandDevice::ProcessRecvRequests()
@@ -226,7 +231,9 @@ std::optional<IPCReply> NetWDCommandDevice::Close(u32 fd)
   m_target_status = m_status = Status::Idle;
 
   m_ipc_owner_fd = -1;
+  // Closed devices aren't updated, so the pending requests have to be answered now.
   m_clear_all_requests.Set();
+  ProcessRecvRequests();
   return Device::Close(fd);
 }
 
@@ -265,6 +272,7 @@ IPCReply NetWDCommandDevice::SetLinkState(const IOCtlVRequest& request)
     m_target_status = target_status;
   }
 
+  GetEmulationKernel().WakeDevice(*this);
   return IPCReply(IPC_SUCCESS);
 }
 
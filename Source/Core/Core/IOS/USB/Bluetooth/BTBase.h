@@ -31,6 +31,7 @@ class BluetoothBaseDevice : public EmulationDevice
 {
 public:
   using EmulationDevice::EmulationDevice;
+  bool IsPolled() const override { return true; }
   virtual void UpdateSyncButtonState(bool is_held) {}
   virtual void TriggerSyncButtonPressedEvent() {}
   virtual void TriggerSyncButtonHeldEvent() {}
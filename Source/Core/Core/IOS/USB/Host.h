@@ -54,6 +54,7 @@ protected:
 
 private:
   void Update() override;
+  bool IsPolled() const override { return true; }
   void OnDevicesChangedInternal(const USBScanner::DeviceMap& new_devices);
 
   bool m_has_initialised = false;
@@ -23,6 +23,7 @@ public:
   std::optional<IPCReply> Write(const ReadWriteRequest& request) override;
   std::optional<IPCReply> IOCtl(const IOCtlRequest& request) override;
   void Update() override;
+  bool IsPolled() const override { return true; }
 
 private:
   enum class MessageType : u32
@@ -0,0 +1,142 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/MetricsServer.h"
+
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+#include "Common/Metrics.h"
+#include "Common/Thread.h"
+#include "Core/System.h"
+#include "VideoCommon/PerformanceMetrics.h"
+
+namespace
+{
+// How long the server thread waits for a connection before checking whether it should exit, and
+// how long a client gets to send its request.
+constexpr int POLL_TIMEOUT_MS = 100;
+
+constexpr size_t MAX_REQUEST_SIZE = 4096;
+
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+Common::Metrics::Gauge s_fps{"fps", "Frames per second"};
+Common::Metrics::Gauge s_vps{"vps", "VI fields per second"};
+Common::Metrics::Gauge s_speed{"speed", "Emulation speed, where 1 is full speed"};
+}  // namespace
+
+MetricsServer::MetricsServer(Core::System& system, std::string path)
+    : m_system(system), m_path(std::move(path))
+{
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (m_path.size() >= sizeof(addr.sun_path))
+  {
+    ERROR_LOG_FMT(CORE, "Metrics socket path is too long: {}", m_path);
+    return;
+  }
+  std::memcpy(addr.sun_path, m_path.c_str(), m_path.size() + 1);
+
+  m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (m_fd < 0)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to create metrics socket: {}", Common::LastStrerrorString());
+    return;
+  }
+
+  // Remove the socket of a previous run, which would make binding fail.
+  unlink(m_path.c_str());
+  if (bind(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(m_fd, 8) < 0)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to listen on metrics socket {}: {}", m_path,
+                  Common::LastStrerrorString());
+    close(m_fd);
+    m_fd = -1;
+    return;
+  }
+
+  NOTICE_LOG_FMT(CORE, "Serving metrics on {}", m_path);
+  m_running.Set();
+  m_thread = std::thread(&MetricsServer::ServerThread, this);
+}
+
+MetricsServer::~MetricsServer()
+{
+  if (m_fd < 0)
+    return;
+
+  m_running.Clear();
+  m_thread.join();
+  close(m_fd);
+  unlink(m_path.c_str());
+}
+
+void MetricsServer::ServerThread()
+{
+  Common::SetCurrentThreadName("Metrics server");
+
+  while (m_running.IsSet())
+  {
+    pollfd pfd{.fd = m_fd, .events = POLLIN};
+    if (poll(&pfd, 1, POLL_TIMEOUT_MS) <= 0)
+      continue;
+
+    const int client_fd = accept(m_fd, nullptr, nullptr);
+    if (client_fd < 0)
+      continue;
+
+    ServeClient(client_fd);
+    close(client_fd);
+  }
+}
+
+void MetricsServer::ServeClient(int fd)
+{
+  // Read the request so that HTTP clients don't see the connection reset, but don't bother
+  // parsing it: every request gets the same response.
+  std::string request;
+  while (request.size() < MAX_REQUEST_SIZE && request.find("\r\n\r\n") == std::string::npos)
+  {
+    pollfd pfd{.fd = fd, .events = POLLIN};
+    if (poll(&pfd, 1, POLL_TIMEOUT_MS) <= 0)
+      break;
+
+    char buffer[512];
+    const ssize_t size = recv(fd, buffer, sizeof(buffer), 0);
+    if (size <= 0)
+      break;
+    request.append(buffer, size);
+  }
+
+  const PerformanceMetrics& perf_metrics = m_system.GetPerfMetrics();
+  s_fps.Set(perf_metrics.GetFPS());
+  s_vps.Set(perf_metrics.GetVPS());
+  s_speed.Set(perf_metrics.GetSpeed());
+
+  const std::string body = Common::Metrics::FormatText();
+  const std::string response =
+      fmt::format("HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+                  "Content-Length: {}\r\nConnection: close\r\n\r\n{}",
+                  body.size(), body);
+
+  size_t sent = 0;
+  while (sent < response.size())
+  {
+    const ssize_t size = send(fd, response.data() + sent, response.size() - sent, SEND_FLAGS);
+    if (size <= 0)
+      break;
+    sent += size;
+  }
+}
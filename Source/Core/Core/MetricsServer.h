@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <thread>
+
+#include "Common/Flag.h"
+
+namespace Core
+{
+class System;
+}
+
+// MetricsServer serves the current values of all Common::Metrics on a unix domain socket, so that
+// headless instances can be monitored without the on-screen overlay.
+//
+// Every client that connects is sent a minimal HTTP response containing the metrics in the
+// Prometheus text format, after which the connection is closed. For example:
+//   curl --unix-socket <path> http://localhost/metrics
+class MetricsServer final
+{
+public:
+  MetricsServer(Core::System& system, std::string path);
+  ~MetricsServer();
+
+  MetricsServer(const MetricsServer&) = delete;
+  MetricsServer& operator=(const MetricsServer&) = delete;
+
+private:
+  void ServerThread();
+  void ServeClient(int fd);
+
+  Core::System& m_system;
+  std::string m_path;
+  int m_fd = -1;
+  Common::Flag m_running;
+  std::thread m_thread;
+};
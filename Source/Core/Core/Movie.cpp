@@ -10,6 +10,8 @@
 #include <locale>
 #include <mbedtls/md.h>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <thread>
 #include <utility>
 #include <variant>
@@ -25,6 +27,7 @@
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
@@ -105,6 +108,30 @@ static std::array<u8, 20> ConvertGitRevisionToBytes(const std::string& revision)
   return revision_bytes;
 }
 
+// Reads everything following the header, in either version of the format.
+static std::optional<MovieData> ReadMovieData(File::IOFile& file, const DTMHeader& header)
+{
+  if (header.formatVersion == DTM_VERSION_SEEKABLE)
+  {
+    std::optional<MovieData> data = ReadSeekableMovieData(file);
+    if (data && data->state_version != State::GetVersion() && !data->keyframes.empty())
+    {
+      // The input is still fine, but seeking will have to do without these.
+      WARN_LOG_FMT(CORE, "Ignoring {} keyframes made with savestate version {}",
+                   data->keyframes.size(), data->state_version);
+      data->keyframes.clear();
+    }
+    return data;
+  }
+
+  // formatVersion used to be padding, so anything else is treated as the original format.
+  MovieData data;
+  data.input.resize(file.GetSize() - file.Tell());
+  if (!file.ReadBytes(data.input.data(), data.input.size()))
+    return std::nullopt;
+  return data;
+}
+
 MovieManager::MovieManager(Core::System& system) : m_system(system)
 {
 }
@@ -183,6 +210,74 @@ void MovieManager::FrameUpdate()
   }
 
   m_polled = false;
+
+  if (IsMovieActive())
+    UpdateSeekData();
+}
+
+// NOTE: CPU Thread
+void MovieManager::UpdateSeekData()
+{
+  if (IsRecordingInput())
+  {
+    // Anything after this point is about to be recorded over.
+    std::erase_if(m_keyframes, [this](const Keyframe& keyframe) {
+      return keyframe.frame > m_current_frame || keyframe.input_byte > m_current_byte;
+    });
+    while (!m_frame_index.empty() && m_frame_index.back().frame >= m_current_frame)
+      m_frame_index.pop_back();
+  }
+
+  if (m_frame_index.empty() || m_frame_index.back().frame < m_current_frame)
+    m_frame_index.push_back({m_current_frame, m_current_byte});
+
+  if (m_seek_target_frame && m_current_frame >= *m_seek_target_frame)
+  {
+    m_seek_target_frame.reset();
+    m_system.GetCPU().Break();
+    Core::DisplayMessage(fmt::format("Reached frame {}", m_current_frame), 2000);
+  }
+
+  const u32 keyframe_interval = Config::Get(Config::MAIN_MOVIE_KEYFRAME_INTERVAL);
+  if (keyframe_interval != 0 && m_current_frame % keyframe_interval == 0 &&
+      (m_keyframes.empty() || m_keyframes.back().frame < m_current_frame) &&
+      !NetPlay::IsNetPlayRunning())
+  {
+    // A savestate can't be made in the middle of a CoreTiming event, so wait for the CPU thread
+    // to be paused. The keyframe will be a little after this frame's start, which doesn't matter.
+    Core::QueueHostJob([](Core::System& system) {
+      Core::RunOnCPUThread(system, [&system] { system.GetMovie().CaptureKeyframe(); });
+    });
+  }
+}
+
+// NOTE: CPU Thread
+void MovieManager::CaptureKeyframe()
+{
+  // The movie may have ended or been rewound since this was requested.
+  if (!IsMovieActive() || (!m_keyframes.empty() && m_keyframes.back().frame >= m_current_frame))
+    return;
+
+  Common::UniqueBuffer<u8> buffer;
+  const size_t size = State::SaveToBuffer(m_system, buffer);
+  if (size == 0)
+    return;
+
+  Keyframe keyframe =
+      CompressKeyframe(m_current_frame, m_current_byte, std::span(buffer.data(), size));
+  if (!keyframe.compressed_state.empty())
+    m_keyframes.push_back(std::move(keyframe));
+}
+
+// Drops the seek data which depends on input after the given byte.
+void MovieManager::DiscardSeekDataAfter(u64 input_byte)
+{
+  std::erase_if(m_frame_index, [input_byte](const FrameIndexEntry& entry) {
+    return entry.input_byte > input_byte;
+  });
+  std::erase_if(m_keyframes, [input_byte](const Keyframe& keyframe) {
+    return keyframe.input_byte > input_byte;
+  });
 }
 
 // called when game is booting up, even if no movie is active,
@@ -507,6 +602,8 @@ bool MovieManager::BeginRecordingInput(const ControllerTypeArray& controllers,
   m_play_mode = PlayMode::Recording;
   m_author = Config::Get(Config::MAIN_MOVIE_MOVIE_AUTHOR);
   m_temp_input.clear();
+  m_frame_index.clear();
+  m_keyframes.clear();
 
   m_current_byte = 0;
 
@@ -872,6 +969,14 @@ bool MovieManager::PlayInput(const std::string& movie_path,
     return false;
   }
 
+  std::optional<MovieData> data = ReadMovieData(recording_file, m_temp_header);
+  recording_file.Close();
+  if (!data)
+  {
+    PanicAlertFmtT("Invalid recording file");
+    return false;
+  }
+
   ReadHeader();
 
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
@@ -892,10 +997,10 @@ bool MovieManager::PlayInput(const std::string& movie_path,
 
   Core::UpdateWantDeterminism(m_system);
 
-  m_temp_input.resize(recording_file.GetSize() - 256);
-  recording_file.ReadBytes(m_temp_input.data(), m_temp_input.size());
+  m_temp_input = std::move(data->input);
+  m_frame_index = std::move(data->frame_index);
+  m_keyframes = std::move(data->keyframes);
   m_current_byte = 0;
-  recording_file.Close();
 
   // Load savestate (and skip to frame data)
   if (m_temp_header.bFromSaveState && savestate_path)
@@ -970,7 +1075,16 @@ void MovieManager::LoadInput(const std::string& movie_path)
   if (m_system.IsWii())
     ChangeWiiPads();
 
-  u64 totalSavedBytes = t_record.GetSize() - 256;
+  std::optional<MovieData> data = ReadMovieData(t_record, m_temp_header);
+  t_record.Close();
+  if (!data)
+  {
+    PanicAlertFmtT("Savestate movie {0} is corrupted, movie recording stopping...", movie_path);
+    EndPlayInput(false);
+    return;
+  }
+
+  const u64 totalSavedBytes = data->input.size();
 
   bool afterEnd = false;
   // This can only happen if the user manually deletes data from the dtm.
@@ -990,8 +1104,15 @@ void MovieManager::LoadInput(const std::string& movie_path)
     m_total_input_count = m_temp_header.inputCount;
     m_total_tick_count = m_tick_count_at_last_input = m_temp_header.tickCount;
 
-    m_temp_input.resize(static_cast<size_t>(totalSavedBytes));
-    t_record.ReadBytes(m_temp_input.data(), m_temp_input.size());
+    // Savestates don't store seek data, but what we have stays valid as long as the input does.
+    const auto common_end = std::ranges::mismatch(m_temp_input, data->input).in1;
+    DiscardSeekDataAfter(static_cast<u64>(common_end - m_temp_input.begin()));
+    if (!data->frame_index.empty())
+      m_frame_index = std::move(data->frame_index);
+    if (!data->keyframes.empty())
+      m_keyframes = std::move(data->keyframes);
+
+    m_temp_input = std::move(data->input);
   }
   else if (m_current_byte > 0)
   {
@@ -1011,8 +1132,7 @@ void MovieManager::LoadInput(const std::string& movie_path)
     else if (m_current_byte > 0 && !m_temp_input.empty())
     {
       // verify identical from movie start to the save's current frame
-      std::vector<u8> movInput(m_current_byte);
-      t_record.ReadArray(movInput.data(), movInput.size());
+      const std::span<const u8> movInput(data->input.data(), m_current_byte);
 
       const auto mismatch_result = std::ranges::mismatch(movInput, m_temp_input);
 
@@ -1034,6 +1154,7 @@ void MovieManager::LoadInput(const std::string& movie_path)
                          byte_offset, byte_offset);
 
           std::ranges::copy(movInput, m_temp_input.begin());
+          DiscardSeekDataAfter(static_cast<u64>(mismatch_index));
         }
         else
         {
@@ -1073,7 +1194,6 @@ void MovieManager::LoadInput(const std::string& movie_path)
       }
     }
   }
-  t_record.Close();
 
   m_save_config = m_temp_header.bSaveConfig;
 
@@ -1264,6 +1384,8 @@ bool MovieManager::PlayWiimote(int wiimote, DesiredWiimoteState* desired_state)
 // NOTE: Host / EmuThread / CPU Thread
 void MovieManager::EndPlayInput(bool cont)
 {
+  m_seek_target_frame.reset();
+
   if (cont)
   {
     // If !IsMovieActive(), changing m_play_mode requires calling UpdateWantDeterminism
@@ -1295,8 +1417,53 @@ void MovieManager::EndPlayInput(bool cont)
   }
 }
 
+// NOTE: Host Thread
+void MovieManager::SeekToFrame(u64 frame)
+{
+  Core::RunOnCPUThread(m_system, [this, frame] {
+    if (!IsPlayingInput())
+      return;
+
+    // Load the last keyframe up to the target, unless playing on from the current frame is closer.
+    const auto next_keyframe = std::ranges::upper_bound(m_keyframes, frame, {}, &Keyframe::frame);
+    if (next_keyframe != m_keyframes.begin() &&
+        (frame < m_current_frame || std::prev(next_keyframe)->frame > m_current_frame))
+    {
+      const Keyframe& keyframe = *std::prev(next_keyframe);
+      Common::UniqueBuffer<u8> state;
+      if (!DecompressKeyframe(keyframe, state) || !State::LoadFromMemory(m_system, state))
+      {
+        PanicAlertFmtT("Failed to load the keyframe at frame {0}.", keyframe.frame);
+        return;
+      }
+    }
+    else if (frame < m_current_frame)
+    {
+      Core::DisplayMessage(fmt::format("There is no keyframe before frame {}", frame), 2000);
+      return;
+    }
+
+    if (m_current_frame >= frame)
+    {
+      Core::DisplayMessage(fmt::format("Reached frame {}", m_current_frame), 2000);
+      return;
+    }
+
+    // UpdateSeekData pauses once the target is reached.
+    m_seek_target_frame = frame;
+    Core::QueueHostJob(
+        [](Core::System& system) { Core::SetState(system, Core::State::Running); });
+  });
+}
+
+// NOTE: CPU Thread
+bool MovieManager::IsSeeking() const
+{
+  return m_seek_target_frame.has_value();
+}
+
 // NOTE: Save State + Host Thread
-void MovieManager::SaveRecording(const std::string& filename)
+void MovieManager::SaveRecording(const std::string& filename, bool include_seek_data)
 {
   File::IOFile save_record(filename, "wb");
   // Create the real header now and write it
@@ -1346,9 +1513,17 @@ void MovieManager::SaveRecording(const std::string& filename)
   header.uniqueID = 0;
   // header.audioEmulator;
 
+  const bool seekable =
+      include_seek_data &&
+      (!m_keyframes.empty() || Config::Get(Config::MAIN_MOVIE_KEYFRAME_INTERVAL) != 0);
+  if (seekable)
+    header.formatVersion = DTM_VERSION_SEEKABLE;
+
   save_record.WriteArray(&header, 1);
 
-  bool success = save_record.WriteBytes(m_temp_input.data(), m_temp_input.size());
+  bool success = seekable ? WriteSeekableMovieData(save_record, m_temp_input, m_frame_index,
+                                                   m_keyframes, State::GetVersion()) :
+                            save_record.WriteBytes(m_temp_input.data(), m_temp_input.size());
 
   if (success && m_recording_from_save_state)
   {
@@ -1479,5 +1654,8 @@ void MovieManager::Shutdown()
 {
   m_current_input_count = m_total_input_count = m_total_frames = m_tick_count_at_last_input = 0;
   m_temp_input.clear();
+  m_frame_index.clear();
+  m_keyframes.clear();
+  m_seek_target_frame.reset();
 }
 }  // namespace Movie
@@ -12,6 +12,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/WiimoteEmu/DesiredWiimoteState.h"
+#include "Core/MovieFile.h"
 
 struct BootParameters;
 
@@ -133,7 +134,8 @@ struct DTMHeader
   u8 GBAControllers;                // GBA Controllers plugged in (the bits are ports 1-4)
   bool bWidescreen;                 // true indicates SYSCONF aspect ratio is 16:9, false for 4:3
   u8 countryCode;                   // SYSCONF country code
-  std::array<u8, 5> reserved;       // Padding for any new config options
+  u8 formatVersion;                 // DTM_VERSION_SEEKABLE for MovieFile.h, else original format
+  std::array<u8, 4> reserved;       // Padding for any new config options
   std::array<char, 40> discChange;  // Name of iso file to switch to, for two disc games.
   std::array<u8, 20> revision;      // Git hash
   u32 DSPiromHash;
@@ -213,7 +215,10 @@ public:
   void PlayController(GCPadStatus* PadStatus, int controllerID);
   bool PlayWiimote(int wiimote, WiimoteEmu::DesiredWiimoteState* desired_state);
   void EndPlayInput(bool cont);
-  void SaveRecording(const std::string& filename);
+  void SeekToFrame(u64 frame);
+  bool IsSeeking() const;
+  // Savestates pass false, as they only need the input and are saved often.
+  void SaveRecording(const std::string& filename, bool include_seek_data = true);
   void DoState(PointerWrap& p);
   void Shutdown();
   void CheckPadStatus(const GCPadStatus* PadStatus, int controllerID);
@@ -230,6 +235,10 @@ private:
   void CheckMD5();
   void GetMD5();
 
+  void UpdateSeekData();
+  void CaptureKeyframe();
+  void DiscardSeekDataAfter(u64 input_byte);
+
   bool m_read_only = true;
   u32 m_rerecords = 0;
   PlayMode m_play_mode = PlayMode::None;
@@ -239,6 +248,9 @@ private:
   ControllerState m_pad_state{};
   DTMHeader m_temp_header{};
   std::vector<u8> m_temp_input;
+  std::vector<FrameIndexEntry> m_frame_index;
+  std::vector<Keyframe> m_keyframes;
+  std::optional<u64> m_seek_target_frame;
   u64 m_current_byte = 0;
   u64 m_current_frame = 0;
   u64 m_total_frames = 0;  // VI
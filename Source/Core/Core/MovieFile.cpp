@@ -0,0 +1,301 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/MovieFile.h"
+
+#include <map>
+#include <optional>
+#include <thread>
+
+#include <zstd.h>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace Movie
+{
+// A zstd block decompresses to at most 128 KiB, and takes at least 4 bytes (an RLE block).
+constexpr u64 ZSTD_MAX_COMPRESSION_RATIO = 128 * 1024 / 4;
+
+// Limits on what a movie can claim to hold, so that a small crafted file can't make us allocate
+// gigabytes. They are far above what real movies and savestates need.
+constexpr u64 MAX_INPUT_SIZE = 256 * 1024 * 1024;
+constexpr u32 MAX_FRAME_INDEX_COUNT = 1 << 24;
+constexpr u64 MAX_STATE_SIZE = 512 * 1024 * 1024;
+
+static std::vector<u8> Compress(std::span<const u8> data, int level)
+{
+  ZSTD_CCtx* const context = ZSTD_createCCtx();
+  ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, level);
+  // This fails harmlessly if zstd was built without multithreading support.
+  ZSTD_CCtx_setParameter(context, ZSTD_c_nbWorkers,
+                         static_cast<int>(std::thread::hardware_concurrency()));
+
+  std::vector<u8> compressed(ZSTD_compressBound(data.size()));
+  const size_t size =
+      ZSTD_compress2(context, compressed.data(), compressed.size(), data.data(), data.size());
+  ZSTD_freeCCtx(context);
+
+  // A successfully compressed buffer is never empty, even if the data is.
+  if (ZSTD_isError(size))
+    return {};
+
+  compressed.resize(size);
+  compressed.shrink_to_fit();
+  return compressed;
+}
+
+// Returns the size that a zstd frame says it decompresses to, if it is possible and at most
+// max_size.
+static std::optional<u64> GetDecompressedSize(std::span<const u8> compressed, u64 max_size)
+{
+  const unsigned long long size = ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+  if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR || size > max_size ||
+      size / ZSTD_MAX_COMPRESSION_RATIO > compressed.size())
+  {
+    return std::nullopt;
+  }
+  return size;
+}
+
+static bool Decompress(std::span<const u8> compressed, std::span<u8> data)
+{
+  const size_t size =
+      ZSTD_decompress(data.data(), data.size(), compressed.data(), compressed.size());
+  return !ZSTD_isError(size) && size == data.size();
+}
+
+static void WriteLEB128(std::vector<u8>* out, u64 value)
+{
+  do
+  {
+    const u8 byte = value & 0x7f;
+    value >>= 7;
+    out->push_back(value != 0 ? byte | 0x80 : byte);
+  } while (value != 0);
+}
+
+static bool ReadLEB128(std::span<const u8> in, size_t* position, u64* value)
+{
+  u64 result = 0;
+  for (u32 shift = 0; shift < 64; shift += 7)
+  {
+    if (*position >= in.size())
+      return false;
+
+    const u8 byte = in[(*position)++];
+    result |= static_cast<u64>(byte & 0x7f) << shift;
+    if (!(byte & 0x80))
+    {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Most frames read the same controllers in the same way, so the input usually repeats with the
+// size of a frame's worth of input. This returns the most common such size, or 0 if unknown.
+static u32 GetDeltaPeriod(std::span<const FrameIndexEntry> frame_index)
+{
+  std::map<u64, u64> counts;
+  for (size_t i = 1; i < frame_index.size(); ++i)
+  {
+    const u64 size = frame_index[i].input_byte - frame_index[i - 1].input_byte;
+    if (frame_index[i].frame == frame_index[i - 1].frame + 1 && size != 0 && size <= UINT32_MAX)
+      ++counts[size];
+  }
+
+  u64 period = 0;
+  u64 best_count = 0;
+  for (const auto& [size, count] : counts)
+  {
+    if (count > best_count)
+    {
+      period = size;
+      best_count = count;
+    }
+  }
+  return static_cast<u32>(period);
+}
+
+static void DeltaEncode(std::span<u8> data, u32 period)
+{
+  if (period == 0)
+    return;
+
+  for (size_t i = data.size(); i > period; --i)
+    data[i - 1] ^= data[i - 1 - period];
+}
+
+static void DeltaDecode(std::span<u8> data, u32 period)
+{
+  if (period == 0)
+    return;
+
+  for (size_t i = period; i < data.size(); ++i)
+    data[i] ^= data[i - period];
+}
+
+bool WriteSeekableMovieData(File::IOFile& file, std::span<const u8> input,
+                            std::span<const FrameIndexEntry> frame_index,
+                            std::span<const Keyframe> keyframes, u32 state_version)
+{
+  DTMSeekableHeader header{};
+  header.input_size = input.size();
+  header.delta_period = GetDeltaPeriod(frame_index);
+  header.frame_index_count = static_cast<u32>(frame_index.size());
+  header.keyframe_count = static_cast<u32>(keyframes.size());
+  header.state_version = state_version;
+
+  std::vector<u8> delta_input(input.begin(), input.end());
+  DeltaEncode(delta_input, header.delta_period);
+  const std::vector<u8> compressed_input = Compress(delta_input, 19);
+
+  std::vector<u8> encoded_frame_index;
+  FrameIndexEntry previous{};
+  for (const FrameIndexEntry& entry : frame_index)
+  {
+    WriteLEB128(&encoded_frame_index, entry.frame - previous.frame);
+    WriteLEB128(&encoded_frame_index, entry.input_byte - previous.input_byte);
+    previous = entry;
+  }
+  const std::vector<u8> compressed_frame_index =
+      Compress(encoded_frame_index, ZSTD_CLEVEL_DEFAULT);
+
+  if (compressed_input.empty() || compressed_frame_index.empty())
+    return false;
+
+  header.compressed_input_size = compressed_input.size();
+  header.compressed_frame_index_size = compressed_frame_index.size();
+
+  std::vector<DTMKeyframeEntry> entries;
+  entries.reserve(keyframes.size());
+  u64 offset = file.Tell() + sizeof(header) + keyframes.size() * sizeof(DTMKeyframeEntry) +
+               compressed_input.size() + compressed_frame_index.size();
+  for (const Keyframe& keyframe : keyframes)
+  {
+    entries.push_back({keyframe.frame, keyframe.input_byte, offset,
+                       keyframe.compressed_state.size(), keyframe.state_size});
+    offset += keyframe.compressed_state.size();
+  }
+
+  bool success = file.WriteArray(&header, 1) && file.WriteArray(entries.data(), entries.size()) &&
+                 file.WriteBytes(compressed_input.data(), compressed_input.size()) &&
+                 file.WriteBytes(compressed_frame_index.data(), compressed_frame_index.size());
+  for (const Keyframe& keyframe : keyframes)
+  {
+    success = success &&
+              file.WriteBytes(keyframe.compressed_state.data(), keyframe.compressed_state.size());
+  }
+  return success;
+}
+
+std::optional<MovieData> ReadSeekableMovieData(File::IOFile& file)
+{
+  const u64 file_size = file.GetSize();
+
+  DTMSeekableHeader header;
+  if (!file.ReadArray(&header, 1))
+    return std::nullopt;
+
+  // Check sizes against the file and the limits before allocating anything for them.
+  if (header.input_size > MAX_INPUT_SIZE || header.frame_index_count > MAX_FRAME_INDEX_COUNT)
+    return std::nullopt;
+  u64 remaining = file_size - file.Tell();
+  if (header.keyframe_count > remaining / sizeof(DTMKeyframeEntry))
+    return std::nullopt;
+  std::vector<DTMKeyframeEntry> entries(header.keyframe_count);
+  if (!file.ReadArray(entries.data(), entries.size()))
+    return std::nullopt;
+
+  remaining = file_size - file.Tell();
+  if (header.compressed_input_size > remaining ||
+      header.compressed_frame_index_size > remaining - header.compressed_input_size)
+  {
+    return std::nullopt;
+  }
+
+  std::vector<u8> compressed_input(header.compressed_input_size);
+  std::vector<u8> compressed_frame_index(header.compressed_frame_index_size);
+  if (!file.ReadBytes(compressed_input.data(), compressed_input.size()) ||
+      !file.ReadBytes(compressed_frame_index.data(), compressed_frame_index.size()))
+  {
+    return std::nullopt;
+  }
+
+  MovieData data;
+  data.state_version = header.state_version;
+
+  if (GetDecompressedSize(compressed_input, MAX_INPUT_SIZE) != header.input_size)
+    return std::nullopt;
+  data.input.resize(header.input_size);
+  if (!Decompress(compressed_input, data.input))
+    return std::nullopt;
+  DeltaDecode(data.input, header.delta_period);
+
+  // Every entry takes between 2 and 20 bytes.
+  const std::optional<u64> frame_index_size =
+      GetDecompressedSize(compressed_frame_index, u64{header.frame_index_count} * 20);
+  if (!frame_index_size || *frame_index_size / 2 < header.frame_index_count)
+    return std::nullopt;
+  std::vector<u8> encoded_frame_index(*frame_index_size);
+  if (!Decompress(compressed_frame_index, encoded_frame_index))
+    return std::nullopt;
+
+  data.frame_index.reserve(header.frame_index_count);
+  size_t position = 0;
+  FrameIndexEntry previous{};
+  for (u32 i = 0; i < header.frame_index_count; ++i)
+  {
+    u64 frame_delta, input_byte_delta;
+    if (!ReadLEB128(encoded_frame_index, &position, &frame_delta) ||
+        !ReadLEB128(encoded_frame_index, &position, &input_byte_delta))
+    {
+      return std::nullopt;
+    }
+    previous = {previous.frame + frame_delta, previous.input_byte + input_byte_delta};
+    data.frame_index.push_back(previous);
+  }
+
+  data.keyframes.reserve(entries.size());
+  for (const DTMKeyframeEntry& entry : entries)
+  {
+    if (entry.offset > file_size || entry.compressed_size > file_size - entry.offset ||
+        entry.state_size > MAX_STATE_SIZE ||
+        entry.state_size / ZSTD_MAX_COMPRESSION_RATIO > entry.compressed_size)
+    {
+      return std::nullopt;
+    }
+
+    Keyframe& keyframe = data.keyframes.emplace_back(
+        Keyframe{entry.frame, entry.input_byte, entry.state_size, {}});
+    keyframe.compressed_state.resize(entry.compressed_size);
+    if (!file.Seek(entry.offset, File::SeekOrigin::Begin) ||
+        !file.ReadBytes(keyframe.compressed_state.data(), keyframe.compressed_state.size()))
+    {
+      return std::nullopt;
+    }
+  }
+
+  return data;
+}
+
+Keyframe CompressKeyframe(u64 frame, u64 input_byte, std::span<const u8> state)
+{
+  // Keyframes are captured while the emulation is paused, so favor speed over size.
+  return {frame, input_byte, state.size(), Compress(state, 1)};
+}
+
+bool DecompressKeyframe(const Keyframe& keyframe, Common::UniqueBuffer<u8>& state)
+{
+  if (GetDecompressedSize(keyframe.compressed_state, MAX_STATE_SIZE) != keyframe.state_size)
+  {
+    ERROR_LOG_FMT(CORE, "Keyframe at frame {} is corrupted", keyframe.frame);
+    return false;
+  }
+
+  state.reset(keyframe.state_size);
+  return Decompress(keyframe.compressed_state, state);
+}
+}  // namespace Movie
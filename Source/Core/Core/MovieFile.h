@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+}
+
+// Version 2 of the DTM format ("seekable") keeps the 256 byte DTMHeader, with formatVersion set to
+// DTM_VERSION_SEEKABLE, and follows it with:
+// - a DTMSeekableHeader,
+// - a DTMKeyframeEntry for each keyframe,
+// - the zstd-compressed input, where every byte is XORed with the byte delta_period bytes before
+//   it (input usually repeats from one frame to the next, so this leaves mostly zeroes),
+// - the zstd-compressed frame index, as pairs of LEB128 deltas from the previous entry's frame and
+//   input byte,
+// - the zstd-compressed savestate of each keyframe, at the offset given by its entry.
+// All values are little endian. Version 1 files simply store the raw input after the header.
+
+namespace Movie
+{
+constexpr u8 DTM_VERSION_SEEKABLE = 2;
+
+#pragma pack(push, 1)
+struct DTMSeekableHeader
+{
+  u64 input_size;
+  u64 compressed_input_size;
+  u32 delta_period;
+  u32 frame_index_count;
+  u64 compressed_frame_index_size;
+  u32 keyframe_count;
+  u32 state_version;  // Keyframes can only be loaded by builds with the same savestate version
+  std::array<u8, 24> reserved;
+};
+static_assert(sizeof(DTMSeekableHeader) == 64);
+
+struct DTMKeyframeEntry
+{
+  u64 frame;
+  u64 input_byte;
+  u64 offset;  // From the start of the file
+  u64 compressed_size;
+  u64 state_size;
+};
+static_assert(sizeof(DTMKeyframeEntry) == 40);
+#pragma pack(pop)
+
+// Where the input of a frame starts.
+struct FrameIndexEntry
+{
+  u64 frame;
+  u64 input_byte;
+
+  bool operator==(const FrameIndexEntry&) const = default;
+};
+
+// A compressed savestate which seeking can start from.
+struct Keyframe
+{
+  u64 frame;
+  u64 input_byte;
+  u64 state_size;
+  std::vector<u8> compressed_state;
+};
+
+struct MovieData
+{
+  std::vector<u8> input;
+  std::vector<FrameIndexEntry> frame_index;
+  std::vector<Keyframe> keyframes;
+  u32 state_version = 0;
+};
+
+// These read and write everything following the DTMHeader of a seekable movie.
+bool WriteSeekableMovieData(File::IOFile& file, std::span<const u8> input,
+                            std::span<const FrameIndexEntry> frame_index,
+                            std::span<const Keyframe> keyframes, u32 state_version);
+std::optional<MovieData> ReadSeekableMovieData(File::IOFile& file);
+
+Keyframe CompressKeyframe(u64 frame, u64 input_byte, std::span<const u8> state);
+bool DecompressKeyframe(const Keyframe& keyframe, Common::UniqueBuffer<u8>& state);
+}  // namespace Movie
@@ -10,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <span>
 #include <thread>
 #include <tuple>
@@ -540,10 +541,22 @@ void NetPlayClient::OnChunkedDataStart(sf::Packet& packet)
   std::string title;
   packet >> title;
   const u64 data_size = Common::PacketReadU64(packet);
+  bool is_save_data_stream;
+  packet >> is_save_data_stream;
 
   INFO_LOG_FMT(NETPLAY, "Starting data chunk {}.", cid);
 
-  m_chunked_data_receive_queue.emplace(cid, sf::Packet{});
+  if (is_save_data_stream)
+  {
+    // The host aborts the rest of a sync which failed.
+    if (!m_sync_save_data_receiver)
+      return;
+    m_sync_save_data_chunk_id = cid;
+  }
+  else
+  {
+    m_chunked_data_receive_queue.emplace(cid, sf::Packet{});
+  }
 
   std::vector<int> players;
   players.push_back(m_local_player->pid);
@@ -555,19 +568,30 @@ void NetPlayClient::OnChunkedDataEnd(sf::Packet& packet)
   u32 cid;
   packet >> cid;
 
-  const auto data_packet_iter = m_chunked_data_receive_queue.find(cid);
-  if (data_packet_iter == m_chunked_data_receive_queue.end())
+  if (m_sync_save_data_chunk_id == cid)
   {
-    INFO_LOG_FMT(NETPLAY, "Invalid data chunk ID {}.", cid);
-    return;
+    INFO_LOG_FMT(NETPLAY, "Ending save data chunk {}.", cid);
+
+    m_sync_save_data_chunk_id.reset();
+    m_dialog->HideChunkedProgressDialog();
+    FinishSyncSaveData();
   }
+  else
+  {
+    const auto data_packet_iter = m_chunked_data_receive_queue.find(cid);
+    if (data_packet_iter == m_chunked_data_receive_queue.end())
+    {
+      INFO_LOG_FMT(NETPLAY, "Invalid data chunk ID {}.", cid);
+      return;
+    }
 
-  INFO_LOG_FMT(NETPLAY, "Ending data chunk {}.", cid);
+    INFO_LOG_FMT(NETPLAY, "Ending data chunk {}.", cid);
 
-  auto& data_packet = data_packet_iter->second;
-  OnData(data_packet);
-  m_chunked_data_receive_queue.erase(data_packet_iter);
-  m_dialog->HideChunkedProgressDialog();
+    auto& data_packet = data_packet_iter->second;
+    OnData(data_packet);
+    m_chunked_data_receive_queue.erase(data_packet_iter);
+    m_dialog->HideChunkedProgressDialog();
+  }
 
   sf::Packet complete_packet;
   complete_packet << MessageID::ChunkedDataComplete;
@@ -577,32 +601,50 @@ void NetPlayClient::OnChunkedDataEnd(sf::Packet& packet)
 
 void NetPlayClient::OnChunkedDataPayload(sf::Packet& packet)
 {
+  // The rest of the packet is data, after the message ID and the chunk ID.
+  constexpr size_t header_size = sizeof(MessageID) + sizeof(u32);
+  if (packet.getDataSize() < header_size)
+    return;
+
   u32 cid;
   packet >> cid;
 
-  const auto data_packet_iter = m_chunked_data_receive_queue.find(cid);
-  if (data_packet_iter == m_chunked_data_receive_queue.end())
+  const std::span<const u8> data{static_cast<const u8*>(packet.getData()) + header_size,
+                                 packet.getDataSize() - header_size};
+  u64 progress;
+  if (m_sync_save_data_chunk_id == cid)
   {
-    INFO_LOG_FMT(NETPLAY, "Invalid data chunk ID {}.", cid);
-    return;
+    // Save data is decompressed as it arrives, rather than once all of it has been received.
+    if (!m_sync_save_data_receiver->Receive(data))
+    {
+      m_dialog->HideChunkedProgressDialog();
+      SyncSaveDataResponse(false);
+      return;
+    }
+    progress = m_sync_save_data_receiver->GetReceivedSize();
   }
-
-  auto& data_packet = data_packet_iter->second;
-  while (!packet.endOfPacket())
+  else
   {
-    u8 byte;
-    packet >> byte;
-    data_packet << byte;
+    const auto data_packet_iter = m_chunked_data_receive_queue.find(cid);
+    if (data_packet_iter == m_chunked_data_receive_queue.end())
+    {
+      INFO_LOG_FMT(NETPLAY, "Invalid data chunk ID {}.", cid);
+      return;
+    }
+
+    auto& data_packet = data_packet_iter->second;
+    data_packet.append(data.data(), data.size());
+    progress = data_packet.getDataSize();
   }
 
-  INFO_LOG_FMT(NETPLAY, "Received {} bytes of data chunk {}.", data_packet.getDataSize(), cid);
+  INFO_LOG_FMT(NETPLAY, "Received {} bytes of data chunk {}.", progress, cid);
 
-  m_dialog->SetChunkedProgress(m_local_player->pid, data_packet.getDataSize());
+  m_dialog->SetChunkedProgress(m_local_player->pid, progress);
 
   sf::Packet progress_packet;
   progress_packet << MessageID::ChunkedDataProgress;
   progress_packet << cid;
-  progress_packet << u64{data_packet.getDataSize()};
+  progress_packet << progress;
   Send(progress_packet, CHUNKED_DATA_CHANNEL);
 }
 
@@ -611,6 +653,15 @@ void NetPlayClient::OnChunkedDataAbort(sf::Packet& packet)
   u32 cid;
   packet >> cid;
 
+  if (m_sync_save_data_chunk_id == cid)
+  {
+    INFO_LOG_FMT(NETPLAY, "Aborting save data chunk {}.", cid);
+
+    m_dialog->HideChunkedProgressDialog();
+    SyncSaveDataResponse(false);
+    return;
+  }
+
   const auto iter = m_chunked_data_receive_queue.find(cid);
   if (iter == m_chunked_data_receive_queue.end())
   {
@@ -674,20 +725,15 @@ void NetPlayClient::OnPadData(sf::Packet& packet)
     PadIndex map;
     packet >> map;
 
-    GCPadStatus pad;
-    packet >> pad.button;
-    if (static_cast<size_t>(map) < m_net_settings.gba_config.size() &&
-        !m_net_settings.gba_config.at(map).enabled)
-    {
-      packet >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >> pad.substickX >>
-          pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
-    }
+    if (static_cast<size_t>(map) >= m_input_received.pad.size())
+      break;
 
-    if (static_cast<size_t>(map) < m_pad_buffer.size())
-    {
-      m_pad_buffer.at(map).Push(pad);
-      m_gc_pad_event.Set();
-    }
+    SerializedInput& input = m_input_received.pad[map];
+    if (!DecodeInputDelta(packet, input))
+      break;
+
+    m_pad_buffer.at(map).Push(DeserializeGCPadStatus(input));
+    m_gc_pad_event.Set();
   }
 }
 
@@ -698,25 +744,19 @@ void NetPlayClient::OnPadHostData(sf::Packet& packet)
     PadIndex map;
     packet >> map;
 
-    GCPadStatus pad;
-    packet >> pad.button;
-    if (static_cast<size_t>(map) < m_net_settings.gba_config.size() &&
-        !m_net_settings.gba_config.at(map).enabled)
-    {
-      packet >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >> pad.substickX >>
-          pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
-    }
+    if (static_cast<size_t>(map) >= m_input_received.pad_host.size())
+      break;
 
-    if (static_cast<size_t>(map) < m_last_pad_status.size())
-      m_last_pad_status[map] = pad;
+    SerializedInput& input = m_input_received.pad_host[map];
+    if (!DecodeInputDelta(packet, input))
+      break;
+
+    m_last_pad_status[map] = DeserializeGCPadStatus(input);
 
-    if (static_cast<size_t>(map) < m_first_pad_status_received.size())
+    if (!m_first_pad_status_received[map])
     {
-      if (!m_first_pad_status_received[map])
-      {
-        m_first_pad_status_received[map] = true;
-        m_first_pad_status_received_event.Set();
-      }
+      m_first_pad_status_received[map] = true;
+      m_first_pad_status_received_event.Set();
     }
   }
 }
@@ -728,24 +768,20 @@ void NetPlayClient::OnWiimoteData(sf::Packet& packet)
     PadIndex map;
     packet >> map;
 
+    if (static_cast<size_t>(map) >= m_input_received.wiimote.size())
+      break;
+
+    SerializedInput& input = m_input_received.wiimote[map];
+    if (!DecodeInputDelta(packet, input))
+      break;
+
     WiimoteEmu::SerializedWiimoteState pad;
-    packet >> pad.length;
-    ASSERT(pad.length <= pad.data.size());
-    if (pad.length <= pad.data.size())
-    {
-      for (size_t i = 0; i < pad.length; ++i)
-        packet >> pad.data[i];
-    }
-    else
-    {
-      pad.length = 0;
-    }
+    ASSERT(input.length <= pad.data.size());
+    pad.length = std::min<u8>(input.length, static_cast<u8>(pad.data.size()));
+    std::copy_n(input.data.begin(), pad.length, pad.data.begin());
 
-    if (static_cast<size_t>(map) < m_wiimote_buffer.size())
-    {
-      m_wiimote_buffer.at(map).Push(pad);
-      m_wii_pad_event.Set();
-    }
+    m_wiimote_buffer.at(map).Push(pad);
+    m_wii_pad_event.Set();
   }
 }
 
@@ -1011,6 +1047,10 @@ void NetPlayClient::OnSyncSaveData(sf::Packet& packet)
 
   INFO_LOG_FMT(NETPLAY, "Processing OnSyncSaveData sub id: {}", static_cast<u8>(sub_id));
 
+  // The rest of a sync which already failed is ignored.
+  if (sub_id != SyncSaveDataID::Notify && !m_sync_save_data_receiver)
+    return;
+
   switch (sub_id)
   {
   case SyncSaveDataID::Notify:
@@ -1043,6 +1083,9 @@ void NetPlayClient::OnSyncSaveDataNotify(sf::Packet& packet)
 {
   packet >> m_sync_save_data_count;
   m_sync_save_data_success_count = 0;
+  m_sync_save_data_receiver = std::make_unique<SyncDataReceiver>();
+  m_sync_save_data_finalizers.clear();
+  m_sync_save_data_chunk_id.reset();
 
   INFO_LOG_FMT(NETPLAY, "Initializing wait for {} savegame chunks.", m_sync_save_data_count);
 
@@ -1079,14 +1122,8 @@ void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
 
   const std::string path = File::GetUserPath(D_GCUSER_IDX) + GC_MEMCARD_NETPLAY +
                            (is_slot_a ? "A." : "B.") + region + size_suffix + ".raw";
-  if (File::Exists(path) && !File::Delete(path))
-  {
-    PanicAlertFmtT("Failed to delete NetPlay memory card. Verify your write permissions.");
-    SyncSaveDataResponse(false);
-    return;
-  }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = m_sync_save_data_receiver->ReadFile(packet, path);
   SyncSaveDataResponse(success);
 }
 
@@ -1102,14 +1139,14 @@ void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
   INFO_LOG_FMT(NETPLAY, "Received GCI memcard data for slot {}: {}, {} files.",
                is_slot_a ? 'A' : 'B', path, file_count);
 
-  if ((File::Exists(path) && !File::DeleteDirRecursively(path + DIR_SEP)) ||
-      !File::CreateFullPath(path + DIR_SEP))
+  if (!File::CreateFullPath(path + DIR_SEP))
   {
     PanicAlertFmtT("Failed to reset NetPlay GCI folder. Verify your write permissions.");
     SyncSaveDataResponse(false);
     return;
   }
 
+  std::set<std::string> file_names;
   for (u8 i = 0; i < file_count; i++)
   {
     std::string file_name;
@@ -1118,77 +1155,102 @@ void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
     INFO_LOG_FMT(NETPLAY, "Received GCI: {}", file_name);
 
     if (!Common::IsFileNameSafe(file_name) ||
-        !DecompressPacketIntoFile(packet, path + DIR_SEP + file_name))
+        !m_sync_save_data_receiver->ReadFile(packet, path + DIR_SEP + file_name))
     {
       WARN_LOG_FMT(NETPLAY, "Received invalid GCI.");
       SyncSaveDataResponse(false);
       return;
     }
+    file_names.insert(file_name);
+  }
+
+  // Saves which are left over from a previous sync are removed, like ones the host doesn't have.
+  for (const File::FSTEntry& entry : File::ScanDirectoryTree(path, false).children)
+  {
+    if (file_names.contains(entry.virtualName))
+      continue;
+
+    if (entry.isDirectory ? !File::DeleteDirRecursively(entry.physicalName) :
+                            !File::Delete(entry.physicalName))
+    {
+      PanicAlertFmtT("Failed to reset NetPlay GCI folder. Verify your write permissions.");
+      SyncSaveDataResponse(false);
+      return;
+    }
   }
 
   SyncSaveDataResponse(true);
 }
 
+// Returns the contents of a file in the NAND of the previous sync, if it has the file.
+static std::optional<std::vector<u8>> ReadPreviousNandFile(IOS::HLE::FS::FileSystem* fs,
+                                                           const std::string& path)
+{
+  if (!fs)
+    return std::nullopt;
+
+  const auto file = fs->OpenFile(IOS::PID_KERNEL, IOS::PID_KERNEL, path, IOS::HLE::FS::Mode::Read);
+  if (!file)
+    return std::nullopt;
+
+  const auto status = file->GetStatus();
+  if (!status)
+    return std::nullopt;
+
+  std::vector<u8> data(status->size);
+  if (!file->Read(data.data(), data.size()))
+    return std::nullopt;
+  return data;
+}
+
 void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
 {
   const std::string path = File::GetUserPath(D_USER_IDX) + "Wii" GC_MEMCARD_NETPLAY DIR_SEP;
   std::string redirect_path = File::GetUserPath(D_USER_IDX) + "Redirect" GC_MEMCARD_NETPLAY DIR_SEP;
 
-  if (File::Exists(path) && !File::DeleteDirRecursively(path))
-  {
-    PanicAlertFmtT("Failed to reset NetPlay NAND folder. Verify your write permissions.");
-    SyncSaveDataResponse(false);
-    return;
-  }
-  if (File::Exists(redirect_path) && !File::DeleteDirRecursively(redirect_path))
-  {
-    PanicAlertFmtT("Failed to reset NetPlay redirect folder. Verify your write permissions.");
-    SyncSaveDataResponse(false);
-    return;
-  }
-
-  auto temp_fs = std::make_unique<IOS::HLE::FS::HostFileSystem>(path);
-  std::vector<u64> titles;
-
-  constexpr IOS::HLE::FS::Modes fs_modes{
-      IOS::HLE::FS::Mode::ReadWrite,
-      IOS::HLE::FS::Mode::ReadWrite,
-      IOS::HLE::FS::Mode::ReadWrite,
-  };
+  // The NAND of the previous sync is kept, so that the data which didn't change since then
+  // doesn't have to be sent again. It's replaced once all of the data has been received.
+  std::unique_ptr<IOS::HLE::FS::HostFileSystem> previous_fs;
+  if (File::IsDirectory(path))
+    previous_fs = std::make_unique<IOS::HLE::FS::HostFileSystem>(path);
 
   // Read the Mii data
+  std::optional<size_t> mii_buffer;
   bool mii_data;
   packet >> mii_data;
   if (mii_data)
   {
     INFO_LOG_FMT(NETPLAY, "Received Mii data.");
 
-    auto buffer = DecompressPacketIntoBuffer(packet);
-
-    temp_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL, "/shared2/menu/FaceLib/", 0,
-                            fs_modes);
-    auto file = temp_fs->CreateAndOpenFile(IOS::PID_KERNEL, IOS::PID_KERNEL,
-                                           Common::GetMiiDatabasePath(), fs_modes);
-
-    if (!buffer || !file || !file->Write(buffer->data(), buffer->size()))
+    mii_buffer = m_sync_save_data_receiver->ReadBuffer(
+        packet, ReadPreviousNandFile(previous_fs.get(), Common::GetMiiDatabasePath()));
+    if (!mii_buffer)
     {
-      PanicAlertFmtT("Failed to write Mii data.");
       SyncSaveDataResponse(false);
       return;
     }
   }
 
+  struct ReceivedSave
+  {
+    u64 title_id;
+    WiiSave::Header header;
+    WiiSave::BkHeader bk_header;
+    std::vector<WiiSave::Storage::SaveFile> files;
+    // The buffers with the data of the files, for those which are files.
+    std::vector<size_t> buffers;
+  };
+
   // Read the saves
+  std::vector<u64> titles;
+  std::vector<ReceivedSave> saves;
   u32 save_count;
   packet >> save_count;
   INFO_LOG_FMT(NETPLAY, "Received data for {} Wii saves.", save_count);
-  for (u32 n = 0; n < save_count; n++)
+  for (u32 n = 0; n < save_count && packet; n++)
   {
     u64 title_id = Common::PacketReadU64(packet);
     titles.push_back(title_id);
-    temp_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL,
-                            Common::GetTitleDataPath(title_id) + '/', 0, fs_modes);
-    auto save = WiiSave::MakeNandStorage(temp_fs.get(), title_id);
 
     bool exists;
     packet >> exists;
@@ -1200,8 +1262,11 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
 
     INFO_LOG_FMT(NETPLAY, "Received Wii save of title {:016x}.", title_id);
 
+    ReceivedSave& save = saves.emplace_back();
+    save.title_id = title_id;
+
     // Header
-    WiiSave::Header header;
+    WiiSave::Header& header = save.header;
     packet >> header.tid;
     packet >> header.banner_size;
     packet >> header.permissions;
@@ -1213,7 +1278,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
       packet >> header.banner[i];
 
     // BkHeader
-    WiiSave::BkHeader bk_header;
+    WiiSave::BkHeader& bk_header = save.bk_header;
     packet >> bk_header.size;
     packet >> bk_header.magic;
     packet >> bk_header.ngid;
@@ -1229,7 +1294,6 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
       packet >> byte;
 
     // Files
-    std::vector<WiiSave::Storage::SaveFile> files;
     for (u32 i = 0; i < bk_header.number_of_files; i++)
     {
       WiiSave::Storage::SaveFile file;
@@ -1240,43 +1304,113 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
       INFO_LOG_FMT(NETPLAY, "Received Wii save data of type {} at {}", static_cast<u8>(file.type),
                    file.path);
 
+      size_t buffer = 0;
       if (file.type == WiiSave::Storage::SaveFile::Type::File)
       {
-        auto buffer = DecompressPacketIntoBuffer(packet);
-        if (!buffer)
+        const std::optional<size_t> index = m_sync_save_data_receiver->ReadBuffer(
+            packet, ReadPreviousNandFile(previous_fs.get(),
+                                         Common::GetTitleDataPath(title_id) + '/' + file.path));
+        if (!index)
         {
           SyncSaveDataResponse(false);
           return;
         }
-
-        file.data = std::move(*buffer);
+        buffer = *index;
       }
 
-      files.push_back(std::move(file));
-    }
-
-    if (!save->WriteHeader(header) || !save->WriteBkHeader(bk_header) || !save->WriteFiles(files))
-    {
-      PanicAlertFmtT("Failed to write Wii save.");
-      SyncSaveDataResponse(false);
-      return;
+      save.files.push_back(std::move(file));
+      save.buffers.push_back(buffer);
     }
   }
 
   bool has_redirected_save;
   packet >> has_redirected_save;
+  if (!packet)
+  {
+    WARN_LOG_FMT(NETPLAY, "Received invalid Wii save data.");
+    SyncSaveDataResponse(false);
+    return;
+  }
+
+  previous_fs.reset();
+  if (File::Exists(path) && !File::DeleteDirRecursively(path))
+  {
+    PanicAlertFmtT("Failed to reset NetPlay NAND folder. Verify your write permissions.");
+    SyncSaveDataResponse(false);
+    return;
+  }
+
   if (has_redirected_save)
   {
     INFO_LOG_FMT(NETPLAY, "Received redirected save.");
-    if (!DecompressPacketIntoFolder(packet, redirect_path))
+    if (!m_sync_save_data_receiver->ReadFolder(packet, redirect_path))
     {
       PanicAlertFmtT("Failed to write redirected save.");
       SyncSaveDataResponse(false);
       return;
     }
   }
+  else if (File::Exists(redirect_path) && !File::DeleteDirRecursively(redirect_path))
+  {
+    PanicAlertFmtT("Failed to reset NetPlay redirect folder. Verify your write permissions.");
+    SyncSaveDataResponse(false);
+    return;
+  }
+
+  m_sync_save_data_finalizers.push_back([this, path, mii_buffer, titles = std::move(titles),
+                                         saves = std::move(saves),
+                                         redirect_path = std::move(redirect_path)]() mutable {
+    auto temp_fs = std::make_unique<IOS::HLE::FS::HostFileSystem>(path);
+
+    constexpr IOS::HLE::FS::Modes fs_modes{
+        IOS::HLE::FS::Mode::ReadWrite,
+        IOS::HLE::FS::Mode::ReadWrite,
+        IOS::HLE::FS::Mode::ReadWrite,
+    };
+
+    if (mii_buffer)
+    {
+      const std::vector<u8> buffer = m_sync_save_data_receiver->TakeBuffer(*mii_buffer);
+
+      temp_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL, "/shared2/menu/FaceLib/", 0,
+                              fs_modes);
+      auto file = temp_fs->CreateAndOpenFile(IOS::PID_KERNEL, IOS::PID_KERNEL,
+                                             Common::GetMiiDatabasePath(), fs_modes);
+
+      if (!file || !file->Write(buffer.data(), buffer.size()))
+      {
+        PanicAlertFmtT("Failed to write Mii data.");
+        return false;
+      }
+    }
+
+    for (const u64 title_id : titles)
+    {
+      temp_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL,
+                              Common::GetTitleDataPath(title_id) + '/', 0, fs_modes);
+    }
+
+    for (ReceivedSave& save : saves)
+    {
+      for (size_t i = 0; i < save.files.size(); i++)
+      {
+        if (save.files[i].type == WiiSave::Storage::SaveFile::Type::File)
+          save.files[i].data = m_sync_save_data_receiver->TakeBuffer(save.buffers[i]);
+      }
+
+      auto storage = WiiSave::MakeNandStorage(temp_fs.get(), save.title_id);
+      if (!storage->WriteHeader(save.header) || !storage->WriteBkHeader(save.bk_header) ||
+          !storage->WriteFiles(save.files))
+      {
+        PanicAlertFmtT("Failed to write Wii save.");
+        return false;
+      }
+    }
+
+    SetWiiSyncData(std::move(temp_fs), std::move(titles), std::move(redirect_path));
+    return true;
+  });
 
-  SetWiiSyncData(std::move(temp_fs), std::move(titles), std::move(redirect_path));
   SyncSaveDataResponse(true);
 }
 
@@ -1289,15 +1423,8 @@ void NetPlayClient::OnSyncSaveDataGBA(sf::Packet& packet)
 
   const std::string path =
       fmt::format("{}{}{}.sav", File::GetUserPath(D_GBAUSER_IDX), GBA_SAVE_NETPLAY, slot + 1);
-  if (File::Exists(path) && !File::Delete(path))
-  {
-    PanicAlertFmtT("Failed to delete NetPlay GBA{0} save file. Verify your write permissions.",
-                   slot + 1);
-    SyncSaveDataResponse(false);
-    return;
-  }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = m_sync_save_data_receiver->ReadFile(packet, path);
   SyncSaveDataResponse(success);
 }
 
@@ -1698,15 +1825,12 @@ void NetPlayClient::SendChatMessage(const std::string& msg)
 
 // called from ---CPU--- thread
 void NetPlayClient::AddPadStateToPacket(const int in_game_pad, const GCPadStatus& pad,
+                                        std::array<SerializedInput, 4>& previous,
                                         sf::Packet& packet)
 {
   packet << static_cast<PadIndex>(in_game_pad);
-  packet << pad.button;
-  if (!m_net_settings.gba_config[in_game_pad].enabled)
-  {
-    packet << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-           << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
-  }
+  EncodeInputDelta(SerializeGCPadStatus(pad, m_net_settings.gba_config[in_game_pad].enabled),
+                   previous[in_game_pad], packet);
 }
 
 // called from ---CPU--- thread
@@ -1714,10 +1838,12 @@ void NetPlayClient::AddWiimoteStateToPacket(int in_game_pad,
                                             const WiimoteEmu::SerializedWiimoteState& state,
                                             sf::Packet& packet)
 {
+  SerializedInput input;
+  input.length = state.length;
+  std::copy_n(state.data.begin(), state.length, input.data.begin());
+
   packet << static_cast<PadIndex>(in_game_pad);
-  packet << state.length;
-  for (size_t i = 0; i < state.length; ++i)
-    packet << state.data[i];
+  EncodeInputDelta(input, m_input_sent.wiimote[in_game_pad], packet);
 }
 
 // called from ---GUI--- thread
@@ -1790,20 +1916,10 @@ bool NetPlayClient::StartGame(const std::string& path)
                "Setting Wii sync data: has FS {}, sync_titles = {:016x}, redirect folder = {}",
                !!m_wii_sync_fs, fmt::join(m_wii_sync_titles, ", "), m_wii_sync_redirect_folder);
 
+  // The Wii save sync directories are kept, so that the next sync only has to send what changed --
+  // see OnSyncSaveDataWii()
   boot_session_data->SetWiiSyncData(std::move(m_wii_sync_fs), std::move(m_wii_sync_titles),
-                                    std::move(m_wii_sync_redirect_folder), [] {
-                                      // on emulation end clean up the Wii save sync directory --
-                                      // see OnSyncSaveDataWii()
-                                      const std::string wii_path = File::GetUserPath(D_USER_IDX) +
-                                                                   "Wii" GC_MEMCARD_NETPLAY DIR_SEP;
-                                      if (File::Exists(wii_path))
-                                        File::DeleteDirRecursively(wii_path);
-                                      const std::string redirect_path =
-                                          File::GetUserPath(D_USER_IDX) +
-                                          "Redirect" GC_MEMCARD_NETPLAY DIR_SEP;
-                                      if (File::Exists(redirect_path))
-                                        File::DeleteDirRecursively(redirect_path);
-                                    });
+                                    std::move(m_wii_sync_redirect_folder), {});
 
   m_net_settings.local_player_id = m_local_player->pid;
   boot_session_data->SetNetplaySettings(std::make_unique<NetPlay::NetSettings>(m_net_settings));
@@ -1815,28 +1931,56 @@ bool NetPlayClient::StartGame(const std::string& path)
 
 void NetPlayClient::SyncSaveDataResponse(const bool success)
 {
-  m_dialog->AppendChat(success ? Common::GetStringT("Data received!") :
-                                 Common::GetStringT("Error processing data."));
-
-  if (success)
+  if (!success)
   {
-    if (++m_sync_save_data_success_count >= m_sync_save_data_count)
-    {
-      sf::Packet response_packet;
-      response_packet << MessageID::SyncSaveData;
-      response_packet << SyncSaveDataID::Success;
-
-      Send(response_packet);
-    }
+    SendSyncSaveDataResult(false);
+    return;
   }
-  else
+
+  if (++m_sync_save_data_success_count < m_sync_save_data_count)
+    return;
+
+  if (m_sync_save_data_receiver->HasRequests())
   {
-    sf::Packet response_packet;
-    response_packet << MessageID::SyncSaveData;
-    response_packet << SyncSaveDataID::Failure;
+    // The host sends the requested data as chunked data, see OnChunkedDataStart()
+    INFO_LOG_FMT(NETPLAY, "Requesting {} bytes of save data.",
+                 m_sync_save_data_receiver->GetRequestedSize());
 
-    Send(response_packet);
+    sf::Packet request_packet;
+    request_packet << MessageID::SyncSaveData;
+    request_packet << SyncSaveDataID::Request;
+    m_sync_save_data_receiver->WriteRequest(request_packet);
+
+    Send(request_packet);
+    return;
   }
+
+  FinishSyncSaveData();
+}
+
+void NetPlayClient::FinishSyncSaveData()
+{
+  bool success = m_sync_save_data_receiver->IsComplete();
+  for (const auto& finalize : m_sync_save_data_finalizers)
+    success = success && finalize();
+
+  SendSyncSaveDataResult(success);
+}
+
+void NetPlayClient::SendSyncSaveDataResult(const bool success)
+{
+  m_sync_save_data_receiver.reset();
+  m_sync_save_data_finalizers.clear();
+  m_sync_save_data_chunk_id.reset();
+
+  m_dialog->AppendChat(success ? Common::GetStringT("Data received!") :
+                                 Common::GetStringT("Error processing data."));
+
+  sf::Packet response_packet;
+  response_packet << MessageID::SyncSaveData;
+  response_packet << (success ? SyncSaveDataID::Success : SyncSaveDataID::Failure);
+
+  Send(response_packet);
 }
 
 void NetPlayClient::SyncCodeResponse(const bool success)
@@ -2148,7 +2292,7 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
     if (m_local_player->pid != m_current_golfer)
     {
       // add to packet
-      AddPadStateToPacket(ingame_pad, pad_status, packet);
+      AddPadStateToPacket(ingame_pad, pad_status, m_input_sent.pad, packet);
       data_added = true;
     }
     else
@@ -2168,7 +2312,7 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
       m_pad_buffer[ingame_pad].Push(pad_status);
 
       // add to packet
-      AddPadStateToPacket(ingame_pad, pad_status, packet);
+      AddPadStateToPacket(ingame_pad, pad_status, m_input_sent.pad, packet);
       data_added = true;
     }
   }
@@ -2241,7 +2385,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
 
       const GCPadStatus& pad_status = m_last_pad_status[i];
       m_pad_buffer[i].Push(pad_status);
-      AddPadStateToPacket(static_cast<int>(i), pad_status, packet);
+      AddPadStateToPacket(static_cast<int>(i), pad_status, m_input_sent.pad_host, packet);
     }
   }
   else if (m_net_settings.pad_map[pad_num] != 0)
@@ -2258,7 +2402,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
     {
       const GCPadStatus& pad_status = m_last_pad_status[pad_num];
       m_pad_buffer[pad_num].Push(pad_status);
-      AddPadStateToPacket(pad_num, pad_status, packet);
+      AddPadStateToPacket(pad_num, pad_status, m_input_sent.pad_host, packet);
     }
   }
 
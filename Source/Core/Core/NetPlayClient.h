@@ -6,9 +6,11 @@
 #include <SFML/Network/Packet.hpp>
 #include <array>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
@@ -19,6 +21,7 @@
 #include "Common/Event.h"
 #include "Common/SPSCQueue.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
@@ -203,6 +206,10 @@ protected:
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
 
+  // Sent input is only accessed on the CPU thread, and received input on the network thread.
+  InputDeltaStates m_input_sent;
+  InputDeltaStates m_input_received;
+
   std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
 
   NetPlayUI* m_dialog = nullptr;
@@ -249,6 +256,8 @@ private:
   void SendStopGamePacket();
 
   void SyncSaveDataResponse(bool success);
+  void FinishSyncSaveData();
+  void SendSyncSaveDataResult(bool success);
   void SyncCodeResponse(bool success);
 
   bool PollLocalPad(int local_pad, sf::Packet& packet);
@@ -257,7 +266,8 @@ private:
   bool AddLocalWiimoteToBuffer(int local_wiimote, const WiimoteEmu::SerializedWiimoteState& state,
                                sf::Packet& packet);
 
-  void AddPadStateToPacket(int in_game_pad, const GCPadStatus& np, sf::Packet& packet);
+  void AddPadStateToPacket(int in_game_pad, const GCPadStatus& np,
+                           std::array<SerializedInput, 4>& previous, sf::Packet& packet);
   void AddWiimoteStateToPacket(int in_game_pad, const WiimoteEmu::SerializedWiimoteState& np,
                                sf::Packet& packet);
   void Send(const sf::Packet& packet, u8 channel_id = DEFAULT_CHANNEL);
@@ -330,6 +340,11 @@ private:
   Common::Event m_wait_on_input_event;
   u8 m_sync_save_data_count = 0;
   u8 m_sync_save_data_success_count = 0;
+  std::unique_ptr<SyncDataReceiver> m_sync_save_data_receiver;
+  // Run once all of the requested save data has been received.
+  std::vector<std::function<bool()>> m_sync_save_data_finalizers;
+  // The chunked data which is passed to the receiver as it arrives.
+  std::optional<u32> m_sync_save_data_chunk_id;
   u16 m_sync_gecko_codes_count = 0;
   u16 m_sync_gecko_codes_success_count = 0;
   bool m_sync_gecko_codes_complete = false;
@@ -4,91 +4,181 @@
 #include "Core/NetPlayCommon.h"
 
 #include <algorithm>
+#include <functional>
+#include <set>
+#include <thread>
 
 #include <fmt/format.h>
-#include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/FileUtil.h"
 #include "Common/HttpRequest.h"
-#include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
 
 namespace NetPlay
 {
-constexpr u32 LZO_IN_LEN = 1024 * 64;
-constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+namespace
+{
+// Each piece of requested data is compressed into its own zstd frame, so that the receiver knows
+// where one ends and the next begins without any framing of its own.
+constexpr size_t COMPRESSION_IN_LEN = 1024 * 1024;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+class StreamCompressor
 {
-  File::IOFile file(file_path, "rb");
-  if (!file)
+public:
+  explicit StreamCompressor(const SyncDataSender::WriteCallback& callback)
+      : m_context(ZSTD_createCCtx()), m_out_buffer(ZSTD_CStreamOutSize()), m_callback(callback)
   {
-    PanicAlertFmtT("Failed to open file \"{0}\".", file_path);
-    return false;
+    ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT);
+    // This fails harmlessly if zstd was built without multithreading support.
+    ZSTD_CCtx_setParameter(m_context, ZSTD_c_nbWorkers,
+                           static_cast<int>(std::thread::hardware_concurrency()));
   }
+  ~StreamCompressor() { ZSTD_freeCCtx(m_context); }
 
-  const u64 size = file.GetSize();
-  packet << size;
+  StreamCompressor(const StreamCompressor&) = delete;
+  StreamCompressor& operator=(const StreamCompressor&) = delete;
 
-  if (size == 0)
-    return true;
-
-  std::vector<u8> in_buffer(LZO_IN_LEN);
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
-
-  lzo_uint i = 0;
-  while (true)
+  bool Begin(u64 size)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
+    if (ZSTD_isError(ZSTD_CCtx_reset(m_context, ZSTD_reset_session_only)) ||
+        ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(m_context, size)))
     {
-      cur_len = static_cast<lzo_uint32>(size - i);
+      PanicAlertFmtT("Internal zstd error - compression failed");
+      return false;
     }
-    else
+    return true;
+  }
+
+  bool Compress(std::span<const u8> data, bool is_last)
+  {
+    ZSTD_inBuffer in_buffer{data.data(), data.size(), 0};
+    const ZSTD_EndDirective mode = is_last ? ZSTD_e_end : ZSTD_e_continue;
+    while (true)
     {
-      cur_len = LZO_IN_LEN;
+      ZSTD_outBuffer out_buffer{m_out_buffer.data(), m_out_buffer.size(), 0};
+      const size_t result = ZSTD_compressStream2(m_context, &out_buffer, &in_buffer, mode);
+      if (ZSTD_isError(result))
+      {
+        PanicAlertFmtT("Internal zstd error - compression failed");
+        return false;
+      }
+
+      if (out_buffer.pos != 0 && !m_callback(std::span(m_out_buffer).first(out_buffer.pos)))
+        return false;
+
+      if (is_last ? result == 0 : in_buffer.pos == in_buffer.size)
+        return true;
     }
+  }
+
+private:
+  ZSTD_CCtx* m_context;
+  std::vector<u8> m_out_buffer;
+  const SyncDataSender::WriteCallback& m_callback;
+};
+
+void WriteDigest(sf::Packet& packet, const Common::SHA1::Digest& digest)
+{
+  for (u8 byte : digest)
+    packet << byte;
+}
+
+Common::SHA1::Digest ReadDigest(sf::Packet& packet)
+{
+  Common::SHA1::Digest digest{};
+  for (u8& byte : digest)
+    packet >> byte;
+  return digest;
+}
 
-    if (cur_len <= 0)
-      break;  // EOF
+// Reads the file in pieces, passing each of them to the callback.
+bool ReadFileInPieces(const std::string& file_path, u64 size,
+                      const std::function<bool(std::span<const u8>, bool is_last)>& callback)
+{
+  File::IOFile file(file_path, "rb");
+  if (!file)
+  {
+    PanicAlertFmtT("Failed to open file \"{0}\".", file_path);
+    return false;
+  }
 
-    if (!file.ReadBytes(in_buffer.data(), cur_len))
+  std::vector<u8> buffer(std::min<u64>(size, COMPRESSION_IN_LEN));
+  u64 bytes_read = 0;
+  while (bytes_read < size)
+  {
+    const size_t cur_len = static_cast<size_t>(std::min<u64>(size - bytes_read, buffer.size()));
+    if (!file.ReadBytes(buffer.data(), cur_len))
     {
-      PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
+      PanicAlertFmtT("Error reading file: {0}", file_path);
       return false;
     }
+    bytes_read += cur_len;
 
-    if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
+    if (!callback(std::span(buffer).first(cur_len), bytes_read == size))
       return false;
-    }
+  }
 
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+  return true;
+}
 
-    if (cur_len != LZO_IN_LEN)
-      break;
+// Used by the receiver to find out whether it already has a file, so errors are not reported.
+std::optional<Common::SHA1::Digest> HashFile(const std::string& file_path, u64 size)
+{
+  File::IOFile file(file_path, "rb");
+  if (!file || file.GetSize() != size)
+    return std::nullopt;
 
-    i += cur_len;
+  auto context = Common::SHA1::CreateContext();
+  std::vector<u8> buffer(std::min<u64>(size, COMPRESSION_IN_LEN));
+  for (u64 bytes_read = 0; bytes_read < size;)
+  {
+    const size_t cur_len = static_cast<size_t>(std::min<u64>(size - bytes_read, buffer.size()));
+    if (!file.ReadBytes(buffer.data(), cur_len))
+      return std::nullopt;
+    context->Update(buffer.data(), cur_len);
+    bytes_read += cur_len;
   }
+  return context->Finish();
+}
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
+bool DeletePath(const std::string& path)
+{
+  if (!File::Exists(path))
+    return true;
+
+  if (File::IsDirectory(path) ? File::DeleteDirRecursively(path) : File::Delete(path))
+    return true;
+
+  PanicAlertFmtT("Failed to delete \"{0}\". Verify your write permissions.", path);
+  return false;
+}
+}  // namespace
+
+bool SyncDataSender::AddFile(const std::string& file_path, sf::Packet& packet)
+{
+  const u64 size = File::GetSize(file_path);
+  packet << size;
+
+  if (size == 0)
+    return true;
 
+  auto context = Common::SHA1::CreateContext();
+  if (!ReadFileInPieces(file_path, size, [&](std::span<const u8> data, bool) {
+        context->Update(data);
+        return true;
+      }))
+  {
+    return false;
+  }
+
+  WriteDigest(packet, context->Finish());
+  m_entries.push_back({size, file_path, {}});
   return true;
 }
 
-static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet)
+bool SyncDataSender::AddFolderInternal(const File::FSTEntry& folder, sf::Packet& packet)
 {
   const u64 size = folder.children.size();
   packet << size;
@@ -97,15 +187,15 @@ static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::P
     const bool is_folder = child.isDirectory;
     packet << child.virtualName;
     packet << is_folder;
-    const bool success = is_folder ? CompressFolderIntoPacketInternal(child, packet) :
-                                     CompressFileIntoPacket(child.physicalName, packet);
+    const bool success =
+        is_folder ? AddFolderInternal(child, packet) : AddFile(child.physicalName, packet);
     if (!success)
       return false;
   }
   return true;
 }
 
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet)
+bool SyncDataSender::AddFolder(const std::string& folder_path, sf::Packet& packet)
 {
   if (!File::IsDirectory(folder_path))
   {
@@ -114,135 +204,130 @@ bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet
   }
 
   packet << true;
-  return CompressFolderIntoPacketInternal(File::ScanDirectoryTree(folder_path, true), packet);
+  return AddFolderInternal(File::ScanDirectoryTree(folder_path, true), packet);
 }
 
-bool CompressBufferIntoPacket(std::span<const u8> in_buffer, sf::Packet& packet)
+void SyncDataSender::AddBuffer(std::vector<u8> buffer, sf::Packet& packet)
 {
-  const u64 size = in_buffer.size();
+  const u64 size = buffer.size();
   packet << size;
 
   if (size == 0)
-    return true;
-
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
-
-  lzo_uint i = 0;
-  while (true)
-  {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // end of buffer
-
-    if (lzo1x_1_compress(&in_buffer[i], cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
+    return;
 
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+  WriteDigest(packet, Common::SHA1::CalculateDigest(buffer));
+  m_entries.push_back({size, {}, std::move(buffer)});
+}
 
-    if (cur_len != LZO_IN_LEN)
-      break;
+std::optional<std::vector<bool>> SyncDataSender::ReadRequest(sf::Packet& packet) const
+{
+  u32 count;
+  packet >> count;
+  if (!packet || count != m_entries.size())
+    return std::nullopt;
 
-    i += cur_len;
+  std::vector<bool> requested(count);
+  for (u32 i = 0; i < count; ++i)
+  {
+    bool is_requested;
+    packet >> is_requested;
+    requested[i] = is_requested;
   }
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
+  if (!packet)
+    return std::nullopt;
+  return requested;
+}
 
-  return true;
+u64 SyncDataSender::GetSize(const std::vector<bool>& requested) const
+{
+  u64 size = 0;
+  for (size_t i = 0; i < m_entries.size(); ++i)
+  {
+    if (requested[i])
+      size += m_entries[i].size;
+  }
+  return size;
 }
 
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
+bool SyncDataSender::Compress(const std::vector<bool>& requested,
+                              const WriteCallback& callback) const
 {
-  const u64 file_size = Common::PacketReadU64(packet);
+  StreamCompressor compressor(callback);
+  for (size_t i = 0; i < m_entries.size(); ++i)
+  {
+    if (!requested[i])
+      continue;
 
-  if (file_size == 0)
-    return true;
+    const Entry& entry = m_entries[i];
+    if (!compressor.Begin(entry.size))
+      return false;
 
-  File::IOFile file(file_path, "wb");
-  if (!file)
-  {
-    PanicAlertFmtT("Failed to open file \"{0}\". Verify your write permissions.", file_path);
-    return false;
+    const bool success =
+        entry.file_path.empty() ?
+            compressor.Compress(entry.buffer, true) :
+            ReadFileInPieces(entry.file_path, entry.size,
+                             [&](std::span<const u8> data, bool is_last) {
+                               return compressor.Compress(data, is_last);
+                             });
+    if (!success)
+      return false;
   }
+  return true;
+}
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> out_buffer(LZO_IN_LEN);
-  u64 bytes_written = 0;
+class SyncDataReceiver::Decompressor
+{
+public:
+  Decompressor() : stream(ZSTD_createDStream()), out_buffer(ZSTD_DStreamOutSize()) {}
+  ~Decompressor() { ZSTD_freeDStream(stream); }
 
-  while (true)
-  {
-    u32 cur_len = 0;                       // number of bytes to read
-    lzo_uint new_len = out_buffer.size();  // output buffer capacity
+  Decompressor(const Decompressor&) = delete;
+  Decompressor& operator=(const Decompressor&) = delete;
 
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
+  ZSTD_DStream* stream;
+  std::vector<u8> out_buffer;
+  // A full output buffer means that zstd may have more data ready without any more input.
+  bool output_pending = false;
+};
 
-    if (cur_len > in_buffer.size())
-    {
-      PanicAlertFmt("LZO error - input is too large");
-      return false;
-    }
+SyncDataReceiver::SyncDataReceiver() : m_decompressor(std::make_unique<Decompressor>())
+{
+}
 
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
+SyncDataReceiver::~SyncDataReceiver() = default;
 
-    if (lzo1x_decompress_safe(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return false;
-    }
+bool SyncDataReceiver::ReadFile(sf::Packet& packet, const std::string& file_path)
+{
+  const u64 size = Common::PacketReadU64(packet);
+  if (!packet)
+    return false;
 
-    if (new_len > file_size - bytes_written)
-    {
-      PanicAlertFmtT("LZO error - output is too large");
-      return false;
-    }
+  if (size == 0)
+    return DeletePath(file_path);
 
-    if (!file.WriteBytes(out_buffer.data(), new_len))
-    {
-      PanicAlertFmtT("Error writing file: {0}", file_path);
-      return false;
-    }
+  const Common::SHA1::Digest digest = ReadDigest(packet);
+  if (!packet)
+    return false;
 
-    bytes_written += new_len;
-  }
+  const bool is_requested = HashFile(file_path, size) != digest;
+  if (is_requested && File::IsDirectory(file_path) && !DeletePath(file_path))
+    return false;
 
-  return bytes_written == file_size;
+  m_entries.push_back({size, digest, is_requested, file_path, 0});
+  return true;
 }
 
-static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::string& folder_path)
+bool SyncDataReceiver::ReadFolderInternal(sf::Packet& packet, const std::string& folder_path)
 {
+  if (File::Exists(folder_path) && !File::IsDirectory(folder_path) && !DeletePath(folder_path))
+    return false;
   if (!File::CreateFullPath(folder_path + "/"))
     return false;
 
-  u64 size;
-  packet >> size;
-  for (size_t i = 0; i < size; ++i)
+  const u64 size = Common::PacketReadU64(packet);
+  std::set<std::string> names;
+  for (u64 i = 0; i < size && packet; ++i)
   {
     std::string name;
     packet >> name;
@@ -258,82 +343,316 @@ static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::st
 
     bool is_folder;
     packet >> is_folder;
+    names.insert(name);
     std::string path = fmt::format("{}/{}", folder_path, name);
-    const bool success = is_folder ? DecompressPacketIntoFolderInternal(packet, path) :
-                                     DecompressPacketIntoFile(packet, path);
+    const bool success = is_folder ? ReadFolderInternal(packet, path) : ReadFile(packet, path);
     if (!success)
       return false;
   }
+  if (!packet)
+    return false;
+
+  // Remove what is left over from a previous sync.
+  for (const File::FSTEntry& child : File::ScanDirectoryTree(folder_path, false).children)
+  {
+    if (!names.contains(child.virtualName) && !DeletePath(child.physicalName))
+      return false;
+  }
   return true;
 }
 
-bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path)
+bool SyncDataReceiver::ReadFolder(sf::Packet& packet, const std::string& folder_path)
 {
   bool folder_existed;
   packet >> folder_existed;
+  if (!packet)
+    return false;
   if (!folder_existed)
-    return true;
-  return DecompressPacketIntoFolderInternal(packet, folder_path);
+    return DeletePath(folder_path);
+
+  return ReadFolderInternal(packet, folder_path);
 }
 
-std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
+std::optional<size_t> SyncDataReceiver::ReadBuffer(sf::Packet& packet,
+                                                   std::optional<std::vector<u8>> existing)
 {
   const u64 size = Common::PacketReadU64(packet);
+  if (!packet)
+    return std::nullopt;
 
-  std::vector<u8> out_buffer;
-
+  const size_t index = m_buffers.size();
+  m_buffers.emplace_back();
   if (size == 0)
-    return out_buffer;
+    return index;
+
+  const Common::SHA1::Digest digest = ReadDigest(packet);
+  if (!packet)
+    return std::nullopt;
+
+  const bool is_requested = !existing || existing->size() != size ||
+                            Common::SHA1::CalculateDigest(*existing) != digest;
+  if (!is_requested)
+    m_buffers[index] = std::move(*existing);
+
+  m_entries.push_back({size, digest, is_requested, {}, index});
+  return index;
+}
+
+bool SyncDataReceiver::HasRequests() const
+{
+  return std::ranges::any_of(m_entries, &Entry::requested);
+}
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> decompressed_buffer(LZO_IN_LEN);
+void SyncDataReceiver::WriteRequest(sf::Packet& packet) const
+{
+  packet << static_cast<u32>(m_entries.size());
+  for (const Entry& entry : m_entries)
+    packet << entry.requested;
+}
 
-  u64 decompressed_size = 0;
-  while (true)
+u64 SyncDataReceiver::GetRequestedSize() const
+{
+  u64 size = 0;
+  for (const Entry& entry : m_entries)
   {
-    u32 cur_len = 0;                                // number of bytes to read
-    lzo_uint new_len = decompressed_buffer.size();  // output buffer capacity
+    if (entry.requested)
+      size += entry.size;
+  }
+  return size;
+}
 
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
+bool SyncDataReceiver::Receive(std::span<const u8> data)
+{
+  Decompressor& decompressor = *m_decompressor;
+  ZSTD_inBuffer in_buffer{data.data(), data.size(), 0};
+  while (in_buffer.pos != in_buffer.size || decompressor.output_pending)
+  {
+    if (!m_current_entry && !BeginEntry())
+      return false;
 
-    if (cur_len > in_buffer.size())
+    ZSTD_outBuffer out_buffer{decompressor.out_buffer.data(), decompressor.out_buffer.size(), 0};
+    const size_t result = ZSTD_decompressStream(decompressor.stream, &out_buffer, &in_buffer);
+    if (ZSTD_isError(result))
     {
-      PanicAlertFmt("LZO error - input is too large");
-      return {};
+      PanicAlertFmtT("Internal zstd error - decompression failed");
+      return false;
     }
+    decompressor.output_pending = result != 0 && out_buffer.pos == out_buffer.size;
 
-    for (size_t j = 0; j < cur_len; j++)
+    if (!WriteEntry(std::span(decompressor.out_buffer).first(out_buffer.pos)))
+      return false;
+
+    // zstd returns 0 once a frame has been decompressed and flushed completely.
+    if (result == 0 && !EndEntry())
+      return false;
+  }
+  return true;
+}
+
+bool SyncDataReceiver::BeginEntry()
+{
+  while (m_next_entry < m_entries.size() && !m_entries[m_next_entry].requested)
+    ++m_next_entry;
+
+  if (m_next_entry == m_entries.size())
+  {
+    PanicAlertFmtT("zstd error - output is too large");
+    return false;
+  }
+
+  if (ZSTD_isError(ZSTD_DCtx_reset(m_decompressor->stream, ZSTD_reset_session_only)))
+  {
+    PanicAlertFmtT("Internal zstd error - decompression failed");
+    return false;
+  }
+
+  const Entry& entry = m_entries[m_next_entry];
+  if (!entry.file_path.empty() && !m_file.Open(entry.file_path, "wb"))
+  {
+    PanicAlertFmtT("Failed to open file \"{0}\". Verify your write permissions.", entry.file_path);
+    return false;
+  }
+
+  m_hash = Common::SHA1::CreateContext();
+  m_entry_received_size = 0;
+  m_current_entry = m_next_entry++;
+  return true;
+}
+
+bool SyncDataReceiver::WriteEntry(std::span<const u8> data)
+{
+  const Entry& entry = m_entries[*m_current_entry];
+  if (data.size() > entry.size - m_entry_received_size)
+  {
+    PanicAlertFmtT("zstd error - output is too large");
+    return false;
+  }
+
+  if (entry.file_path.empty())
+  {
+    std::vector<u8>& buffer = m_buffers[entry.buffer_index];
+    buffer.insert(buffer.end(), data.begin(), data.end());
+  }
+  else if (!m_file.WriteBytes(data.data(), data.size()))
+  {
+    PanicAlertFmtT("Error writing file: {0}", entry.file_path);
+    return false;
+  }
+
+  m_hash->Update(data);
+  m_entry_received_size += data.size();
+  m_received_size += data.size();
+  return true;
+}
+
+bool SyncDataReceiver::EndEntry()
+{
+  const Entry& entry = m_entries[*m_current_entry];
+  m_current_entry.reset();
+  m_file.Close();
+
+  if (m_entry_received_size != entry.size)
+  {
+    PanicAlertFmtT("zstd error - output size mismatch");
+    return false;
+  }
+
+  if (m_hash->Finish() != entry.digest)
+  {
+    PanicAlertFmtT("Received save data doesn't match the data which was sent.");
+    return false;
+  }
+
+  return true;
+}
+
+bool SyncDataReceiver::IsComplete() const
+{
+  return !m_current_entry &&
+         std::none_of(m_entries.begin() + m_next_entry, m_entries.end(),
+                      [](const Entry& entry) { return entry.requested; });
+}
+
+std::vector<u8> SyncDataReceiver::TakeBuffer(size_t index)
+{
+  return std::move(m_buffers[index]);
+}
+
+SerializedInput SerializeGCPadStatus(const GCPadStatus& pad, bool buttons_only)
+{
+  SerializedInput input;
+  input.data[0] = static_cast<u8>(pad.button);
+  input.data[1] = static_cast<u8>(pad.button >> 8);
+  input.length = 2;
+  if (buttons_only)
+    return input;
+
+  for (const u8 value : {pad.analogA, pad.analogB, pad.stickX, pad.stickY, pad.substickX,
+                         pad.substickY, pad.triggerLeft, pad.triggerRight})
+  {
+    input.data[input.length++] = value;
+  }
+  input.data[input.length++] = pad.isConnected;
+  return input;
+}
+
+GCPadStatus DeserializeGCPadStatus(const SerializedInput& input)
+{
+  GCPadStatus pad;
+  if (input.length < 2)
+    return pad;
+
+  pad.button = static_cast<u16>(input.data[0] | (input.data[1] << 8));
+  if (input.length < 11)
+    return pad;
+
+  pad.analogA = input.data[2];
+  pad.analogB = input.data[3];
+  pad.stickX = input.data[4];
+  pad.stickY = input.data[5];
+  pad.substickX = input.data[6];
+  pad.substickY = input.data[7];
+  pad.triggerLeft = input.data[8];
+  pad.triggerRight = input.data[9];
+  pad.isConnected = input.data[10] != 0;
+  return pad;
+}
+
+// The state is written as its length, followed by groups of up to 8 bytes. Each group starts with
+// a mask of the bytes which changed, followed by those bytes.
+void EncodeInputDelta(const SerializedInput& input, SerializedInput& previous, sf::Packet& packet)
+{
+  packet << input.length;
+  for (size_t base = 0; base < input.length; base += 8)
+  {
+    const size_t count = std::min<size_t>(8, input.length - base);
+    u8 mask = 0;
+    for (size_t i = 0; i < count; ++i)
     {
-      packet >> in_buffer[j];
+      if (input.data[base + i] != previous.data[base + i])
+        mask |= 1 << i;
     }
 
-    if (lzo1x_decompress_safe(in_buffer.data(), cur_len, decompressed_buffer.data(), &new_len,
-                              nullptr) != LZO_E_OK)
+    packet << mask;
+    for (size_t i = 0; i < count; ++i)
     {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return {};
+      if (mask & (1 << i))
+        packet << input.data[base + i];
     }
+  }
 
-    if (new_len > size - decompressed_size || new_len > out_buffer.max_size() - out_buffer.size())
+  // Bytes past the end of the input are left alone on both ends, so they stay in sync.
+  std::copy_n(input.data.begin(), input.length, previous.data.begin());
+  previous.length = input.length;
+}
+
+bool DecodeInputDelta(sf::Packet& packet, SerializedInput& previous)
+{
+  u8 length = 0;
+  packet >> length;
+  if (!packet || length > SerializedInput::MAX_SIZE)
+    return false;
+
+  for (size_t base = 0; base < length; base += 8)
+  {
+    const size_t count = std::min<size_t>(8, length - base);
+    u8 mask = 0;
+    packet >> mask;
+    for (size_t i = 0; i < count; ++i)
     {
-      PanicAlertFmtT("LZO error - output is too large");
-      return {};
+      if (mask & (1 << i))
+        packet >> previous.data[base + i];
     }
-
-    out_buffer.insert(out_buffer.end(), decompressed_buffer.begin(),
-                      decompressed_buffer.begin() + new_len);
-    decompressed_size += new_len;
   }
 
-  if (decompressed_size != size)
+  previous.length = length;
+  return static_cast<bool>(packet);
+}
+
+u32 GetAdaptivePadBufferSize(std::span<const u32> pings_ms)
+{
+  // Input travels from one player to another through the host, which takes half of the round trip
+  // time of each of them. The slowest pair of players decides the buffer size.
+  u32 highest = 0;
+  u32 second_highest = 0;
+  for (const u32 ping : pings_ms)
   {
-    PanicAlertFmtT("LZO error - output size mismatch");
-    return {};
+    if (ping > highest)
+    {
+      second_highest = highest;
+      highest = ping;
+    }
+    else if (ping > second_highest)
+    {
+      second_highest = ping;
+    }
   }
+  const u32 latency_ms = (highest + second_highest + 1) / 2;
 
-  return out_buffer;
+  // Many games poll the pads twice per frame, and each poll takes an entry from the buffer. One
+  // more entry is kept to absorb jitter.
+  constexpr u32 POLL_INTERVAL_MS = 1000 / 120;
+  return (latency_ms + POLL_INTERVAL_MS - 1) / POLL_INTERVAL_MS + 1;
 }
 
 std::string GetExternalIPAddress()
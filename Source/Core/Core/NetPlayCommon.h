@@ -5,13 +5,24 @@
 
 #include <SFML/Network/Packet.hpp>
 
+#include <array>
 #include <chrono>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/IOFile.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace File
+{
+struct FSTEntry;
+}
 
 namespace NetPlay
 {
@@ -22,10 +33,137 @@ constexpr std::chrono::milliseconds PEER_TIMEOUT = 30s;
 
 std::string GetExternalIPAddress();
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet);
-bool CompressBufferIntoPacket(std::span<const u8> in_buffer, sf::Packet& packet);
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
-bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
-std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+// Save data is synced in two steps, so that data a client already has isn't sent again. The sync
+// messages describe each file and buffer by its size and hash, after which each client requests
+// the data it doesn't have. That data is sent to the client as a single stream through the chunked
+// data channel, which is compressed while it is being sent and decompressed as it arrives.
+class SyncDataSender
+{
+public:
+  using WriteCallback = std::function<bool(std::span<const u8>)>;
+
+  // These describe the data in the packet. Empty files are described as missing files.
+  bool AddFile(const std::string& file_path, sf::Packet& packet);
+  bool AddFolder(const std::string& folder_path, sf::Packet& packet);
+  void AddBuffer(std::vector<u8> buffer, sf::Packet& packet);
+
+  // Returns which of the described data a client requested, or nothing if the request is invalid.
+  std::optional<std::vector<bool>> ReadRequest(sf::Packet& packet) const;
+  // Returns the size of the requested data before compression.
+  u64 GetSize(const std::vector<bool>& requested) const;
+  // Passes the stream of the requested data to the callback as it is compressed. Stops as soon as
+  // the callback returns false.
+  bool Compress(const std::vector<bool>& requested, const WriteCallback& callback) const;
+
+private:
+  struct Entry
+  {
+    u64 size;
+    // Buffers have no path.
+    std::string file_path;
+    std::vector<u8> buffer;
+  };
+
+  bool AddFolderInternal(const File::FSTEntry& folder, sf::Packet& packet);
+
+  std::vector<Entry> m_entries;
+};
+
+class SyncDataReceiver
+{
+public:
+  SyncDataReceiver();
+  ~SyncDataReceiver();
+
+  SyncDataReceiver(const SyncDataReceiver&) = delete;
+  SyncDataReceiver& operator=(const SyncDataReceiver&) = delete;
+
+  // These read the description of a file or folder from the packet, and request the data unless
+  // the file at the path already has it. Files the host doesn't have are deleted. They return
+  // false if the packet is invalid or the local files can't be updated.
+  bool ReadFile(sf::Packet& packet, const std::string& file_path);
+  bool ReadFolder(sf::Packet& packet, const std::string& folder_path);
+  // Requests the data unless it's the same as the existing data. Returns the index to pass to
+  // TakeBuffer, or nothing if the packet is invalid.
+  std::optional<size_t> ReadBuffer(sf::Packet& packet, std::optional<std::vector<u8>> existing);
+
+  bool HasRequests() const;
+  void WriteRequest(sf::Packet& packet) const;
+  // Returns the size of the requested data before compression.
+  u64 GetRequestedSize() const;
+  u64 GetReceivedSize() const { return m_received_size; }
+
+  // Decompresses the stream of the requested data as it arrives. Returns false if it is invalid.
+  bool Receive(std::span<const u8> data);
+  // Returns whether all of the requested data was received.
+  bool IsComplete() const;
+
+  // Only valid once all of the requested data was received.
+  std::vector<u8> TakeBuffer(size_t index);
+
+private:
+  struct Entry
+  {
+    u64 size;
+    Common::SHA1::Digest digest;
+    bool requested;
+    // Buffers have no path, and are written to m_buffers[buffer_index] instead.
+    std::string file_path;
+    size_t buffer_index;
+  };
+
+  class Decompressor;
+
+  bool ReadFolderInternal(sf::Packet& packet, const std::string& folder_path);
+  bool BeginEntry();
+  bool WriteEntry(std::span<const u8> data);
+  bool EndEntry();
+
+  std::vector<Entry> m_entries;
+  std::vector<std::vector<u8>> m_buffers;
+
+  std::unique_ptr<Decompressor> m_decompressor;
+  // The entry the stream is being decompressed into, and the one to look for requests from next.
+  std::optional<size_t> m_current_entry;
+  size_t m_next_entry = 0;
+  File::IOFile m_file;
+  std::unique_ptr<Common::SHA1::Context> m_hash;
+  u64 m_entry_received_size = 0;
+  u64 m_received_size = 0;
+};
+
+// A controller state as it is sent over the network.
+struct SerializedInput
+{
+  static constexpr size_t MAX_SIZE = 32;
+
+  std::span<const u8> GetData() const { return {data.data(), length}; }
+
+  u8 length = 0;
+  std::array<u8, MAX_SIZE> data{};
+};
+
+// GBAs only send their buttons.
+SerializedInput SerializeGCPadStatus(const GCPadStatus& pad, bool buttons_only);
+GCPadStatus DeserializeGCPadStatus(const SerializedInput& input);
+
+// Input is sent as the bytes which changed since the previous state sent for the same pad in the
+// same kind of message, as most of a controller state stays the same from one poll to the next.
+// Both ends of a connection keep track of the previous state, which stays in sync because
+// packets are delivered reliably and in order.
+void EncodeInputDelta(const SerializedInput& input, SerializedInput& previous, sf::Packet& packet);
+// Returns false if the packet is malformed. On success, previous holds the decoded state.
+bool DecodeInputDelta(sf::Packet& packet, SerializedInput& previous);
+
+// The previous state of each pad for every kind of message which carries input.
+struct InputDeltaStates
+{
+  std::array<SerializedInput, 4> pad;
+  std::array<SerializedInput, 4> pad_host;
+  std::array<SerializedInput, 4> wiimote;
+};
+
+// Returns the pad buffer size at which input from every player arrives in time, given the round
+// trip times of the players to the host.
+u32 GetAdaptivePadBufferSize(std::span<const u32> pings_ms);
 }  // namespace NetPlay
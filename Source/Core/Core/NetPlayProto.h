@@ -229,7 +229,9 @@ enum class SyncSaveDataID : u8
   RawData = 3,
   GCIData = 4,
   WiiData = 5,
-  GBAData = 6
+  GBAData = 6,
+  // Sent by a client once it has read all of the data messages, for the data it doesn't have.
+  Request = 7
 };
 
 enum class SyncCodeID : u8
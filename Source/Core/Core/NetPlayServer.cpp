@@ -11,6 +11,7 @@
 #include <mutex>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -22,6 +23,7 @@
 #include <fmt/ranges.h>
 
 #include "Common/CommonPaths.h"
+#include "Common/Contains.h"
 #include "Common/ENet.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
@@ -700,6 +702,36 @@ void NetPlayServer::AdjustPadBufferSize(unsigned int size)
   }
 }
 
+void NetPlayServer::SetAdaptivePadBuffer(const bool enable)
+{
+  std::lock_guard lkg(m_crit.game);
+
+  m_adaptive_pad_buffer = enable;
+  if (m_adaptive_pad_buffer)
+    UpdateAdaptivePadBuffer();
+}
+
+// called from ---NETPLAY--- thread and ---GUI--- thread
+void NetPlayServer::UpdateAdaptivePadBuffer()
+{
+  std::lock_guard lkg(m_crit.game);
+
+  if (!m_adaptive_pad_buffer || m_host_input_authority)
+    return;
+
+  std::lock_guard lkp(m_crit.players);
+  std::vector<u32> pings;
+  pings.reserve(m_players.size());
+  for (const auto& p : std::views::values(m_players))
+    pings.push_back(p.ping);
+
+  // Every change briefly stalls or skips input, so only shrink the buffer when the pings have
+  // clearly gone down.
+  const u32 size = GetAdaptivePadBufferSize(pings);
+  if (size > m_target_buffer_size || size + 1 < m_target_buffer_size)
+    AdjustPadBufferSize(size);
+}
+
 void NetPlayServer::SetHostInputAuthority(const bool enable)
 {
   std::lock_guard lkg(m_crit.game);
@@ -748,6 +780,17 @@ void NetPlayServer::SendChunked(sf::Packet&& packet, const PlayerId pid, const s
   m_chunked_data_event.Set();
 }
 
+void NetPlayServer::SendChunked(std::function<bool(const SyncDataSender::WriteCallback&)> producer,
+                                const u64 size, const PlayerId pid, const std::string& title)
+{
+  {
+    std::lock_guard lkq(m_crit.chunked_data_queue_write);
+    m_chunked_data_queue.Push(ChunkedDataQueueEntry{{}, pid, TargetMode::Only, title,
+                                                    std::move(producer), size});
+  }
+  m_chunked_data_event.Set();
+}
+
 void NetPlayServer::SendChunkedToClients(sf::Packet&& packet, const PlayerId skip_pid,
                                          const std::string& title)
 {
@@ -814,36 +857,22 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 
   case MessageID::PadData:
   {
+    // The input is decoded even if it is ignored, so that the previous states stay in sync.
+    if (!DecodeInputPacket(packet, player.input_received.pad))
+      return 1;
+
     // if this is pad data from the last game still being received, ignore it
     if (player.current_game != m_current_game)
       break;
 
-    sf::Packet spac;
-    spac << (m_host_input_authority ? MessageID::PadHostData : MessageID::PadData);
-
-    while (!packet.endOfPacket())
+    for (const PadIndex map : std::views::keys(m_relayed_input))
     {
-      PadIndex map;
-      packet >> map;
-
       // If the data is not from the correct player,
       // then disconnect them.
       if (!IsValidPadIndex(m_pad_map, map) || m_pad_map.at(map) != player.pid)
       {
         return 1;
       }
-
-      GCPadStatus pad;
-      packet >> pad.button;
-      spac << map << pad.button;
-      if (!m_gba_config.at(map).enabled)
-      {
-        packet >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >> pad.substickX >>
-            pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
-
-        spac << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-             << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
-      }
     }
 
     if (m_host_input_authority)
@@ -852,12 +881,12 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       if (m_current_golfer != 0)
       {
         if (const auto it = m_players.find(m_current_golfer); it != m_players.end())
-          Send(it->second.socket, spac);
+          SendInput(MessageID::PadHostData, it->second);
       }
     }
     else
     {
-      SendToClients(spac, player.pid);
+      SendInputToClients(MessageID::PadData, player.pid);
     }
   }
   break;
@@ -868,48 +897,24 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_current_golfer != 0 && player.pid != m_current_golfer)
       return 1;
 
-    sf::Packet spac;
-    spac << MessageID::PadData;
-
-    while (!packet.endOfPacket())
-    {
-      PadIndex map;
-      packet >> map;
-
-      if (!IsValidPadIndex(m_pad_map, map))
-        return 1;
-
-      GCPadStatus pad;
-      packet >> pad.button;
-      spac << map << pad.button;
-      if (!m_gba_config.at(map).enabled)
-      {
-        packet >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >> pad.substickX >>
-            pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
-
-        spac << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-             << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
-      }
-    }
+    if (!DecodeInputPacket(packet, player.input_received.pad_host))
+      return 1;
 
-    SendToClients(spac, player.pid);
+    SendInputToClients(MessageID::PadData, player.pid);
   }
   break;
 
   case MessageID::WiimoteData:
   {
+    if (!DecodeInputPacket(packet, player.input_received.wiimote))
+      return 1;
+
     // if this is Wiimote data from the last game still being received, ignore it
     if (player.current_game != m_current_game)
       break;
 
-    sf::Packet spac;
-    spac << MessageID::WiimoteData;
-
-    while (!packet.endOfPacket())
+    for (const auto& [map, input] : m_relayed_input)
     {
-      PadIndex map;
-      packet >> map;
-
       // If the data is not from the correct player,
       // then disconnect them.
       if (!IsValidPadIndex(m_wiimote_map, map) || m_wiimote_map.at(map) != player.pid)
@@ -917,20 +922,11 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         return 1;
       }
 
-      WiimoteEmu::SerializedWiimoteState pad;
-      packet >> pad.length;
-      if (pad.length > pad.data.size())
+      if (input.length > WiimoteEmu::SerializedWiimoteState{}.data.size())
         return 1;
-      for (size_t i = 0; i < pad.length; ++i)
-        packet >> pad.data[i];
-
-      spac << map;
-      spac << pad.length;
-      for (size_t i = 0; i < pad.length; ++i)
-        spac << pad.data[i];
     }
 
-    SendToClients(spac, player.pid);
+    SendInputToClients(MessageID::WiimoteData, player.pid);
   }
   break;
 
@@ -1001,6 +997,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_ping_key == ping_key)
     {
       player.ping = ping;
+      UpdateAdaptivePadBuffer();
     }
 
     sf::Packet spac;
@@ -1200,6 +1197,36 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     }
     break;
 
+    case SyncSaveDataID::Request:
+    {
+      std::shared_ptr<const SyncDataSender> sender;
+      {
+        std::lock_guard lkg(m_crit.game);
+        sender = m_save_data_sender;
+      }
+
+      // The request may be for an earlier sync, in which case the client is synced again anyway.
+      std::optional<std::vector<bool>> requested;
+      if (sender)
+        requested = sender->ReadRequest(packet);
+      if (!requested)
+      {
+        INFO_LOG_FMT(NETPLAY, "SyncSaveData: Ignoring invalid request from player {}.",
+                     player.pid);
+        break;
+      }
+
+      const u64 size = sender->GetSize(*requested);
+      INFO_LOG_FMT(NETPLAY, "SyncSaveData: Sending {} bytes of save data to player {}.", size,
+                   player.pid);
+      SendChunked(
+          [sender, requested = std::move(*requested)](const SyncDataSender::WriteCallback& write) {
+            return sender->Compress(requested, write);
+          },
+          size, player.pid, "Save Data Synchronization");
+    }
+    break;
+
     default:
       PanicAlertFmtT(
           "Unknown SYNC_SAVE_DATA message with id:{0} received from player:{1} Kicking player!",
@@ -1276,6 +1303,63 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   return 0;
 }
 
+static std::array<SerializedInput, 4>& GetInputStates(InputDeltaStates& states,
+                                                     MessageID message_id)
+{
+  switch (message_id)
+  {
+  case MessageID::PadHostData:
+    return states.pad_host;
+  case MessageID::WiimoteData:
+    return states.wiimote;
+  default:
+    return states.pad;
+  }
+}
+
+// Decodes the input entries of a packet into m_relayed_input.
+bool NetPlayServer::DecodeInputPacket(sf::Packet& packet, std::array<SerializedInput, 4>& previous)
+{
+  m_relayed_input.clear();
+  while (!packet.endOfPacket())
+  {
+    PadIndex map;
+    packet >> map;
+
+    if (!IsValidPadIndex(previous, map) || !DecodeInputDelta(packet, previous[map]))
+      return false;
+
+    m_relayed_input.emplace_back(map, previous[map]);
+  }
+  return true;
+}
+
+// The input is encoded separately for every recipient, as they have each been sent different
+// previous states.
+void NetPlayServer::SendInput(const MessageID message_id, Client& recipient)
+{
+  std::array<SerializedInput, 4>& previous = GetInputStates(recipient.input_sent, message_id);
+
+  sf::Packet spac;
+  spac << message_id;
+  for (const auto& [map, input] : m_relayed_input)
+  {
+    spac << map;
+    EncodeInputDelta(input, previous[map], spac);
+  }
+
+  Send(recipient.socket, spac);
+}
+
+void NetPlayServer::SendInputToClients(const MessageID message_id, const PlayerId skip_pid)
+{
+  for (auto& p : std::views::values(m_players))
+  {
+    if (p.pid && p.pid != skip_pid)
+      SendInput(message_id, p);
+  }
+}
+
 void NetPlayServer::OnTraversalStateChanged()
 {
   const Common::TraversalClient::State state = m_traversal_client->GetState();
@@ -1839,6 +1923,11 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
   if (sync_info.save_count == 0)
     return true;
 
+  // The data messages only describe the save data. Each client requests the data it doesn't
+  // already have once it has read all of them.
+  auto sender = std::make_shared<SyncDataSender>();
+  std::vector<sf::Packet> packets;
+
   const auto game_region = sync_info.game->GetRegion();
   const auto gamecube_region = Config::ToGameCubeRegion(game_region);
   const std::string region = Config::GetDirectoryForRegion(gamecube_region);
@@ -1865,7 +1954,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of raw memcard {} in slot {}.", path,
                      is_slot_a ? 'A' : 'B');
-        if (!CompressFileIntoPacket(path, pac))
+        if (!sender->AddFile(path, pac))
           return false;
       }
       else
@@ -1876,8 +1965,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << u64{0};
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("Memory Card {} Synchronization", is_slot_a ? 'A' : 'B'));
+      packets.push_back(std::move(pac));
     }
     else if (Config::Get(Config::GetInfoForEXIDevice(slot)) ==
              ExpansionInterface::EXIDeviceType::MemoryCardFolder)
@@ -1904,7 +1992,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           const std::string filename = file.substr(file.find_last_of('/') + 1);
           INFO_LOG_FMT(NETPLAY, "Sending GCI {}.", filename);
           pac << filename;
-          if (!CompressFileIntoPacket(file, pac))
+          if (!sender->AddFile(file, pac))
             return false;
         }
       }
@@ -1916,8 +2004,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << static_cast<u8>(0);
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("GCI Folder {} Synchronization", is_slot_a ? 'A' : 'B'));
+      packets.push_back(std::move(pac));
     }
   }
 
@@ -1932,8 +2019,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
     {
       INFO_LOG_FMT(NETPLAY, "Sending Mii data.");
       pac << true;
-      if (!CompressBufferIntoPacket(*sync_info.mii_data, pac))
-        return false;
+      sender->AddBuffer(*sync_info.mii_data, pac);
     }
     else
     {
@@ -1993,8 +2079,9 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           if (file.type == WiiSave::Storage::SaveFile::Type::File)
           {
             const std::optional<std::vector<u8>>& data = *file.data;
-            if (!data || !CompressBufferIntoPacket(*data, pac))
+            if (!data)
               return false;
+            sender->AddBuffer(*data, pac);
           }
         }
       }
@@ -2010,7 +2097,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       INFO_LOG_FMT(NETPLAY, "Sending redirected save at {}.",
                    sync_info.redirected_save->m_target_path);
       pac << true;
-      if (!CompressFolderIntoPacket(sync_info.redirected_save->m_target_path, pac))
+      if (!sender->AddFolder(sync_info.redirected_save->m_target_path, pac))
         return false;
     }
     else
@@ -2019,7 +2106,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       pac << false;  // no redirected save
     }
 
-    SendChunkedToClients(std::move(pac), 1, "Wii Save Synchronization");
+    packets.push_back(std::move(pac));
   }
 
   for (size_t i = 0; i < m_gba_config.size(); ++i)
@@ -2039,7 +2126,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       if (File::Exists(path))
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of GBA save at {} for slot {}.", path, i);
-        if (!CompressFileIntoPacket(path, pac))
+        if (!sender->AddFile(path, pac))
           return false;
       }
       else
@@ -2049,11 +2136,19 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << u64{0};
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("GBA{} Save File Synchronization", i + 1));
+      packets.push_back(std::move(pac));
     }
   }
 
+  {
+    std::lock_guard lkg(m_crit.game);
+    m_save_data_sender = std::move(sender);
+  }
+
+  // send these on the chunked data channel to ensure they're sequenced properly
+  for (sf::Packet& pac : packets)
+    SendAsyncToClients(std::move(pac), 1, CHUNKED_DATA_CHANNEL);
+
   return true;
 }
 
@@ -2434,6 +2529,8 @@ void NetPlayServer::ChunkedDataThreadFunc()
         break;
       auto& e = m_chunked_data_queue.Front();
       const u32 id = m_next_chunked_data_id++;
+      const bool is_save_data_stream = static_cast<bool>(e.producer);
+      const u64 data_size = is_save_data_stream ? e.producer_size : e.packet.getDataSize();
 
       m_chunked_data_complete_count[id] = 0;
       size_t player_count;
@@ -2458,12 +2555,13 @@ void NetPlayServer::ChunkedDataThreadFunc()
 
         sf::Packet pac;
         pac << MessageID::ChunkedDataStart;
-        pac << id << e.title << u64{e.packet.getDataSize()};
+        pac << id << e.title << data_size << is_save_data_stream;
 
         ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
 
-        if (e.target_mode == TargetMode::AllExcept && e.target_pid == 1)
-          m_dialog->ShowChunkedProgressDialog(e.title, e.packet.getDataSize(), players);
+        // The host's own client shows its progress if it is one of the targets.
+        if (!Common::Contains(players, 1))
+          m_dialog->ShowChunkedProgressDialog(e.title, data_size, players);
       }
 
       const bool enable_limit = Config::Get(Config::NETPLAY_ENABLE_CHUNKED_UPLOAD_LIMIT);
@@ -2471,52 +2569,87 @@ void NetPlayServer::ChunkedDataThreadFunc()
           (std::max(Config::Get(Config::NETPLAY_CHUNKED_UPLOAD_LIMIT), 1u) / 8.0f) * 1024.0f;
       const std::chrono::duration<double> send_interval(CHUNKED_DATA_UNIT_SIZE / bytes_per_second);
       bool skip_wait = false;
-      size_t index = 0;
-      do
-      {
-        if (!m_do_loop)
-          return;
-        if (m_abort_chunked_data)
+      bool stopped = false;
+      u64 bytes_sent = 0;
+
+      // Returns false once the data shouldn't be sent anymore.
+      const auto send_units = [&](std::span<const u8> data) {
+        while (!data.empty())
         {
-          INFO_LOG_FMT(NETPLAY, "Informing players of data chunk {} abort.", id);
+          if (!m_do_loop || m_abort_chunked_data)
+          {
+            stopped = true;
+            return false;
+          }
+          if (e.target_mode == TargetMode::Only)
+          {
+            if (!m_players.contains(e.target_pid))
+            {
+              skip_wait = true;
+              stopped = true;
+              return false;
+            }
+          }
+
+          auto start = std::chrono::steady_clock::now();
 
           sf::Packet pac;
-          pac << MessageID::ChunkedDataAbort;
+          pac << MessageID::ChunkedDataPayload;
           pac << id;
+          const size_t len = std::min(CHUNKED_DATA_UNIT_SIZE, data.size());
+          pac.append(data.data(), len);
+
+          INFO_LOG_FMT(NETPLAY, "Sending data chunk of {} ({} bytes at {}).", id, len, bytes_sent);
+
           ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
-          break;
-        }
-        if (e.target_mode == TargetMode::Only)
-        {
-          if (!m_players.contains(e.target_pid))
+          data = data.subspan(len);
+          bytes_sent += len;
+
+          if (enable_limit)
           {
-            skip_wait = true;
-            break;
+            std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
+            std::this_thread::sleep_for(send_interval - delta);
           }
         }
+        return true;
+      };
 
-        auto start = std::chrono::steady_clock::now();
+      bool success;
+      if (is_save_data_stream)
+      {
+        // Only whole units are sent while the data is being produced.
+        std::vector<u8> pending;
+        success = e.producer([&](std::span<const u8> data) {
+          pending.insert(pending.end(), data.begin(), data.end());
+          const size_t full_size = pending.size() - pending.size() % CHUNKED_DATA_UNIT_SIZE;
+          if (!send_units(std::span(pending).first(full_size)))
+            return false;
+          pending.erase(pending.begin(), pending.begin() + full_size);
+          return true;
+        });
+        success = success && send_units(pending);
+      }
+      else
+      {
+        success = send_units({static_cast<const u8*>(e.packet.getData()), e.packet.getDataSize()});
+      }
 
-        sf::Packet pac;
-        pac << MessageID::ChunkedDataPayload;
-        pac << id;
-        size_t len = std::min(CHUNKED_DATA_UNIT_SIZE, e.packet.getDataSize() - index);
-        pac.append(static_cast<const u8*>(e.packet.getData()) + index, len);
+      if (!m_do_loop)
+        return;
 
-        INFO_LOG_FMT(NETPLAY, "Sending data chunk of {} ({} bytes at {}/{}).", id, len, index,
-                     e.packet.getDataSize());
+      if (m_abort_chunked_data || (!success && !stopped))
+      {
+        INFO_LOG_FMT(NETPLAY, "Informing players of data chunk {} abort.", id);
 
+        sf::Packet pac;
+        pac << MessageID::ChunkedDataAbort;
+        pac << id;
         ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
-        index += CHUNKED_DATA_UNIT_SIZE;
-
-        if (enable_limit)
-        {
-          std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
-          std::this_thread::sleep_for(send_interval - delta);
-        }
-      } while (index < e.packet.getDataSize());
 
-      if (!m_abort_chunked_data)
+        // Players don't report the completion of aborted data.
+        skip_wait = true;
+      }
+      else
       {
         INFO_LOG_FMT(NETPLAY, "Informing players of data chunk {} end.", id);
 
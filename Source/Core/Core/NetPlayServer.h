@@ -5,19 +5,24 @@
 
 #include <SFML/Network/Packet.hpp>
 
+#include <array>
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "Common/Event.h"
 #include "Common/QoSSession.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "UICommon/NetPlayIndex.h"
@@ -35,6 +40,10 @@ public:
   void SendAsyncToClients(sf::Packet&& packet, PlayerId skip_pid = 0,
                           u8 channel_id = DEFAULT_CHANNEL);
   void SendChunked(sf::Packet&& packet, PlayerId pid, const std::string& title = "");
+  // Sends save data which the producer writes on the chunked data thread while it is being sent,
+  // so the client can handle it as it arrives. The size is that of the data before compression.
+  void SendChunked(std::function<bool(const SyncDataSender::WriteCallback&)> producer, u64 size,
+                   PlayerId pid, const std::string& title);
   void SendChunkedToClients(sf::Packet&& packet, PlayerId skip_pid = 0,
                             const std::string& title = "");
 
@@ -63,6 +72,7 @@ public:
   void SetWiimoteMapping(const PadMappingArray& mappings);
 
   void AdjustPadBufferSize(unsigned int size);
+  void SetAdaptivePadBuffer(bool enable);
   void SetHostInputAuthority(bool enable);
 
   void KickPlayer(PlayerId player);
@@ -91,6 +101,9 @@ private:
 
     Common::QoSSession qos_session;
 
+    InputDeltaStates input_received;
+    InputDeltaStates input_sent;
+
     bool operator==(const Client& other) const { return this == &other; }
     bool IsHost() const { return pid == 1; }
   };
@@ -115,6 +128,9 @@ private:
     PlayerId target_pid{};
     TargetMode target_mode{};
     std::string title;
+    // Set instead of the packet for save data, which is sent as it is produced.
+    std::function<bool(const SyncDataSender::WriteCallback&)> producer;
+    u64 producer_size = 0;
   };
 
   bool SetupNetSettings();
@@ -136,6 +152,10 @@ private:
   ConnectionError OnConnect(ENetPeer* socket, sf::Packet& received_packet);
   unsigned int OnDisconnect(const Client& player);
   unsigned int OnData(sf::Packet& packet, Client& player);
+  bool DecodeInputPacket(sf::Packet& packet, std::array<SerializedInput, 4>& previous);
+  void SendInput(MessageID message_id, Client& recipient);
+  void SendInputToClients(MessageID message_id, PlayerId skip_pid);
+  void UpdateAdaptivePadBuffer();
 
   void OnTraversalStateChanged() override;
   void OnConnectReady(ENetAddress) override {}
@@ -167,10 +187,13 @@ private:
   bool m_update_pings = false;
   u32 m_current_game = 0;
   unsigned int m_target_buffer_size = 0;
+  bool m_adaptive_pad_buffer = false;
   PadMappingArray m_pad_map;
   GBAConfigArray m_gba_config;
   PadMappingArray m_wiimote_map;
   unsigned int m_save_data_synced_players = 0;
+  // The save data of the current sync, which is sent to each client as it requests it.
+  std::shared_ptr<const SyncDataSender> m_save_data_sender;
   unsigned int m_codes_synced_players = 0;
   bool m_saves_synced = true;
   bool m_codes_synced = true;
@@ -180,6 +203,8 @@ private:
   PlayerId m_pending_golfer = 0;
 
   std::map<PlayerId, Client> m_players;
+  // The input entries of the packet being relayed, only used on the network thread.
+  std::vector<std::pair<PadIndex, SerializedInput>> m_relayed_input;
 
   std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
   bool m_desync_detected = false;
@@ -10,6 +10,7 @@
 #include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Metrics.h"
 #include "Common/Thread.h"
 
 #include "Core/CPUThreadConfigCallback.h"
@@ -91,8 +92,12 @@ const u8* JitBase::Dispatch(JitBase& jit)
   return jit.GetBlockCache()->Dispatch();
 }
 
+static Common::Metrics::Counter s_compile_time{"jit_compile_time_ns_total",
+                                               "Time spent compiling JIT blocks, in nanoseconds"};
+
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  Common::Metrics::ScopedTimer timer(s_compile_time);
   jit.Jit(em_address);
 }
 
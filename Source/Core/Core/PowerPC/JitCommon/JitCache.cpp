@@ -15,6 +15,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
+#include "Common/Metrics.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/Host.h"
@@ -29,6 +30,14 @@
 
 using namespace Gen;
 
+static Common::Metrics::Counter s_blocks_compiled{"jit_blocks_compiled_total",
+                                                  "JIT blocks compiled"};
+static Common::Metrics::Gauge s_blocks{"jit_blocks", "JIT blocks currently in the block cache"};
+static Common::Metrics::Counter s_cache_clears{"jit_cache_clears_total",
+                                               "Times the JIT block cache was cleared"};
+static Common::Metrics::Counter s_icache_invalidations{
+    "jit_icache_invalidations_total", "Instruction cache invalidations seen by the JIT"};
+
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
   return physical_addresses.overlaps(address, address + length);
@@ -94,6 +103,9 @@ void JitBaseBlockCache::Clear()
 
   if (m_entry_points_ptr)
     m_entry_points_arena.Clear();
+
+  s_cache_clears.Add();
+  s_blocks.Set(0);
 }
 
 void JitBaseBlockCache::Reset()
@@ -158,6 +170,8 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   block.fast_block_map_index = index;
 
   block.physical_addresses = code_block.m_physical_addresses;
+  s_blocks_compiled.Add();
+  s_blocks.Set(static_cast<double>(block_map.size()));
 
   block.originalSize = code_block.m_num_instructions;
   if (m_jit.IsDebuggingEnabled())
@@ -275,6 +289,8 @@ void JitBaseBlockCache::InvalidateICacheLine(u32 address)
 
 void JitBaseBlockCache::InvalidateICache(u32 initial_address, u32 initial_length, bool forced)
 {
+  s_icache_invalidations.Add();
+
   u32 address = initial_address;
   u32 length = initial_length;
   while (length > 0)
@@ -400,6 +416,8 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
     else
       start++;
   }
+
+  s_blocks.Set(static_cast<double>(block_map.size()));
 }
 
 void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
@@ -420,6 +438,7 @@ void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 
   DestroyBlock(mutable_block);
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
+  s_blocks.Set(static_cast<double>(block_map.size()));
 }
 
 u32* JitBaseBlockCache::GetBlockBitSet() const
@@ -221,7 +221,7 @@ static bool CheckIfStateLoadIsAllowed(Core::System& system)
   return true;
 }
 
-static bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
+bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
 {
   u8* ptr = buffer.data();
   PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
@@ -229,8 +229,7 @@ static bool LoadFromBuffer(Core::System& system, std::span<u8> buffer)
   return p.IsReadMode();
 }
 
-// Returns the required size, or 0 on failure.
-static std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
   // Attempt to save to our provided buffer as-is.
   // If buffer isn't large enough, PointerWrap transitions to MeasureMode,
@@ -448,7 +447,7 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
 
   auto& movie = system.GetMovie();
   if ((movie.IsMovieActive()) && !movie.IsJustStartingRecordingInputFromSaveState())
-    movie.SaveRecording(dtmname);
+    movie.SaveRecording(dtmname, false);
   else if (!movie.IsMovieActive())
     File::Delete(dtmname);
 
@@ -807,22 +806,28 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
   ret_data.swap(buffer);
 }
 
+// Save temp buffer for undo load state
+static void SaveUndoLoadState(Core::System& system)
+{
+  auto& movie = system.GetMovie();
+  if (movie.IsJustStartingRecordingInputFromSaveState())
+    return;
+
+  SaveToBuffer(system, s_undo_load_buffer);
+  const std::string dtmpath = File::GetUserPath(D_STATESAVES_IDX) + "undo.dtm";
+  if (movie.IsMovieActive())
+    movie.SaveRecording(dtmpath, false);
+  else if (File::Exists(dtmpath))
+    File::Delete(dtmpath);
+}
+
 static void LoadAsFromCore(Core::System& system, std::string filename)
 {
   // Ensure all data has reached the filesystem before trying to use it.
   s_compress_and_dump_thread.WaitForCompletion();
 
-  // Save temp buffer for undo load state
+  SaveUndoLoadState(system);
   auto& movie = system.GetMovie();
-  if (!movie.IsJustStartingRecordingInputFromSaveState())
-  {
-    SaveToBuffer(system, s_undo_load_buffer);
-    const std::string dtmpath = File::GetUserPath(D_STATESAVES_IDX) + "undo.dtm";
-    if (movie.IsMovieActive())
-      movie.SaveRecording(dtmpath);
-    else if (File::Exists(dtmpath))
-      File::Delete(dtmpath);
-  }
 
   bool was_file_read = false;
   bool loaded_successfully = false;
@@ -869,6 +874,25 @@ static void LoadAsFromCore(Core::System& system, std::string filename)
     s_on_after_load_callback();
 }
 
+bool LoadFromMemory(Core::System& system, std::span<u8> buffer)
+{
+  if (!CheckIfStateLoadIsAllowed(system))
+    return false;
+
+  SaveUndoLoadState(system);
+  const bool loaded_successfully = LoadFromBuffer(system, buffer);
+  if (!loaded_successfully)
+  {
+    // since we could be in an inconsistent state now (and might crash or whatever), undo.
+    UndoLoadState(system);
+  }
+
+  if (s_on_after_load_callback)
+    s_on_after_load_callback();
+
+  return loaded_successfully;
+}
+
 void LoadAs(Core::System& system, std::string filename)
 {
   if (!CheckIfStateLoadIsAllowed(system))
@@ -879,6 +903,11 @@ void LoadAs(Core::System& system, std::string filename)
   });
 }
 
+u32 GetVersion()
+{
+  return STATE_VERSION;
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
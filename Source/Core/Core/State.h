@@ -7,9 +7,11 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <type_traits>
 
+#include "Common/Buffer.h"
 #include "Common/CommonTypes.h"
 
 namespace Core
@@ -103,6 +105,19 @@ void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Loads a state from memory the way LoadAs loads one from a file: the current state is kept for
+// UndoLoadState, and restored if the state can't be loaded. Must be called on the CPU thread.
+bool LoadFromMemory(Core::System& system, std::span<u8> buffer);
+
+// These save the state to and load it from memory, without any headers or compression.
+// They must be called on the CPU thread. SaveToBuffer grows the buffer if it is too small,
+// and returns the size of the state, or 0 on failure.
+std::size_t SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
+bool LoadFromBuffer(Core::System& system, std::span<u8> buffer);
+
+// The version of the state format. States can only be loaded by builds with the same version.
+u32 GetVersion();
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
@@ -0,0 +1,148 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include <picojson.h>
+
+#include "Common/Config/Config.h"
+#include "Common/JsonUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+#include "VideoCommon/StageTimer.h"
+
+namespace
+{
+double ToMilliseconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+FifoBenchmark::FifoBenchmark(Core::System& system, Options options)
+    : m_system(system), m_options(std::move(options))
+{
+  // Run as fast as possible, and make sure playback ends.
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+
+  auto& fifo_player = m_system.GetFifoPlayer();
+  fifo_player.SetLoopLimit(std::max<u32>(m_options.loops, 1));
+  fifo_player.SetFileLoadedCallback([this] { OnFileLoaded(); });
+  fifo_player.SetFrameWrittenCallback([this] { OnFrameWritten(); });
+}
+
+FifoBenchmark::~FifoBenchmark()
+{
+  VideoCommon::StageTimer::SetEnabled(false);
+
+  auto& fifo_player = m_system.GetFifoPlayer();
+  fifo_player.SetLoopLimit(0);
+  fifo_player.SetFileLoadedCallback({});
+  fifo_player.SetFrameWrittenCallback({});
+}
+
+void FifoBenchmark::OnFileLoaded()
+{
+  auto& fifo_player = m_system.GetFifoPlayer();
+  if (fifo_player.GetFile() == nullptr)
+    return;
+
+  // The end has to be set first, as setting the start clamps the end.
+  fifo_player.SetFrameRangeEnd(m_options.last_frame.value_or(fifo_player.GetFrameRangeEnd()));
+  fifo_player.SetFrameRangeStart(m_options.first_frame);
+
+  m_first_frame = fifo_player.GetFrameRangeStart();
+  m_last_frame = fifo_player.GetFrameRangeEnd();
+
+  // Nothing has been played back yet, so the GPU is idle.
+  VideoCommon::StageTimer::Reset();
+}
+
+void FifoBenchmark::OnFrameWritten()
+{
+  if (m_finished)
+    return;
+
+  // This is called right before each frame is written. Measuring from the first call to the
+  // latest one covers exactly the frames written in between, and leaves out shutting down.
+  const Clock::time_point now = Clock::now();
+  if (!m_started)
+  {
+    m_started = true;
+    m_start_time = now;
+    VideoCommon::StageTimer::SetEnabled(true);
+    return;
+  }
+
+  ++m_frames_played;
+  m_end_time = now;
+  m_stage_totals = VideoCommon::StageTimer::GetTotals();
+}
+
+void FifoBenchmark::OnPlaybackEnded()
+{
+  if (m_finished || m_frames_played == 0)
+    return;
+
+  m_finished = true;
+  VideoCommon::StageTimer::SetEnabled(false);
+}
+
+bool FifoBenchmark::WriteResults() const
+{
+  if (!m_finished)
+  {
+    if (m_started && m_frames_played == 0)
+      std::fprintf(stderr, "At least two frames have to be played back to benchmark.\n");
+    std::fprintf(stderr, "FIFO log playback did not finish, no benchmark results were written.\n");
+    return false;
+  }
+
+  const auto total_time = m_end_time - m_start_time;
+
+  picojson::object stages;
+  for (size_t i = 0; i < m_stage_totals.size(); ++i)
+  {
+    const auto stage = static_cast<VideoCommon::GPUStage>(i);
+    const VideoCommon::GPUStageTotals& stage_totals = m_stage_totals[stage];
+    const double time_ms = ToMilliseconds(std::chrono::nanoseconds(stage_totals.time_ns));
+
+    picojson::object stage_object;
+    stage_object["time_ms"] = picojson::value(time_ms);
+    stage_object["time_per_frame_ms"] = picojson::value(time_ms / m_frames_played);
+    stage_object["calls"] = picojson::value(static_cast<double>(stage_totals.calls));
+    stages[VideoCommon::StageTimer::GetStageName(stage)] = picojson::value(std::move(stage_object));
+  }
+
+  picojson::object root;
+  root["backend"] = picojson::value(Config::Get(Config::MAIN_GFX_BACKEND));
+  root["first_frame"] = picojson::value(static_cast<double>(m_first_frame));
+  root["last_frame"] = picojson::value(static_cast<double>(m_last_frame));
+  root["loops"] = picojson::value(static_cast<double>(m_options.loops));
+  root["frames"] = picojson::value(static_cast<double>(m_frames_played));
+  root["total_time_ms"] = picojson::value(ToMilliseconds(total_time));
+  root["frame_time_ms"] = picojson::value(ToMilliseconds(total_time) / m_frames_played);
+  root["stages"] = picojson::value(std::move(stages));
+
+  const picojson::value json(std::move(root));
+  if (m_options.output_path == "-")
+  {
+    std::fprintf(stdout, "%s\n", json.serialize(true).c_str());
+    return true;
+  }
+
+  if (!JsonToFile(m_options.output_path, json, true))
+  {
+    std::fprintf(stderr, "Failed to write benchmark results to %s\n",
+                 m_options.output_path.c_str());
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,65 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/StageTimer.h"
+
+namespace Core
+{
+class System;
+}
+
+// Plays back a FIFO log over a frame range a fixed number of times as fast as possible, and
+// reports the time spent in each stage of GPU command processing as JSON.
+class FifoBenchmark
+{
+public:
+  struct Options
+  {
+    // Where to write the results. "-" writes them to stdout.
+    std::string output_path;
+    u32 first_frame = 0;
+    std::optional<u32> last_frame;
+    u32 loops = 1;
+  };
+
+  // Must be created before the FIFO log is booted.
+  FifoBenchmark(Core::System& system, Options options);
+  ~FifoBenchmark();
+
+  FifoBenchmark(const FifoBenchmark&) = delete;
+  FifoBenchmark& operator=(const FifoBenchmark&) = delete;
+  FifoBenchmark(FifoBenchmark&&) = delete;
+  FifoBenchmark& operator=(FifoBenchmark&&) = delete;
+
+  // Called when emulation is being stopped, which the FIFO player requests once it has played
+  // back the frame range the requested number of times.
+  void OnPlaybackEnded();
+
+  // Writes the results. Should be called once emulation has shut down.
+  bool WriteResults() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  void OnFileLoaded();
+  void OnFrameWritten();
+
+  Core::System& m_system;
+  Options m_options;
+
+  u32 m_first_frame = 0;
+  u32 m_last_frame = 0;
+  u32 m_frames_played = 0;
+  bool m_started = false;
+  bool m_finished = false;
+  VideoCommon::GPUStageTotalsMap m_stage_totals;
+  Clock::time_point m_start_time;
+  Clock::time_point m_end_time;
+};
@@ -6,6 +6,7 @@
 #include <OptionParser.h>
 #include <csignal>
 #include <cstdio>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -15,13 +16,17 @@
 #include <windows.h>
 #endif
 
+#include "Common/CommonTypes.h"
 #include "Common/ScopeGuard.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/System.h"
+#include "DolphinNoGUI/FifoBenchmark.h"
+#include "DolphinNoGUI/MovieVerifier.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -30,6 +35,8 @@
 #include "UICommon/UICommon.h"
 
 static std::unique_ptr<Platform> s_platform;
+static std::unique_ptr<FifoBenchmark> s_fifo_benchmark;
+static std::unique_ptr<MovieVerifier> s_movie_verifier;
 
 static void signal_handler(int)
 {
@@ -66,7 +73,11 @@ bool Host_UIBlocksControllerState()
 void Host_Message(const HostMessageID id)
 {
   if (id == HostMessageID::WMUserStop)
+  {
+    if (s_fifo_benchmark)
+      s_fifo_benchmark->OnPlaybackEnded();
     s_platform->Stop();
+  }
 }
 
 void Host_UpdateTitle(const std::string& title)
@@ -151,10 +162,8 @@ std::unique_ptr<GBAHostInterface> Host_CreateGBAHost(std::weak_ptr<HW::GBA::Core
   return nullptr;
 }
 
-static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
+static std::unique_ptr<Platform> GetPlatform(const std::string& platform_name)
 {
-  std::string platform_name = static_cast<const char*>(options.get("platform"));
-
 #if HAVE_X11
   if (platform_name == "x11" || platform_name.empty())
     return Platform::CreateX11Platform();
@@ -180,6 +189,25 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+// Reads an optional int option into value, which is left as it is if the option isn't set.
+// Prints an error and returns false if the option is set to less than min_value.
+static bool GetUnsignedOption(optparse::Values& options, const char* name, u32 min_value,
+                              u32* value)
+{
+  if (!options.is_set(name))
+    return true;
+
+  const int option_value = options.get(name);
+  if (option_value < 0 || static_cast<u32>(option_value) < min_value)
+  {
+    fprintf(stderr, "--%s must be at least %u.\n", name, min_value);
+    return false;
+  }
+
+  *value = static_cast<u32>(option_value);
+  return true;
+}
+
 #ifdef _WIN32
 #define main app_main
 #endif
@@ -209,6 +237,40 @@ int main(const int argc, char* argv[])
                 "macos"
 #endif
       });
+  parser->add_option("--fifo_benchmark")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Play back the FIFO log as fast as possible, then write the time spent in each GPU "
+            "stage to the given file as JSON (- for stdout)");
+  parser->add_option("--fifo_benchmark_first_frame")
+      .action("store")
+      .type("int")
+      .help("First frame of the FIFO log to play back when benchmarking");
+  parser->add_option("--fifo_benchmark_last_frame")
+      .action("store")
+      .type("int")
+      .help("Last frame of the FIFO log to play back when benchmarking");
+  parser->add_option("--fifo_benchmark_loops")
+      .action("store")
+      .type("int")
+      .help("Number of times to play back the frame range when benchmarking (default 1)");
+  parser->add_option("--verify_movie")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Play back the movie given with --movie as fast as possible without video or audio "
+            "output, then write checksums of RAM to the given file as JSON (- for stdout)");
+  parser->add_option("--verify_movie_interval")
+      .action("store")
+      .type("int")
+      .help("Number of frames between RAM checksums when verifying a movie (default 60)");
+  parser->add_option("--verify_movie_reference")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Checksums of an earlier run to compare against when verifying a movie. Playback "
+            "stops at the first mismatch");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -259,7 +321,12 @@ int main(const int argc, char* argv[])
   if (options.is_set("user"))
     user_directory = static_cast<const char*>(options.get("user"));
 
-  s_platform = GetPlatform(options);
+  std::string platform_name = static_cast<const char*>(options.get("platform"));
+  // Verifying a movie doesn't show anything, so there's no need for a window.
+  if (platform_name.empty() && options.is_set("verify_movie"))
+    platform_name = "headless";
+
+  s_platform = GetPlatform(platform_name);
   if (!s_platform || !s_platform->Init())
   {
     fprintf(stderr, "No platform found, or failed to initialize.\n");
@@ -283,6 +350,60 @@ int main(const int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("fifo_benchmark"))
+  {
+    FifoBenchmark::Options benchmark_options;
+    benchmark_options.output_path = static_cast<const char*>(options.get("fifo_benchmark"));
+    u32 last_frame = 0;
+    if (!GetUnsignedOption(options, "fifo_benchmark_first_frame", 0,
+                           &benchmark_options.first_frame) ||
+        !GetUnsignedOption(options, "fifo_benchmark_last_frame", 0, &last_frame) ||
+        !GetUnsignedOption(options, "fifo_benchmark_loops", 1, &benchmark_options.loops))
+    {
+      return 1;
+    }
+    if (options.is_set("fifo_benchmark_last_frame"))
+      benchmark_options.last_frame = last_frame;
+    s_fifo_benchmark =
+        std::make_unique<FifoBenchmark>(Core::System::GetInstance(), std::move(benchmark_options));
+  }
+
+  if (options.is_set("verify_movie"))
+  {
+    if (!options.is_set("movie"))
+    {
+      fprintf(stderr, "A movie to verify has to be given with --movie.\n");
+      return 1;
+    }
+
+    MovieVerifier::Options verifier_options;
+    verifier_options.output_path = static_cast<const char*>(options.get("verify_movie"));
+    if (!GetUnsignedOption(options, "verify_movie_interval", 1, &verifier_options.interval))
+      return 1;
+    if (options.is_set("verify_movie_reference"))
+    {
+      verifier_options.reference_path =
+          static_cast<const char*>(options.get("verify_movie_reference"));
+    }
+    s_movie_verifier =
+        std::make_unique<MovieVerifier>(Core::System::GetInstance(), std::move(verifier_options));
+    if (!s_movie_verifier->LoadReference())
+      return 1;
+  }
+
+  if (boot && options.is_set("movie"))
+  {
+    std::optional<std::string> movie_save_state_path;
+    if (!Core::System::GetInstance().GetMovie().PlayInput(
+            static_cast<const char*>(options.get("movie")), &movie_save_state_path))
+    {
+      fprintf(stderr, "Could not play the specified movie\n");
+      return 1;
+    }
+    boot->boot_session_data.SetSavestateData(std::move(movie_save_state_path),
+                                             DeleteSavestateAfterBoot::No);
+  }
+
   auto core_state_changed_hook = Core::AddOnStateChangedCallback([](const Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -319,6 +440,22 @@ int main(const int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (s_fifo_benchmark)
+  {
+    const bool wrote_results = s_fifo_benchmark->WriteResults();
+    s_fifo_benchmark.reset();
+    if (!wrote_results)
+      return 1;
+  }
+
+  if (s_movie_verifier)
+  {
+    const bool verified = s_movie_verifier->WriteResults();
+    s_movie_verifier.reset();
+    if (!verified)
+      return 1;
+  }
+
   return 0;
 }
 
@@ -0,0 +1,207 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/MovieVerifier.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include <fmt/format.h>
+#include <picojson.h>
+#include <xxhash.h>
+
+#include "Common/Config/Config.h"
+#include "Common/JsonUtil.h"
+#include "Common/StringUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/HW/Memmap.h"
+#include "Core/Host.h"
+#include "Core/Movie.h"
+#include "Core/System.h"
+#include "VideoCommon/VideoEvents.h"
+
+namespace
+{
+double ToMilliseconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+MovieVerifier::MovieVerifier(Core::System& system, Options options)
+    : m_system(system), m_options(std::move(options))
+{
+  m_options.interval = std::max<u32>(m_options.interval, 1);
+
+  // Nothing is ever shown or heard, so skip the work of producing it. EFB and XFB copies to RAM
+  // are left as the movie was recorded with, as games can read them.
+  Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Null");
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, BACKEND_NULLSOUND);
+  Config::SetCurrent(Config::MAIN_DUMP_AUDIO, false);
+  Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+
+  // Run as fast as possible, and don't pause or start recording once the movie ends.
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, false);
+  m_system.GetMovie().SetReadOnly(true);
+
+  m_field_end_hook =
+      m_system.GetVideoEvents().vi_end_field_event.Register([this] { OnFieldEnd(); });
+}
+
+MovieVerifier::~MovieVerifier() = default;
+
+bool MovieVerifier::LoadReference()
+{
+  if (m_options.reference_path.empty())
+    return true;
+
+  picojson::value root;
+  std::string error;
+  if (!JsonFromFile(m_options.reference_path, &root, &error))
+  {
+    std::fprintf(stderr, "Failed to read %s: %s\n", m_options.reference_path.c_str(),
+                 error.c_str());
+    return false;
+  }
+
+  const auto invalid = [this] {
+    std::fprintf(stderr, "%s does not contain movie checksums\n",
+                 m_options.reference_path.c_str());
+    return false;
+  };
+
+  if (!root.is<picojson::object>())
+    return invalid();
+  const picojson::object& root_object = root.get<picojson::object>();
+  const auto checksums = root_object.find("checksums");
+  if (checksums == root_object.end() || !checksums->second.is<picojson::array>())
+    return invalid();
+
+  for (const picojson::value& entry : checksums->second.get<picojson::array>())
+  {
+    if (!entry.is<picojson::object>())
+      return invalid();
+
+    const picojson::object& entry_object = entry.get<picojson::object>();
+    const std::optional<u64> frame = ReadNumericFromJson<u64>(entry_object, "frame");
+    const std::optional<std::string> ram = ReadStringFromJson(entry_object, "ram");
+    u64 checksum;
+    if (!frame || !ram || !TryParse(*ram, &checksum, 16))
+      return invalid();
+
+    m_reference[*frame] = checksum;
+  }
+
+  return true;
+}
+
+// NOTE: CPU Thread
+void MovieVerifier::OnFieldEnd()
+{
+  if (m_finished)
+    return;
+
+  auto& movie = m_system.GetMovie();
+  if (!m_started)
+  {
+    if (!movie.IsPlayingInput())
+      return;
+
+    m_started = true;
+    m_start_time = Clock::now();
+  }
+
+  if (movie.IsPlayingInput())
+  {
+    const u64 frame = movie.GetCurrentFrame();
+    if (frame % m_options.interval == 0 && !m_checksums.contains(frame))
+      AddChecksum(frame);
+    if (!m_first_mismatch)
+      return;
+  }
+  else
+  {
+    // The movie has ended. Also record the state at the very end, as the last frames would
+    // otherwise go unchecked.
+    AddChecksum(movie.GetCurrentFrame());
+  }
+
+  m_end_time = Clock::now();
+  m_finished = true;
+  Host_Message(HostMessageID::WMUserStop);
+}
+
+void MovieVerifier::AddChecksum(u64 frame)
+{
+  // The checksum has to be the same on every host, so this can't use Common::GetHash64, which
+  // changes with the CPU features of the host.
+  auto& memory = m_system.GetMemory();
+  u64 checksum = XXH3_64bits(memory.GetRAM(), memory.GetRamSizeReal());
+  if (m_system.IsWii())
+    checksum = XXH3_64bits_withSeed(memory.GetEXRAM(), memory.GetExRamSizeReal(), checksum);
+
+  m_checksums[frame] = checksum;
+  m_last_frame = std::max(m_last_frame, frame);
+
+  const auto reference = m_reference.find(frame);
+  if (!m_first_mismatch && reference != m_reference.end() && reference->second != checksum)
+    m_first_mismatch = frame;
+}
+
+bool MovieVerifier::WriteResults() const
+{
+  if (!m_finished)
+  {
+    std::fprintf(stderr, "Movie playback did not finish, no checksums were written.\n");
+    return false;
+  }
+
+  const double total_time_ms = ToMilliseconds(m_end_time - m_start_time);
+
+  picojson::array checksums;
+  for (const auto& [frame, checksum] : m_checksums)
+  {
+    picojson::object entry;
+    entry["frame"] = picojson::value(static_cast<double>(frame));
+    entry["ram"] = picojson::value(fmt::format("{:016x}", checksum));
+    checksums.emplace_back(std::move(entry));
+  }
+
+  picojson::object root;
+  root["interval"] = picojson::value(static_cast<double>(m_options.interval));
+  root["frames"] = picojson::value(static_cast<double>(m_last_frame));
+  root["total_time_ms"] = picojson::value(total_time_ms);
+  if (total_time_ms > 0)
+    root["frames_per_second"] = picojson::value(m_last_frame / (total_time_ms / 1000));
+  root["checksums"] = picojson::value(std::move(checksums));
+  if (!m_options.reference_path.empty())
+  {
+    root["matches_reference"] = picojson::value(!m_first_mismatch.has_value());
+    if (m_first_mismatch)
+      root["first_mismatch_frame"] = picojson::value(static_cast<double>(*m_first_mismatch));
+  }
+
+  const picojson::value json(std::move(root));
+  bool success = true;
+  if (m_options.output_path == "-")
+  {
+    std::fprintf(stdout, "%s\n", json.serialize(true).c_str());
+  }
+  else if (!JsonToFile(m_options.output_path, json, true))
+  {
+    std::fprintf(stderr, "Failed to write movie checksums to %s\n",
+                 m_options.output_path.c_str());
+    success = false;
+  }
+
+  if (m_first_mismatch)
+  {
+    std::fprintf(stderr, "Movie playback diverged from the reference at frame %llu\n",
+                 static_cast<unsigned long long>(*m_first_mismatch));
+    success = false;
+  }
+
+  return success;
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+namespace Core
+{
+class System;
+}
+
+// Plays back a movie as fast as possible without presenting anything or outputting audio, and
+// reports checksums of the emulated RAM every few frames as JSON. Comparing the checksums of two
+// runs shows whether (and from which frame on) playback was deterministic.
+class MovieVerifier
+{
+public:
+  struct Options
+  {
+    // Where to write the results. "-" writes them to stdout.
+    std::string output_path;
+    // The results of an earlier run to compare against, if any.
+    std::string reference_path;
+    u32 interval = 60;
+  };
+
+  // Must be created before the movie is played back, as it changes the configuration for the run.
+  MovieVerifier(Core::System& system, Options options);
+  ~MovieVerifier();
+
+  MovieVerifier(const MovieVerifier&) = delete;
+  MovieVerifier& operator=(const MovieVerifier&) = delete;
+  MovieVerifier(MovieVerifier&&) = delete;
+  MovieVerifier& operator=(MovieVerifier&&) = delete;
+
+  bool LoadReference();
+
+  // Writes the results. Should be called once emulation has shut down. Returns false if the
+  // movie didn't finish or didn't match the reference.
+  bool WriteResults() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  void OnFieldEnd();
+  void AddChecksum(u64 frame);
+
+  Core::System& m_system;
+  Options m_options;
+  Common::EventHook m_field_end_hook;
+
+  std::map<u64, u64> m_checksums;
+  std::map<u64, u64> m_reference;
+  std::optional<u64> m_first_mismatch;
+  u64 m_last_frame = 0;
+  bool m_started = false;
+  bool m_finished = false;
+  Clock::time_point m_start_time;
+  Clock::time_point m_end_time;
+};
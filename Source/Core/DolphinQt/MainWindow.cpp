@@ -1682,6 +1682,7 @@ bool MainWindow::NetPlayJoin()
   {
     server->SetHostInputAuthority(host_input_authority);
     server->AdjustPadBufferSize(Config::Get(Config::NETPLAY_BUFFER_SIZE));
+    server->SetAdaptivePadBuffer(Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER_SIZE));
   }
 
   // Create Client
@@ -3,7 +3,9 @@
 
 #include "DolphinQt/MenuBar.h"
 
+#include <algorithm>
 #include <future>
+#include <limits>
 
 #include <QAction>
 #include <QActionGroup>
@@ -135,6 +137,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
 
   // Movie
   m_recording_read_only->setEnabled(running);
+  m_recording_seek->setEnabled(running);
   if (!running)
   {
     m_recording_stop->setEnabled(false);
@@ -854,6 +857,9 @@ void MenuBar::AddMovieMenu()
   connect(m_recording_read_only, &QAction::toggled,
           [](bool value) { Core::System::GetInstance().GetMovie().SetReadOnly(value); });
 
+  m_recording_seek = movie_menu->addAction(tr("Seek to Frame..."), this, &MenuBar::SeekMovie);
+  m_recording_seek->setEnabled(false);
+
   movie_menu->addAction(tr("TAS Input"), this, [this] { emit ShowTASInput(); });
 
   movie_menu->addSeparator();
@@ -887,6 +893,27 @@ void MenuBar::AddMovieMenu()
           [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_DUMP_AUDIO, value); });
 }
 
+void MenuBar::SeekMovie()
+{
+  auto& movie = Core::System::GetInstance().GetMovie();
+  if (!movie.IsPlayingInput())
+  {
+    ModalMessageBox::information(this, tr("Seek to Frame"),
+                                 tr("Seeking is only possible while playing back a movie."));
+    return;
+  }
+
+  constexpr u64 max_frame = std::numeric_limits<int>::max();
+  bool good;
+  const int frame = QInputDialog::getInt(
+      this, tr("Seek to Frame"), tr("Frame:"),
+      static_cast<int>(std::min(movie.GetCurrentFrame(), max_frame)), 0,
+      static_cast<int>(std::min(movie.GetTotalFrames(), max_frame)), 1, &good,
+      Qt::WindowCloseButtonHint);
+  if (good)
+    movie.SeekToFrame(static_cast<u64>(frame));
+}
+
 void MenuBar::AddJITMenu()
 {
   m_jit = new QtUtils::NonAutodismissibleMenu(tr("JIT"), this);
@@ -170,6 +170,7 @@ private:
   void CheckNAND();
   void NANDExtractCertificates();
   void ChangeDebugFont();
+  void SeekMovie();
 
   // Debugging UI
   void ClearSymbols();
@@ -259,6 +260,7 @@ private:
   QAction* m_recording_start;
   QAction* m_recording_stop;
   QAction* m_recording_read_only;
+  QAction* m_recording_seek;
   QAction* m_movie_window;
 
   // Options
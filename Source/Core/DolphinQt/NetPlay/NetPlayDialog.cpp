@@ -207,6 +207,14 @@ void NetPlayDialog::CreateMainLayout()
   m_network_mode_group->addAction(m_golf_mode_action);
   m_fixed_delay_action->setChecked(true);
 
+  m_network_menu->addSeparator();
+  m_adaptive_buffer_action = m_network_menu->addAction(tr("Adapt Buffer to Ping"));
+  m_adaptive_buffer_action->setToolTip(
+      tr("Automatically sets the buffer size from the measured ping of every player, so that "
+         "inputs arrive in time without adding more latency than needed.\nOnly used with Fair "
+         "Input Delay."));
+  m_adaptive_buffer_action->setCheckable(true);
+
   m_game_digest_menu = m_menu_bar->addMenu(tr("Checksum"));
   m_game_digest_menu->addAction(tr("Current game"), this, [this] {
     Settings::Instance().GetNetPlayServer()->ComputeGameDigest(m_current_game_identifier);
@@ -375,6 +383,12 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_golf_mode_action, &QAction::toggled, this, [hia_function] { hia_function(true); });
   connect(m_fixed_delay_action, &QAction::toggled, this, [hia_function] { hia_function(false); });
 
+  connect(m_adaptive_buffer_action, &QAction::toggled, this, [](bool enable) {
+    const auto server = Settings::Instance().GetNetPlayServer();
+    if (server)
+      server->SetAdaptivePadBuffer(enable);
+  });
+
   connect(m_start_button, &QPushButton::clicked, this, &NetPlayDialog::OnStart);
   connect(m_quit_button, &QPushButton::clicked, this, &NetPlayDialog::reject);
 
@@ -421,6 +435,7 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_golf_mode_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_golf_mode_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_fixed_delay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_adaptive_buffer_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_hide_remote_gbas_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
 }
 
@@ -1118,6 +1133,7 @@ std::string NetPlayDialog::FindGBARomPath(const std::array<u8, 20>& hash, std::s
 void NetPlayDialog::LoadSettings()
 {
   const int buffer_size = Config::Get(Config::NETPLAY_BUFFER_SIZE);
+  const bool adaptive_buffer_size = Config::Get(Config::NETPLAY_ADAPTIVE_BUFFER_SIZE);
   const bool savedata_load = Config::Get(Config::NETPLAY_SAVEDATA_LOAD);
   const bool savedata_write = Config::Get(Config::NETPLAY_SAVEDATA_WRITE);
   const bool sync_all_wii_saves = Config::Get(Config::NETPLAY_SAVEDATA_SYNC_ALL_WII);
@@ -1128,6 +1144,7 @@ void NetPlayDialog::LoadSettings()
   const bool hide_remote_gbas = Config::Get(Config::NETPLAY_HIDE_REMOTE_GBAS);
 
   m_buffer_size_box->setValue(buffer_size);
+  m_adaptive_buffer_action->setChecked(adaptive_buffer_size);
 
   if (!savedata_load)
     m_savedata_none_action->setChecked(true);
@@ -1172,6 +1189,7 @@ void NetPlayDialog::SaveSettings()
     Config::SetBase(Config::NETPLAY_CLIENT_BUFFER_SIZE, m_buffer_size_box->value());
   else
     Config::SetBase(Config::NETPLAY_BUFFER_SIZE, m_buffer_size_box->value());
+  Config::SetBase(Config::NETPLAY_ADAPTIVE_BUFFER_SIZE, m_adaptive_buffer_action->isChecked());
 
   const bool write_savedata = m_savedata_load_and_write_action->isChecked();
   const bool load_savedata = write_savedata || m_savedata_load_only_action->isChecked();
@@ -0,0 +1,217 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "InputCommon/ControlReference/CompiledExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/Assert.h"
+#include "InputCommon/ControlReference/FunctionExpression.h"
+
+namespace ciface::ExpressionParser
+{
+ControlState Calculate(Opcode op, ControlState a, ControlState b, ControlState c)
+{
+  switch (op)
+  {
+  case Opcode::Add:
+    return a + b;
+  case Opcode::Sub:
+    return a - b;
+  case Opcode::Mul:
+    return a * b;
+  case Opcode::Div:
+  {
+    const ControlState result = a / b;
+    return std::isinf(result) ? 0.0 : result;
+  }
+  case Opcode::Mod:
+  {
+    const ControlState result = std::fmod(a, b);
+    return std::isnan(result) ? 0.0 : result;
+  }
+  case Opcode::And:
+  case Opcode::Min:
+    return std::min(a, b);
+  case Opcode::Or:
+  case Opcode::Max:
+    return std::max(a, b);
+  case Opcode::Xor:
+    return std::max(std::min(1 - a, b), std::min(a, 1 - b));
+  case Opcode::LessThan:
+    return a < b;
+  case Opcode::GreaterThan:
+    return a > b;
+  case Opcode::Pow:
+    return std::pow(a, b);
+  case Opcode::ATan2:
+    return std::atan2(a, b);
+  case Opcode::Deadzone:
+    return std::copysign(std::max(0.0, std::abs(a) - b) / (1.0 - b), a);
+  case Opcode::Not:
+    return 1.0 - a;
+  case Opcode::Minus:
+    return 0.0 - a;
+  case Opcode::Abs:
+    return std::abs(a);
+  case Opcode::Sin:
+    return std::sin(a);
+  case Opcode::Cos:
+    return std::cos(a);
+  case Opcode::Tan:
+    return std::tan(a);
+  case Opcode::ASin:
+    return std::asin(a);
+  case Opcode::ACos:
+    return std::acos(a);
+  case Opcode::ATan:
+    return std::atan(a);
+  case Opcode::Sqrt:
+    return std::sqrt(a);
+  case Opcode::Clamp:
+    return std::clamp(a, b, c);
+  default:
+    ASSERT(false);
+    return 0.0;
+  }
+}
+
+ControlState CompiledExpression::Evaluate()
+{
+  ControlState* const r = m_registers.data();
+
+  for (const auto& [input, reg] : m_inputs)
+    r[reg] = std::max(0.0, input->GetState());
+
+  const size_t size = m_code.size();
+  for (size_t pc = 0; pc < size;)
+  {
+    const Instruction& ins = m_code[pc++];
+    switch (ins.op)
+    {
+    case Opcode::LoadInput:
+      r[ins.dst] = IsInputSuppressed(m_inputs[ins.b].first) ? 0.0 : r[ins.a];
+      break;
+    case Opcode::LoadVariable:
+      r[ins.dst] = *m_variables[ins.a];
+      break;
+    case Opcode::Call:
+      r[ins.dst] = m_calls[ins.a]->GetValue();
+      break;
+    case Opcode::Move:
+      r[ins.dst] = r[ins.a];
+      break;
+    case Opcode::Jump:
+      pc = ins.a;
+      break;
+    case Opcode::JumpIfFalse:
+      if (!(r[ins.a] > CONDITION_THRESHOLD))
+        pc = ins.b;
+      break;
+    default:
+      r[ins.dst] = Calculate(ins.op, r[ins.a], r[ins.b], r[ins.c]);
+      break;
+    }
+  }
+
+  return r[m_result];
+}
+
+ExpressionCompiler::ExpressionCompiler()
+{
+  // Unused operands refer to register 0, which is a constant so that they don't prevent folding.
+  Constant(0.0);
+}
+
+CompiledExpression ExpressionCompiler::Compile(Expression& expr)
+{
+  ExpressionCompiler compiler;
+  compiler.m_program.m_result = expr.Compile(compiler);
+  return std::move(compiler.m_program);
+}
+
+u32 ExpressionCompiler::AllocateRegister()
+{
+  m_program.m_registers.push_back(0.0);
+  m_is_constant.push_back(false);
+  return static_cast<u32>(m_program.m_registers.size() - 1);
+}
+
+size_t ExpressionCompiler::EmitInstruction(Opcode op, u32 dst, u32 a, u32 b, u32 c)
+{
+  m_program.m_code.push_back({op, dst, a, b, c});
+  return m_program.m_code.size() - 1;
+}
+
+u32 ExpressionCompiler::Constant(ControlState value)
+{
+  const u32 reg = AllocateRegister();
+  m_program.m_registers[reg] = value;
+  m_is_constant[reg] = true;
+  return reg;
+}
+
+u32 ExpressionCompiler::Input(Core::Device::Input* input)
+{
+  if (!input)
+    return Constant(0.0);
+
+  std::vector<std::pair<Core::Device::Input*, u32>>& inputs = m_program.m_inputs;
+  auto it = std::ranges::find(inputs, input, &std::pair<Core::Device::Input*, u32>::first);
+  if (it == inputs.end())
+    it = inputs.emplace(inputs.end(), input, AllocateRegister());
+
+  const u32 reg = AllocateRegister();
+  EmitInstruction(Opcode::LoadInput, reg, it->second, static_cast<u32>(it - inputs.begin()));
+  return reg;
+}
+
+u32 ExpressionCompiler::Variable(ControlState* variable)
+{
+  if (!variable)
+    return Constant(0.0);
+
+  const u32 reg = AllocateRegister();
+  EmitInstruction(Opcode::LoadVariable, reg, static_cast<u32>(m_program.m_variables.size()));
+  m_program.m_variables.push_back(variable);
+  return reg;
+}
+
+u32 ExpressionCompiler::Call(Expression& expr)
+{
+  const u32 reg = AllocateRegister();
+  EmitInstruction(Opcode::Call, reg, static_cast<u32>(m_program.m_calls.size()));
+  m_program.m_calls.push_back(&expr);
+  return reg;
+}
+
+u32 ExpressionCompiler::Emit(Opcode op, u32 a, u32 b, u32 c)
+{
+  std::vector<ControlState>& r = m_program.m_registers;
+  if (IsConstant(a) && IsConstant(b) && IsConstant(c))
+    return Constant(Calculate(op, r[a], r[b], r[c]));
+
+  const u32 reg = AllocateRegister();
+  EmitInstruction(op, reg, a, b, c);
+  return reg;
+}
+
+u32 ExpressionCompiler::Conditional(u32 condition, Expression& true_expr, Expression& false_expr)
+{
+  if (IsConstant(condition))
+  {
+    const bool result = m_program.m_registers[condition] > CONDITION_THRESHOLD;
+    return (result ? true_expr : false_expr).Compile(*this);
+  }
+
+  const u32 reg = AllocateRegister();
+  const size_t jump_to_false = EmitInstruction(Opcode::JumpIfFalse, 0, condition);
+  EmitInstruction(Opcode::Move, reg, true_expr.Compile(*this));
+  const size_t jump_to_end = EmitInstruction(Opcode::Jump, 0);
+  m_program.m_code[jump_to_false].b = static_cast<u32>(m_program.m_code.size());
+  EmitInstruction(Opcode::Move, reg, false_expr.Compile(*this));
+  m_program.m_code[jump_to_end].a = static_cast<u32>(m_program.m_code.size());
+  return reg;
+}
+}  // namespace ciface::ExpressionParser
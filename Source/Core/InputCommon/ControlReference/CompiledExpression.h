@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "InputCommon/ControlReference/ExpressionParser.h"
+#include "InputCommon/ControllerInterface/CoreDevice.h"
+
+namespace ciface::ExpressionParser
+{
+enum class Opcode : u8
+{
+  // dst = a (op) b
+  Add,
+  Sub,
+  Mul,
+  Div,
+  Mod,
+  And,
+  Or,
+  Xor,
+  LessThan,
+  GreaterThan,
+  Min,
+  Max,
+  Pow,
+  ATan2,
+  Deadzone,
+  // dst = op(a)
+  Not,
+  Minus,
+  Abs,
+  Sin,
+  Cos,
+  Tan,
+  ASin,
+  ACos,
+  ATan,
+  Sqrt,
+  // dst = clamp(a, b, c)
+  Clamp,
+
+  // dst = the state read from inputs[b] into register a, unless the input is suppressed
+  LoadInput,
+  // dst = *variables[a]
+  LoadVariable,
+  // dst = calls[a]->GetValue()
+  Call,
+  // dst = a
+  Move,
+  // Continue at instruction a
+  Jump,
+  // Continue at instruction b unless a > CONDITION_THRESHOLD
+  JumpIfFalse,
+};
+
+// Calculates the result of an operation which only reads registers. Operands the operation doesn't
+// use are ignored. Binary operator nodes calculate their value with this too, so that evaluating
+// the tree and the compiled expression can't disagree.
+ControlState Calculate(Opcode op, ControlState a, ControlState b = 0.0, ControlState c = 0.0);
+
+struct Instruction
+{
+  Opcode op;
+  u32 dst;
+  u32 a;
+  u32 b;
+  u32 c;
+};
+
+// An expression compiled to a flat list of instructions operating on registers, so that it can be
+// evaluated without walking the tree of Expression nodes through virtual calls. Nodes which keep
+// state or have side effects, like toggle() or assignments, are still evaluated through the tree.
+//
+// The instructions refer to the controls and variables the tree was bound to when it was compiled,
+// so the expression has to be compiled again after UpdateReferences().
+class CompiledExpression
+{
+public:
+  ControlState Evaluate();
+
+  size_t GetInstructionCount() const { return m_code.size(); }
+
+private:
+  friend class ExpressionCompiler;
+
+  std::vector<Instruction> m_code;
+  // Constants are stored in registers which are never written to.
+  std::vector<ControlState> m_registers;
+  // Each control is only read once per evaluation, into the register next to it.
+  std::vector<std::pair<Core::Device::Input*, u32>> m_inputs;
+  std::vector<ControlState*> m_variables;
+  std::vector<Expression*> m_calls;
+  u32 m_result = 0;
+};
+
+class ExpressionCompiler
+{
+public:
+  // The expression must stay alive and bound to the same references as long as the result is used.
+  static CompiledExpression Compile(Expression& expr);
+
+  u32 Constant(ControlState value);
+  u32 Input(Core::Device::Input* input);
+  u32 Variable(ControlState* variable);
+  u32 Call(Expression& expr);
+
+  // Operations on constants are folded into a constant.
+  u32 Emit(Opcode op, u32 a, u32 b = 0, u32 c = 0);
+
+  // Only evaluates the expression which is chosen by the condition.
+  u32 Conditional(u32 condition, Expression& true_expr, Expression& false_expr);
+
+private:
+  ExpressionCompiler();
+
+  u32 AllocateRegister();
+  size_t EmitInstruction(Opcode op, u32 dst, u32 a = 0, u32 b = 0, u32 c = 0);
+  bool IsConstant(u32 reg) const { return m_is_constant[reg]; }
+
+  CompiledExpression m_program;
+  std::vector<bool> m_is_constant;
+};
+}  // namespace ciface::ExpressionParser
@@ -28,6 +28,8 @@ void ControlReference::UpdateReference(ciface::ExpressionParser::ControlEnvironm
   if (m_parsed_expression)
   {
     m_parsed_expression->UpdateReferences(env);
+    if (IsInput())
+      m_compiled_expression = ExpressionCompiler::Compile(*m_parsed_expression);
   }
 }
 
@@ -55,6 +57,7 @@ std::optional<std::string> ControlReference::SetExpression(std::string expr)
   auto parse_result = ParseExpression(m_expression);
   m_parse_status = parse_result.status;
   m_parsed_expression = std::move(parse_result.expr);
+  m_compiled_expression.reset();
   return parse_result.description;
 }
 
@@ -87,9 +90,12 @@ bool OutputReference::IsInput() const
 //
 ControlState InputReference::State(const ControlState ignore)
 {
-  if (m_parsed_expression && GetInputGate())
-    return m_parsed_expression->GetValue() * range;
-  return 0.0;
+  if (!m_parsed_expression || !GetInputGate())
+    return 0.0;
+
+  if (m_compiled_expression)
+    return m_compiled_expression->Evaluate() * range;
+  return m_parsed_expression->GetValue() * range;
 }
 
 //
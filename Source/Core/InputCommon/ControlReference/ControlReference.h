@@ -5,7 +5,9 @@
 
 #include <cmath>
 #include <memory>
+#include <optional>
 
+#include "InputCommon/ControlReference/CompiledExpression.h"
 #include "InputCommon/ControlReference/ExpressionParser.h"
 #include "InputCommon/ControllerInterface/CoreDevice.h"
 
@@ -56,6 +58,8 @@ protected:
   ControlReference();
   std::string m_expression;
   std::unique_ptr<ciface::ExpressionParser::Expression> m_parsed_expression;
+  // Inputs are evaluated through this once the expression is bound to controls.
+  std::optional<ciface::ExpressionParser::CompiledExpression> m_compiled_expression;
   ciface::ExpressionParser::ParseStatus m_parse_status =
       ciface::ExpressionParser::ParseStatus::EmptyExpression;
 };
@@ -5,7 +5,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <cmath>
 #include <functional>
 #include <map>
 #include <memory>
@@ -17,6 +16,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "InputCommon/ControlReference/CompiledExpression.h"
 #include "InputCommon/ControlReference/FunctionExpression.h"
 
 namespace ciface::ExpressionParser
@@ -112,6 +112,11 @@ private:
 
 static HotkeySuppressions s_hotkey_suppressions;
 
+bool IsInputSuppressed(Device::Input* input)
+{
+  return s_hotkey_suppressions.IsSuppressed(input);
+}
+
 Token::Token(TokenType type_) : type(type_)
 {
 }
@@ -280,6 +285,11 @@ Expression* Expression::GetLValue()
   return this;
 }
 
+u32 Expression::Compile(ExpressionCompiler& compiler)
+{
+  return compiler.Call(*this);
+}
+
 class ControlExpression : public Expression
 {
 public:
@@ -310,6 +320,7 @@ public:
     if (m_output)
       m_output->SetState(value);
   }
+  u32 Compile(ExpressionCompiler& compiler) override { return compiler.Input(m_input); }
   int CountNumControls() const override { return (m_input || m_output) ? 1 : 0; }
   void UpdateReferences(ControlEnvironment& env) override
   {
@@ -395,38 +406,50 @@ public:
   }
 
   static ControlState CalculateValue(TokenType op, ControlState lhs_value, ControlState rhs_value)
+  {
+    const std::optional<Opcode> opcode = GetOpcode(op);
+    assert(opcode);
+    return opcode ? Calculate(*opcode, lhs_value, rhs_value) : 0;
+  }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const std::optional<Opcode> opcode = GetOpcode(op);
+    if (!opcode)
+      return Expression::Compile(compiler);
+
+    const u32 lhs_reg = lhs->Compile(compiler);
+    const u32 rhs_reg = rhs->Compile(compiler);
+    return compiler.Emit(*opcode, lhs_reg, rhs_reg);
+  }
+
+  static std::optional<Opcode> GetOpcode(TokenType op)
   {
     switch (op)
     {
     case TOK_AND:
-      return std::min(lhs_value, rhs_value);
+      return Opcode::And;
     case TOK_OR:
-      return std::max(lhs_value, rhs_value);
+      return Opcode::Or;
     case TOK_ADD:
-      return lhs_value + rhs_value;
+      return Opcode::Add;
     case TOK_SUB:
-      return lhs_value - rhs_value;
+      return Opcode::Sub;
     case TOK_MUL:
-      return lhs_value * rhs_value;
+      return Opcode::Mul;
     case TOK_DIV:
-    {
-      const ControlState result = lhs_value / rhs_value;
-      return std::isinf(result) ? 0.0 : result;
-    }
+      return Opcode::Div;
     case TOK_MOD:
-    {
-      const ControlState result = std::fmod(lhs_value, rhs_value);
-      return std::isnan(result) ? 0.0 : result;
-    }
+      return Opcode::Mod;
     case TOK_LTHAN:
-      return lhs_value < rhs_value;
+      return Opcode::LessThan;
     case TOK_GTHAN:
-      return lhs_value > rhs_value;
+      return Opcode::GreaterThan;
     case TOK_XOR:
-      return std::max(std::min(1 - lhs_value, rhs_value), std::min(lhs_value, 1 - rhs_value));
+      return Opcode::Xor;
     default:
-      assert(false);
-      return 0;
+      // Assignments and commas have side effects.
+      return std::nullopt;
     }
   }
 
@@ -476,6 +499,8 @@ public:
 
   ControlState GetValue() override { return GetLValue()->GetValue(); }
 
+  u32 Compile(ExpressionCompiler& compiler) override { return Expression::Compile(compiler); }
+
   Expression* GetLValue() override
   {
     Expression* const lvalue = lhs->GetLValue();
@@ -512,6 +537,8 @@ public:
 
   ControlState GetValue() override { return m_value; }
 
+  u32 Compile(ExpressionCompiler& compiler) override { return compiler.Constant(m_value); }
+
   std::string GetName() const override { return ValueToString(m_value); }
 
 private:
@@ -534,6 +561,11 @@ public:
 
   ControlState GetValue() override { return m_variable_ptr ? *m_variable_ptr : 0; }
 
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Variable(m_variable_ptr.get());
+  }
+
   void SetValue(ControlState value) override
   {
     if (m_variable_ptr)
@@ -651,6 +683,7 @@ public:
 
   ControlState GetValue() override { return GetActiveChild()->GetValue(); }
   void SetValue(ControlState value) override { GetActiveChild()->SetValue(value); }
+  u32 Compile(ExpressionCompiler& compiler) override { return GetActiveChild()->Compile(compiler); }
 
   int CountNumControls() const override { return GetActiveChild()->CountNumControls(); }
   void UpdateReferences(ControlEnvironment& env) override
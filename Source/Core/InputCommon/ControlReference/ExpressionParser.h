@@ -168,6 +168,8 @@ private:
   const Core::DeviceQualifier& default_device;
 };
 
+class ExpressionCompiler;
+
 class Expression
 {
 public:
@@ -179,6 +181,10 @@ public:
 
   // Perform any side effects and return Expression to be SetValue'd.
   virtual Expression* GetLValue();
+
+  // Emit instructions which compute GetValue() and return the register holding the result.
+  // By default, the instructions call GetValue() on this node.
+  virtual u32 Compile(ExpressionCompiler& compiler);
 };
 
 class ParseResult
@@ -200,6 +206,9 @@ private:
   ParseResult() = default;
 };
 
+// Whether an input is currently suppressed by a hotkey which uses it.
+bool IsInputSuppressed(Core::Device::Input* input);
+
 ParseResult ParseExpression(const std::string& expr);
 ParseResult ParseTokens(const std::vector<Token>& tokens);
 
@@ -7,6 +7,8 @@
 #include <chrono>
 #include <cmath>
 
+#include "InputCommon/ControlReference/CompiledExpression.h"
+
 namespace ciface::ExpressionParser
 {
 using Clock = std::chrono::steady_clock;
@@ -65,6 +67,11 @@ private:
 
   ControlState GetValue() override { return 1.0 - GetArg(0).GetValue(); }
   void SetValue(ControlState value) override { GetArg(0).SetValue(1.0 - value); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Not, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: abs(expression)
@@ -80,6 +87,11 @@ private:
   }
 
   ControlState GetValue() override { return std::abs(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Abs, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: sin(expression)
@@ -95,6 +107,11 @@ private:
   }
 
   ControlState GetValue() override { return std::sin(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Sin, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: cos(expression)
@@ -110,6 +127,11 @@ private:
   }
 
   ControlState GetValue() override { return std::cos(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Cos, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: tan(expression)
@@ -125,6 +147,11 @@ private:
   }
 
   ControlState GetValue() override { return std::tan(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Tan, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: asin(expression)
@@ -140,6 +167,11 @@ private:
   }
 
   ControlState GetValue() override { return std::asin(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::ASin, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: acos(expression)
@@ -155,6 +187,11 @@ private:
   }
 
   ControlState GetValue() override { return std::acos(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::ACos, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: atan(expression)
@@ -170,6 +207,11 @@ private:
   }
 
   ControlState GetValue() override { return std::atan(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::ATan, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: atan2(y, x)
@@ -188,6 +230,13 @@ private:
   {
     return std::atan2(GetArg(0).GetValue(), GetArg(1).GetValue());
   }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const u32 a = GetArg(0).Compile(compiler);
+    const u32 b = GetArg(1).Compile(compiler);
+    return compiler.Emit(Opcode::ATan2, a, b);
+  }
 };
 
 // usage: sqrt(expression)
@@ -203,6 +252,11 @@ private:
   }
 
   ControlState GetValue() override { return std::sqrt(GetArg(0).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Sqrt, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: pow(base, exponent)
@@ -218,6 +272,13 @@ private:
   }
 
   ControlState GetValue() override { return std::pow(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const u32 a = GetArg(0).Compile(compiler);
+    const u32 b = GetArg(1).Compile(compiler);
+    return compiler.Emit(Opcode::Pow, a, b);
+  }
 };
 
 // usage: min(a, b)
@@ -233,6 +294,13 @@ private:
   }
 
   ControlState GetValue() override { return std::min(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const u32 a = GetArg(0).Compile(compiler);
+    const u32 b = GetArg(1).Compile(compiler);
+    return compiler.Emit(Opcode::Min, a, b);
+  }
 };
 
 // usage: max(a, b)
@@ -248,6 +316,13 @@ private:
   }
 
   ControlState GetValue() override { return std::max(GetArg(0).GetValue(), GetArg(1).GetValue()); }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const u32 a = GetArg(0).Compile(compiler);
+    const u32 b = GetArg(1).Compile(compiler);
+    return compiler.Emit(Opcode::Max, a, b);
+  }
 };
 
 // usage: clamp(value, min, max)
@@ -266,6 +341,14 @@ private:
   {
     return std::clamp(GetArg(0).GetValue(), GetArg(1).GetValue(), GetArg(2).GetValue());
   }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const u32 value = GetArg(0).Compile(compiler);
+    const u32 min = GetArg(1).Compile(compiler);
+    const u32 max = GetArg(2).Compile(compiler);
+    return compiler.Emit(Opcode::Clamp, value, min, max);
+  }
 };
 
 // usage: timer(seconds)
@@ -324,6 +407,11 @@ private:
 
   ControlState GetValue() override { return GetLValue()->GetValue(); }
 
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Conditional(GetArg(0).Compile(compiler), GetArg(1), GetArg(2));
+  }
+
   Expression* GetLValue() override
   {
     return (GetArg(0).GetValue() > CONDITION_THRESHOLD) ? &GetArg(1) : &GetArg(2);
@@ -347,6 +435,11 @@ private:
     // Subtraction for clarity:
     return 0.0 - GetArg(0).GetValue();
   }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    return compiler.Emit(Opcode::Minus, GetArg(0).Compile(compiler));
+  }
 };
 
 // usage: plus(expression)
@@ -362,6 +455,7 @@ private:
   }
 
   ControlState GetValue() override { return GetArg(0).GetValue(); }
+  u32 Compile(ExpressionCompiler& compiler) override { return GetArg(0).Compile(compiler); }
 };
 
 // usage: deadzone(input, amount)
@@ -381,6 +475,13 @@ class DeadzoneExpression : public FunctionExpression
     const ControlState deadzone = GetArg(1).GetValue();
     return std::copysign(std::max(0.0, std::abs(val) - deadzone) / (1.0 - deadzone), val);
   }
+
+  u32 Compile(ExpressionCompiler& compiler) override
+  {
+    const u32 a = GetArg(0).Compile(compiler);
+    const u32 b = GetArg(1).Compile(compiler);
+    return compiler.Emit(Opcode::Deadzone, a, b);
+  }
 };
 
 // usage: smooth(input, seconds_up, seconds_down = seconds_up)
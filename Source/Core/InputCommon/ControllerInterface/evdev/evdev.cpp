@@ -4,22 +4,28 @@
 #include "InputCommon/ControllerInterface/evdev/evdev.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <ctime>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <fcntl.h>
 #include <libudev.h>
+#include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <unistd.h>
 
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/CommonFuncs.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
+#include "Common/Metrics.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
@@ -43,6 +49,11 @@ public:
   // separate thread *shrug*
   void CloseDescriptor(int fd) { m_cleanup_thread.Push(fd); }
 
+  // Events of polled nodes are read on the input thread as soon as they arrive, so that input
+  // updates never wait on device I/O.
+  void StartPollingNode(evdevDevice::Node* node);
+  void StopPollingNode(const evdevDevice::Node* node);
+
 private:
   std::shared_ptr<evdevDevice>
   FindDeviceWithUniqueIDAndPhysicalLocation(const char* unique_id, const char* physical_location);
@@ -53,10 +64,24 @@ private:
   void StopHotplugThread();
   void HotplugThreadFunc();
 
+  void StartInputThread();
+  void StopInputThread();
+  void InputThreadFunc();
+
   std::thread m_hotplug_thread;
   Common::Flag m_hotplug_thread_running;
   int m_wakeup_eventfd;
 
+  std::thread m_input_thread;
+  Common::Flag m_input_thread_running;
+  int m_input_epoll_fd;
+  int m_input_wakeup_eventfd;
+
+  // Polled nodes by file descriptor. The input thread holds the mutex while it reads events, so
+  // a node can't be destroyed in the meantime.
+  std::mutex m_polled_nodes_mutex;
+  std::map<int, evdevDevice::Node*> m_polled_nodes;
+
   // There is no easy way to get the device name from only a dev node
   // during a device removed event, since libevdev can't work on removed devices;
   // sysfs is not stable, so this is probably the easiest way to get a name for a node.
@@ -68,32 +93,50 @@ private:
   Common::WorkQueueThread<int> m_cleanup_thread;
 };
 
+static Common::Metrics::Counter s_snapshots{"evdev_input_snapshots_total",
+                                            "evdev input states picked up by input updates"};
+static Common::Metrics::Counter s_snapshot_latency{
+    "evdev_input_latency_ns_total",
+    "Time from evdev events to input updates picking them up, in nanoseconds"};
+
+static s64 GetMonotonicTimeNs()
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return s64(now.tv_sec) * 1'000'000'000 + now.tv_nsec;
+}
+
 std::unique_ptr<ciface::InputBackend> CreateInputBackend(ControllerInterface* controller_interface)
 {
   return std::make_unique<InputBackend>(controller_interface);
 }
 
+// Inputs read the state snapshot of their node, which only changes in UpdateInput().
+// libevdev itself is only queried for static information, as the input thread modifies its state.
 class Input : public Core::Device::Input
 {
 public:
-  Input(u16 code, libevdev* dev) : m_code(code), m_dev(dev) {}
+  Input(u16 code, const evdevDevice::Node& node)
+      : m_code(code), m_dev(node.device), m_state(node.state)
+  {
+  }
 
 protected:
+  const NodeState& GetNodeState() const { return m_state.GetReadBuffer(); }
+
   const u16 m_code;
   libevdev* const m_dev;
+
+private:
+  const Common::TripleBuffer<NodeState>& m_state;
 };
 
 class Button : public Input
 {
 public:
-  Button(u8 index, u16 code, libevdev* dev) : Input(code, dev), m_index(index) {}
+  Button(u8 index, u16 code, const evdevDevice::Node& node) : Input(code, node), m_index(index) {}
 
-  ControlState GetState() const final override
-  {
-    int value = 0;
-    libevdev_fetch_event_value(m_dev, EV_KEY, m_code, &value);
-    return value;
-  }
+  ControlState GetState() const final override { return GetNodeState().keys[m_code]; }
 
 protected:
   std::optional<std::string> GetEventCodeName() const
@@ -158,10 +201,7 @@ public:
 
   ControlState GetState() const final override
   {
-    int value = 0;
-    libevdev_fetch_event_value(m_dev, EV_ABS, m_code, &value);
-
-    return (value - m_base) / m_range;
+    return (GetNodeState().axes[m_code] - m_base) / m_range;
   }
 
 protected:
@@ -172,7 +212,8 @@ protected:
 class Axis : public AnalogInput
 {
 public:
-  Axis(u8 index, u16 code, bool upper, libevdev* dev) : AnalogInput(code, dev), m_index(index)
+  Axis(u8 index, u16 code, bool upper, const evdevDevice::Node& node)
+      : AnalogInput(code, node), m_index(index)
   {
     const int min = libevdev_get_abs_minimum(m_dev, m_code);
     const int max = libevdev_get_abs_maximum(m_dev, m_code);
@@ -196,7 +237,8 @@ private:
 class MotionDataInput final : public AnalogInput
 {
 public:
-  MotionDataInput(u16 code, ControlState resolution_scale, libevdev* dev) : AnalogInput(code, dev)
+  MotionDataInput(u16 code, ControlState resolution_scale, const evdevDevice::Node& node)
+      : AnalogInput(code, node)
   {
     auto* const info = libevdev_get_abs_info(m_dev, m_code);
 
@@ -273,7 +315,8 @@ void InputBackend::AddDeviceNode(const char* devnode)
   // Unfortunately udev gives us no way to filter out the non event device interfaces.
   // So we open it and see if it works with evdev ioctls or not.
 
-  // The device file will be read on one of the main threads, so we open in non-blocking mode.
+  // The device file is read on the input thread whenever it has events, and that must never block
+  // the other nodes, so we open in non-blocking mode.
   const int fd = open(devnode, O_RDWR | O_NONBLOCK);
   if (fd == -1)
   {
@@ -394,6 +437,100 @@ void InputBackend::HotplugThreadFunc()
   NOTICE_LOG_FMT(CONTROLLERINTERFACE, "evdev hotplug thread stopped");
 }
 
+void InputBackend::InputThreadFunc()
+{
+  Common::SetCurrentThreadName("evdev Input Thread");
+  NOTICE_LOG_FMT(CONTROLLERINTERFACE, "evdev input thread started");
+
+  std::array<epoll_event, 16> events;
+  while (m_input_thread_running.IsSet())
+  {
+    const int count = epoll_wait(m_input_epoll_fd, events.data(), int(events.size()), -1);
+
+    std::lock_guard lk(m_polled_nodes_mutex);
+    for (int i = 0; i < count; ++i)
+    {
+      // The node might have stopped being polled since epoll_wait() returned.
+      // This also skips the wakeup eventfd.
+      const auto it = m_polled_nodes.find(events[i].data.fd);
+      if (it == m_polled_nodes.end())
+        continue;
+
+      if (events[i].events & (EPOLLERR | EPOLLHUP))
+      {
+        // The device is gone. Stop polling it, or we'd spin until the hotplug thread removes it.
+        epoll_ctl(m_input_epoll_fd, EPOLL_CTL_DEL, it->first, nullptr);
+        m_polled_nodes.erase(it);
+        continue;
+      }
+
+      it->second->ReadEvents();
+    }
+  }
+  NOTICE_LOG_FMT(CONTROLLERINTERFACE, "evdev input thread stopped");
+}
+
+void InputBackend::StartInputThread()
+{
+  if (!m_input_thread_running.TestAndSet())
+    return;
+
+  m_input_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  ASSERT_MSG(CONTROLLERINTERFACE, m_input_epoll_fd != -1, "Couldn't create epoll instance.");
+  m_input_wakeup_eventfd = eventfd(0, 0);
+  ASSERT_MSG(CONTROLLERINTERFACE, m_input_wakeup_eventfd != -1, "Couldn't create eventfd.");
+
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = m_input_wakeup_eventfd;
+  epoll_ctl(m_input_epoll_fd, EPOLL_CTL_ADD, m_input_wakeup_eventfd, &event);
+
+  m_input_thread = std::thread(&InputBackend::InputThreadFunc, this);
+}
+
+void InputBackend::StopInputThread()
+{
+  if (!m_input_thread_running.TestAndClear())
+    return;
+
+  // Write something to the eventfd so that epoll_wait() stops blocking.
+  const uint64_t value = 1;
+  static_cast<void>(!write(m_input_wakeup_eventfd, &value, sizeof(uint64_t)));
+
+  m_input_thread.join();
+  close(m_input_wakeup_eventfd);
+  close(m_input_epoll_fd);
+}
+
+void InputBackend::StartPollingNode(evdevDevice::Node* node)
+{
+  std::lock_guard lk(m_polled_nodes_mutex);
+
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = node->fd;
+  if (epoll_ctl(m_input_epoll_fd, EPOLL_CTL_ADD, node->fd, &event) != 0)
+  {
+    ERROR_LOG_FMT(CONTROLLERINTERFACE, "evdev: Couldn't poll {}: {}", node->devnode,
+                  Common::LastStrerrorString());
+    return;
+  }
+
+  m_polled_nodes[node->fd] = node;
+}
+
+void InputBackend::StopPollingNode(const evdevDevice::Node* node)
+{
+  std::lock_guard lk(m_polled_nodes_mutex);
+
+  const auto it = m_polled_nodes.find(node->fd);
+  if (it == m_polled_nodes.end() || it->second != node)
+    return;
+
+  epoll_ctl(m_input_epoll_fd, EPOLL_CTL_DEL, node->fd, nullptr);
+  m_polled_nodes.erase(it);
+}
+
 void InputBackend::StartHotplugThread()
 {
   // Mark the thread as running.
@@ -428,6 +565,8 @@ void InputBackend::StopHotplugThread()
 InputBackend::InputBackend(ControllerInterface* controller_interface)
     : ciface::InputBackend(controller_interface), m_cleanup_thread("evdev cleanup", close)
 {
+  // Devices start being polled as soon as the hotplug thread adds them.
+  StartInputThread();
   StartHotplugThread();
 }
 
@@ -473,11 +612,70 @@ void InputBackend::PopulateDevices()
 InputBackend::~InputBackend()
 {
   StopHotplugThread();
+  StopInputThread();
+}
+
+evdevDevice::Node::Node(std::string devnode_, int fd_, libevdev* device_)
+    : devnode(std::move(devnode_)), fd(fd_), device(device_)
+{
+  // Event timestamps are compared against the time input updates pick them up.
+  libevdev_set_clock_id(device, CLOCK_MONOTONIC);
+
+  // libevdev has already read the initial state of the device.
+  for (int key = 0; key != KEY_CNT; ++key)
+  {
+    int value = 0;
+    if (libevdev_fetch_event_value(device, EV_KEY, key, &value))
+      current_state.keys[key] = value != 0;
+  }
+  for (int axis = 0; axis != ABS_CNT; ++axis)
+    libevdev_fetch_event_value(device, EV_ABS, axis, &current_state.axes[axis]);
+
+  // The node isn't polled yet, so this thread can act as both producer and consumer.
+  state.GetWriteBuffer() = current_state;
+  state.Publish();
+  state.Update();
+}
+
+void evdevDevice::Node::ReadEvents()
+{
+  // libevdev keeps track of the state internally as well, but the inputs can't query it while
+  // this thread is modifying it.
+  bool any_events = false;
+  int rc = LIBEVDEV_READ_STATUS_SUCCESS;
+  while (true)
+  {
+    input_event ev;
+    if (LIBEVDEV_READ_STATUS_SYNC == rc)
+      rc = libevdev_next_event(device, LIBEVDEV_READ_FLAG_SYNC, &ev);
+    else
+      rc = libevdev_next_event(device, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+    if (rc < 0)
+      break;
+
+    if (ev.type == EV_KEY && ev.code < KEY_CNT)
+      current_state.keys[ev.code] = ev.value != 0;
+    else if (ev.type == EV_ABS && ev.code < ABS_CNT)
+      current_state.axes[ev.code] = ev.value;
+
+    current_state.event_time =
+        s64(ev.input_event_sec) * 1'000'000'000 + s64(ev.input_event_usec) * 1'000;
+    any_events = true;
+  }
+
+  if (any_events)
+  {
+    state.GetWriteBuffer() = current_state;
+    state.Publish();
+  }
 }
 
 bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
 {
-  m_nodes.emplace_back(Node{std::move(devnode), fd, dev});
+  Node& node = *m_nodes.emplace_back(std::make_unique<Node>(std::move(devnode), fd, dev));
+
+  // Only start reading events once all inputs are created, as they query libevdev.
+  Common::ScopeGuard polling_guard([this, &node] { m_input_backend.StartPollingNode(&node); });
 
   // Take on the alphabetically first name.
   const auto potential_new_name = StripWhitespace(libevdev_get_name(dev));
@@ -502,15 +700,15 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
       {
         // This node will probably be combined with another with regular buttons.
         // We don't want to match "Button 0" names here as it will name clash.
-        AddInput(new NamedButtonWithNoBackwardsCompat(num_buttons, key, dev));
+        AddInput(new NamedButtonWithNoBackwardsCompat(num_buttons, key, node));
       }
       else if (has_sensible_button_names)
       {
-        AddInput(new NamedButton(num_buttons, key, dev));
+        AddInput(new NamedButton(num_buttons, key, node));
       }
       else
       {
-        AddInput(new NumberedButton(num_buttons, key, dev));
+        AddInput(new NumberedButton(num_buttons, key, node));
       }
 
       ++num_buttons;
@@ -523,14 +721,14 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
   {
     // If INPUT_PROP_ACCELEROMETER is set then X,Y,Z,RX,RY,RZ contain motion data.
 
-    auto add_motion_inputs = [&num_axis, dev, this](int first_code, double scale) {
+    auto add_motion_inputs = [&num_axis, &node, dev, this](int first_code, double scale) {
       for (int i = 0; i != 3; ++i)
       {
         const int code = first_code + i;
         if (libevdev_has_event_code(dev, EV_ABS, code))
         {
-          AddInput(new MotionDataInput(code, scale * -1, dev));
-          AddInput(new MotionDataInput(code, scale, dev));
+          AddInput(new MotionDataInput(code, scale * -1, node));
+          AddInput(new MotionDataInput(code, scale, node));
 
           ++num_axis;
         }
@@ -550,11 +748,11 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
 
   if (is_pointing_device)
   {
-    auto add_cursor_input = [&num_axis, dev, this](int code) {
+    auto add_cursor_input = [&num_axis, &node, dev, this](int code) {
       if (libevdev_has_event_code(dev, EV_ABS, code))
       {
-        AddInput(new CursorInput(num_axis, code, false, dev));
-        AddInput(new CursorInput(num_axis, code, true, dev));
+        AddInput(new CursorInput(num_axis, code, false, node));
+        AddInput(new CursorInput(num_axis, code, true, node));
 
         ++num_axis;
       }
@@ -574,8 +772,8 @@ bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
   {
     if (libevdev_has_event_code(dev, EV_ABS, axis))
     {
-      AddFullAnalogSurfaceInputs(new Axis(num_axis, axis, false, dev),
-                                 new Axis(num_axis, axis, true, dev));
+      AddFullAnalogSurfaceInputs(new Axis(num_axis, axis, false, node),
+                                 new Axis(num_axis, axis, true, node));
       ++num_axis;
     }
   }
@@ -650,7 +848,7 @@ const char* evdevDevice::GetUniqueID() const
   if (m_nodes.empty())
     return nullptr;
 
-  const auto uniq = libevdev_get_uniq(m_nodes.front().device);
+  const auto uniq = libevdev_get_uniq(m_nodes.front()->device);
 
   // Some devices (e.g. Mayflash adapter) return an empty string which is not very unique.
   if (uniq && std::strlen(uniq) == 0)
@@ -664,7 +862,7 @@ const char* evdevDevice::GetPhysicalLocation() const
   if (m_nodes.empty())
     return nullptr;
 
-  return libevdev_get_phys(m_nodes.front().device);
+  return libevdev_get_phys(m_nodes.front()->device);
 }
 
 evdevDevice::evdevDevice(InputBackend* input_backend) : m_input_backend(*input_backend)
@@ -675,9 +873,10 @@ evdevDevice::~evdevDevice()
 {
   for (auto& node : m_nodes)
   {
-    m_input_backend.RemoveDevnodeObject(node.devnode);
-    libevdev_free(node.device);
-    m_input_backend.CloseDescriptor(node.fd);
+    m_input_backend.StopPollingNode(node.get());
+    m_input_backend.RemoveDevnodeObject(node->devnode);
+    libevdev_free(node->device);
+    m_input_backend.CloseDescriptor(node->fd);
   }
 }
 
@@ -688,20 +887,17 @@ void InputBackend::RemoveDevnodeObject(const std::string& node)
 
 Core::DeviceRemoval evdevDevice::UpdateInput()
 {
-  // Run through all evdev events
-  // libevdev will keep track of the actual controller state internally which can be queried
-  // later with libevdev_fetch_event_value()
+  // The input thread reads events as soon as they arrive, so this only picks up the latest state
+  // of each node. It never waits on device I/O, and the inputs see a consistent state until the
+  // next call.
+  const s64 now = GetMonotonicTimeNs();
   for (auto& node : m_nodes)
   {
-    int rc = LIBEVDEV_READ_STATUS_SUCCESS;
-    while (rc >= 0)
-    {
-      input_event ev;
-      if (LIBEVDEV_READ_STATUS_SYNC == rc)
-        rc = libevdev_next_event(node.device, LIBEVDEV_READ_FLAG_SYNC, &ev);
-      else
-        rc = libevdev_next_event(node.device, LIBEVDEV_READ_FLAG_NORMAL, &ev);
-    }
+    if (!node->state.Update())
+      continue;
+
+    s_snapshots.Add();
+    s_snapshot_latency.Add(std::max<s64>(now - node->state.GetReadBuffer().event_time, 0));
   }
   return Core::DeviceRemoval::Keep;
 }
@@ -710,7 +906,7 @@ bool evdevDevice::IsValid() const
 {
   for (auto& node : m_nodes)
   {
-    const int current_fd = libevdev_get_fd(node.device);
+    const int current_fd = libevdev_get_fd(node->device);
 
     if (current_fd == -1)
       return false;
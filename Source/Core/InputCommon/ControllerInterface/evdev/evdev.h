@@ -4,9 +4,14 @@
 #pragma once
 
 #include <libevdev/libevdev.h>
+#include <array>
+#include <bitset>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+#include "Common/TripleBuffer.h"
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 
 namespace ciface::evdev
@@ -15,6 +20,15 @@ class InputBackend;
 
 std::unique_ptr<ciface::InputBackend> CreateInputBackend(ControllerInterface* controller_interface);
 
+// The state of the controls of an event device node.
+struct NodeState
+{
+  std::bitset<KEY_CNT> keys;
+  std::array<int, ABS_CNT> axes{};
+  // When the kernel generated the last event, in CLOCK_MONOTONIC nanoseconds.
+  s64 event_time = 0;
+};
+
 class evdevDevice : public Core::Device
 {
 private:
@@ -87,17 +101,29 @@ public:
   std::string GetName() const override { return m_name; }
   std::string GetSource() const override { return "evdev"; }
 
-private:
-  std::string m_name;
-
   struct Node
   {
+    Node(std::string devnode_, int fd_, libevdev* device_);
+
+    // Reads all pending events and publishes the resulting state.
+    // Only called on the backend's input thread once the node is being polled.
+    void ReadEvents();
+
     std::string devnode;
     int fd;
     libevdev* device;
+
+    // Only accessed by the input thread.
+    NodeState current_state;
+    // Published by the input thread, and picked up by UpdateInput().
+    Common::TripleBuffer<NodeState> state;
   };
 
-  std::vector<Node> m_nodes;
+private:
+  std::string m_name;
+
+  // Nodes are polled by pointer, so they must not move.
+  std::vector<std::unique_ptr<Node>> m_nodes;
 
   InputBackend& m_input_backend;
 };
@@ -3,17 +3,51 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <array>
 #include <thread>
 
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
+#include "Common/Metrics.h"
 #include "Common/Thread.h"
+#include "Common/Tracing.h"
 
 #include "Core/Core.h"
 #include "Core/System.h"
 
 namespace VideoCommon
 {
+namespace
+{
+struct PriorityMetrics
+{
+  Common::Metrics::Counter jobs;
+  Common::Metrics::Counter wait_time;
+};
+
+std::array<PriorityMetrics, AsyncShaderCompiler::NUM_PRIORITIES> s_priority_metrics{{
+    {{"shader_compile_jobs_current_frame_total", "Current frame shader compile jobs started"},
+     {"shader_compile_wait_ns_current_frame_total",
+      "Time current frame shader compile jobs spent queued, in nanoseconds"}},
+    {{"shader_compile_jobs_background_total", "Background shader compile jobs started"},
+     {"shader_compile_wait_ns_background_total",
+      "Time background shader compile jobs spent queued, in nanoseconds"}},
+}};
+
+Common::Metrics::Counter s_cancelled{"shader_compile_jobs_cancelled_total",
+                                     "Shader compile jobs skipped because they were cancelled"};
+Common::Metrics::Gauge s_queue_depth{"shader_compile_queue_depth",
+                                     "Shaders and pipelines waiting to be compiled"};
+
+// There can be several compilers at once, so the gauge reports the sum of their queues.
+std::atomic<s64> s_total_pending{0};
+
+void UpdateQueueDepth(s64 delta)
+{
+  s_queue_depth.Set(static_cast<double>(s_total_pending.fetch_add(delta) + delta));
+}
+}  // namespace
+
 AsyncShaderCompiler::AsyncShaderCompiler()
 {
 }
@@ -23,9 +57,10 @@ AsyncShaderCompiler::~AsyncShaderCompiler()
   // Pending work can be left at shutdown.
   // The work item classes are expected to clean up after themselves.
   ASSERT(!HasWorkerThreads());
+  UpdateQueueDepth(-static_cast<s64>(m_pending_count.load()));
 }
 
-void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
+void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, Priority priority)
 {
   // If no worker threads are available, compile synchronously.
   if (!HasWorkerThreads())
@@ -35,8 +70,22 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
   else
   {
-    std::lock_guard guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    item->m_priority = priority;
+    item->m_queue_time = std::chrono::steady_clock::now();
+
+    WorkQueue& queue = *m_queues[m_next_queue.fetch_add(1) % m_queues.size()];
+    {
+      std::lock_guard guard(queue.lock);
+      queue.items[static_cast<size_t>(priority)].push_back(std::move(item));
+      m_pending_count++;
+    }
+    UpdateQueueDepth(1);
+
+    // Taking the lock ensures that a worker can't see no pending work and then go to sleep after
+    // we notify it.
+    {
+      std::lock_guard guard(m_wake_lock);
+    }
     m_worker_thread_wake.notify_one();
   }
 }
@@ -51,15 +100,16 @@ void AsyncShaderCompiler::RetrieveWorkItems()
 
   while (!completed_work.empty())
   {
-    completed_work.front()->Retrieve();
+    if (!completed_work.front()->IsCancelled())
+      completed_work.front()->Retrieve();
     completed_work.pop_front();
   }
 }
 
 bool AsyncShaderCompiler::HasPendingWork()
 {
-  std::lock_guard guard(m_pending_work_lock);
-  return !m_pending_work.empty() || m_busy_workers.load() != 0;
+  // m_pending_count must be read first, see m_busy_workers.
+  return m_pending_count.load() != 0 || m_busy_workers.load() != 0;
 }
 
 bool AsyncShaderCompiler::HasCompletedWork()
@@ -70,9 +120,15 @@ bool AsyncShaderCompiler::HasCompletedWork()
 
 void AsyncShaderCompiler::ClearAllWork()
 {
+  for (const auto& queue : m_queues)
   {
-    std::lock_guard guard(m_pending_work_lock);
-    m_pending_work.clear();
+    std::lock_guard guard(queue->lock);
+    for (std::deque<WorkItemPtr>& items : queue->items)
+    {
+      m_pending_count -= items.size();
+      UpdateQueueDepth(-static_cast<s64>(items.size()));
+      items.clear();
+    }
   }
 
   {
@@ -101,22 +157,16 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   // Grab the number of pending items. We use this to work out how many are left.
   size_t total_items;
   {
-    // Safe to hold both locks here, since nowhere else does.
-    std::lock_guard pending_guard(m_pending_work_lock);
     std::lock_guard completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items = m_completed_work.size() + m_pending_count.load() + m_busy_workers.load() + 1;
   }
 
   // Update progress while the compiles complete.
   while (Core::GetState(Core::System::GetInstance()) != Core::State::Stopping)
   {
-    size_t remaining_items;
-    {
-      std::lock_guard pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
-        return true;
-      remaining_items = m_pending_work.size();
-    }
+    if (!HasPendingWork())
+      return true;
+    const size_t remaining_items = m_pending_count.load();
 
     progress_callback(total_items - remaining_items, total_items);
     std::this_thread::sleep_for(CHECK_INTERVAL);
@@ -129,6 +179,8 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
   if (num_worker_threads == 0)
     return true;
 
+  ResizeQueues(num_worker_threads);
+
   for (u32 i = 0; i < num_worker_threads; i++)
   {
     void* thread_param = nullptr;
@@ -140,7 +192,7 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 
     m_worker_thread_start_result.store(false);
 
-    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param);
+    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param, i);
     m_init_event.Wait();
 
     if (!m_worker_thread_start_result.load())
@@ -177,7 +229,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
 
   // Signal worker threads to stop, and wake all of them.
   {
-    std::lock_guard guard(m_pending_work_lock);
+    std::lock_guard guard(m_wake_lock);
     m_exit_flag.Set();
     m_worker_thread_wake.notify_all();
   }
@@ -203,7 +255,30 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 {
 }
 
-void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
+void AsyncShaderCompiler::ResizeQueues(size_t num_queues)
+{
+  if (m_queues.size() == num_queues)
+    return;
+
+  // Keep any work that was left queued when the worker threads were stopped.
+  std::vector<std::unique_ptr<WorkQueue>> queues(num_queues);
+  for (std::unique_ptr<WorkQueue>& queue : queues)
+    queue = std::make_unique<WorkQueue>();
+
+  size_t next_queue = 0;
+  for (size_t priority = 0; priority < NUM_PRIORITIES; priority++)
+  {
+    for (const auto& old_queue : m_queues)
+    {
+      for (WorkItemPtr& item : old_queue->items[priority])
+        queues[next_queue++ % num_queues]->items[priority].push_back(std::move(item));
+    }
+  }
+
+  m_queues = std::move(queues);
+}
+
+void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param, size_t queue_index)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
 
@@ -219,35 +294,75 @@ void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
   m_worker_thread_start_result.store(true);
   m_init_event.Set();
 
-  WorkerThreadRun();
+  WorkerThreadRun(queue_index);
 
   WorkerThreadExit(param);
 }
 
-void AsyncShaderCompiler::WorkerThreadRun()
+AsyncShaderCompiler::WorkItemPtr AsyncShaderCompiler::TakeWorkItem(size_t queue_index)
+{
+  const size_t num_queues = m_queues.size();
+  for (size_t priority = 0; priority < NUM_PRIORITIES; priority++)
+  {
+    // Check our own queue first, then steal from the others.
+    for (size_t i = 0; i < num_queues; i++)
+    {
+      WorkQueue& queue = *m_queues[(queue_index + i) % num_queues];
+      std::lock_guard guard(queue.lock);
+      std::deque<WorkItemPtr>& items = queue.items[priority];
+      if (items.empty())
+        continue;
+
+      WorkItemPtr item = std::move(items.front());
+      items.pop_front();
+      m_busy_workers++;
+      m_pending_count--;
+      return item;
+    }
+  }
+
+  return nullptr;
+}
+
+void AsyncShaderCompiler::WorkerThreadRun(size_t queue_index)
 {
-  std::unique_lock pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
+    WorkItemPtr item = TakeWorkItem(queue_index);
+    if (!item)
+    {
+      std::unique_lock wake_lock(m_wake_lock);
+      m_worker_thread_wake.wait(
+          wake_lock, [this] { return m_exit_flag.IsSet() || m_pending_count.load() != 0; });
+      continue;
+    }
+
+    UpdateQueueDepth(-1);
+    const auto wait_time = std::chrono::steady_clock::now() - item->m_queue_time;
+    PriorityMetrics& metrics = s_priority_metrics[static_cast<size_t>(item->m_priority)];
+    metrics.jobs.Add();
+    metrics.wait_time.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(wait_time).count());
 
-    while (!m_pending_work.empty() && !m_exit_flag.IsSet())
+    bool compiled = true;
+    if (item->IsCancelled())
     {
-      m_busy_workers++;
-      auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
-      m_pending_work.erase(iter);
-      pending_lock.unlock();
-
-      if (item->Compile())
-      {
-        std::lock_guard completed_guard(m_completed_work_lock);
-        m_completed_work.push_back(std::move(item));
-      }
-
-      pending_lock.lock();
-      m_busy_workers--;
+      s_cancelled.Add();
     }
+    else
+    {
+      TRACE_SCOPE("Shader", "Compile job");
+      compiled = item->Compile();
+    }
+
+    // Cancelled work items are still destroyed by RetrieveWorkItems(), as they may own objects
+    // which must be destroyed on that thread.
+    if (compiled)
+    {
+      std::lock_guard completed_guard(m_completed_work_lock);
+      m_completed_work.push_back(std::move(item));
+    }
+
+    m_busy_workers--;
   }
 }
 
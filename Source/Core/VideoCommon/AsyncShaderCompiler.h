@@ -3,11 +3,12 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <functional>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -23,12 +24,37 @@ namespace VideoCommon
 class AsyncShaderCompiler
 {
 public:
+  // Work items are compiled in order of priority, and in the order they were queued within a
+  // priority.
+  enum class Priority
+  {
+    // Specialized shaders needed by the current frame, which are drawn with a fallback until they
+    // are ready.
+    CurrentFrame,
+    // Precompiling shaders which may not be needed at all.
+    Background,
+  };
+  static constexpr size_t NUM_PRIORITIES = static_cast<size_t>(Priority::Background) + 1;
+
   class WorkItem
   {
   public:
     virtual ~WorkItem() = default;
     virtual bool Compile() = 0;
     virtual void Retrieve() = 0;
+
+    // Marks the work item as no longer needed. If it has not started compiling yet, Compile() is
+    // never called. Either way, Retrieve() is not called, and the work item is destroyed on the
+    // thread calling RetrieveWorkItems(). Must be called before the work item is retrieved.
+    void Cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+    bool IsCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+  private:
+    friend class AsyncShaderCompiler;
+
+    std::atomic_bool m_cancelled{false};
+    Priority m_priority = Priority::Background;
+    std::chrono::steady_clock::time_point m_queue_time;
   };
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
@@ -42,9 +68,8 @@ public:
     return std::make_unique<T>(std::forward<Params>(params)...);
   }
 
-  // Queues a new work item to the compiler threads. The lower the priority, the sooner
-  // this work item will be compiled, relative to the other work items.
-  void QueueWorkItem(WorkItemPtr item, u32 priority);
+  // Queues a new work item to the compiler threads.
+  void QueueWorkItem(WorkItemPtr item, Priority priority);
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
@@ -68,8 +93,19 @@ protected:
   virtual void WorkerThreadExit(void* param);
 
 private:
-  void WorkerThreadEntryPoint(void* param);
-  void WorkerThreadRun();
+  // Each worker thread has its own queue, which producers distribute work items between, so that
+  // workers don't all contend on a single lock. A worker whose queue has nothing at a priority
+  // takes work from the other queues before moving on to the next priority.
+  struct WorkQueue
+  {
+    std::mutex lock;
+    std::array<std::deque<WorkItemPtr>, NUM_PRIORITIES> items;
+  };
+
+  void WorkerThreadEntryPoint(void* param, size_t queue_index);
+  void WorkerThreadRun(size_t queue_index);
+  WorkItemPtr TakeWorkItem(size_t queue_index);
+  void ResizeQueues(size_t num_queues);
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -77,11 +113,18 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
-  // A multimap is used to store the work items. We can't use a priority_queue here, because
-  // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
-  std::mutex m_pending_work_lock;
+  // Only resized while there are no worker threads.
+  std::vector<std::unique_ptr<WorkQueue>> m_queues;
+  std::atomic_size_t m_next_queue{0};
+
+  // Incremented after a work item is pushed to a queue, and decremented after one is popped, with
+  // the queue's lock held. Workers sleep until it is non-zero.
+  std::atomic_size_t m_pending_count{0};
+  std::mutex m_wake_lock;
   std::condition_variable m_worker_thread_wake;
+
+  // Incremented before m_pending_count is decremented, so that the two are never both zero while a
+  // work item is in flight.
   std::atomic_size_t m_busy_workers{0};
 
   std::deque<WorkItemPtr> m_completed_work;
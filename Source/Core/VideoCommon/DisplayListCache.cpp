@@ -0,0 +1,135 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DisplayListCache.h"
+
+#include <algorithm>
+
+#include <xxhash.h>
+
+#include "Common/Assert.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+namespace OpcodeDecoder
+{
+DisplayListCache g_display_list_cache;
+
+namespace
+{
+// Upper bound on the number of display lists tracked, so that games which build display lists
+// at ever-changing addresses don't grow the cache indefinitely.
+constexpr size_t MAX_ENTRIES = 8192;
+
+// Records the commands of a display list instead of executing them. CP writes are applied to a
+// copy of the CP state so that vertex sizes are computed the same way as when running it.
+class DecodeCallback final : public Callback
+{
+public:
+  DecodeCallback(const u8* data, const CPState& cp_state, std::vector<DecodedCommand>* commands)
+      : m_data(data), m_cp_state(cp_state), m_commands(commands)
+  {
+  }
+
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+  {
+    Add({.type = DecodedCommand::Type::XF, .reg = count, .address = address});
+  }
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+  {
+    m_cp_state.LoadCPReg(command, value);
+    Add({.type = DecodedCommand::Type::CP, .reg = command, .value = value});
+  }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+  {
+    Add({.type = DecodedCommand::Type::BP, .reg = command, .value = value});
+  }
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+  {
+    Add({.type = DecodedCommand::Type::IndexedLoad,
+         .reg = size,
+         .kind = static_cast<u8>(array),
+         .address = address,
+         .value = index});
+  }
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices, const u8* vertex_data))
+  {
+    Add({.type = DecodedCommand::Type::Primitive,
+         .reg = vat,
+         .kind = static_cast<u8>(primitive),
+         .address = num_vertices,
+         .value = vertex_size});
+  }
+  OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size))
+  {
+    Add({.type = DecodedCommand::Type::Other});
+  }
+  OPCODE_CALLBACK(void OnNop(u32 count)) { Add({.type = DecodedCommand::Type::Nop}); }
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+  {
+    Add({.type = DecodedCommand::Type::Other});
+  }
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size))
+  {
+    ASSERT(!m_commands->empty());
+    DecodedCommand& command = m_commands->back();
+    command.offset = static_cast<u32>(data - m_data);
+    command.size = size;
+  }
+  OPCODE_CALLBACK(CPState& GetCPState()) { return m_cp_state; }
+
+private:
+  void Add(const DecodedCommand& command) { m_commands->push_back(command); }
+
+  const u8* m_data;
+  CPState m_cp_state;
+  std::vector<DecodedCommand>* m_commands;
+};
+}  // namespace
+
+DecodedDisplayList* DisplayListCache::Get(u32 address, const u8* data, u32 size,
+                                          const CPState& cp_state)
+{
+  const u64 hash = XXH3_64bits(data, size);
+
+  auto it = m_entries.find(address);
+  if (it == m_entries.end())
+  {
+    if (m_entries.size() >= MAX_ENTRIES)
+      m_entries.clear();
+
+    m_entries.emplace(address, DecodedDisplayList{.size = size, .hash = hash});
+    return nullptr;
+  }
+
+  DecodedDisplayList& entry = it->second;
+  if (entry.size != size || entry.hash != hash)
+  {
+    // The display list was modified or replaced since the last call.
+    entry = DecodedDisplayList{.size = size, .hash = hash};
+    return nullptr;
+  }
+
+  if (!entry.decoded)
+  {
+    DecodeCallback callback(data, cp_state, &entry.commands);
+    entry.decoded_size = Run(data, size, callback);
+    entry.commands.shrink_to_fit();
+    entry.cached_vertices.resize(std::ranges::count(entry.commands, DecodedCommand::Type::Primitive,
+                                                    &DecodedCommand::type));
+    entry.decoded = true;
+  }
+
+  return &entry;
+}
+
+void DisplayListCache::Invalidate(u32 address)
+{
+  m_entries.erase(address);
+}
+
+void DisplayListCache::Clear()
+{
+  m_entries.clear();
+}
+}  // namespace OpcodeDecoder
@@ -0,0 +1,153 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Many games build their static geometry and state setup into display lists once, and then call
+// the same display lists every frame. Instead of parsing those again on every call, display lists
+// that are called repeatedly with the same contents are decoded once into a compact command
+// stream with all register writes already extracted, which is then replayed on later calls.
+
+#pragma once
+
+#include <concepts>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+namespace OpcodeDecoder
+{
+struct DecodedCommand
+{
+  enum class Type : u8
+  {
+    XF,
+    CP,
+    BP,
+    IndexedLoad,
+    Primitive,
+    Nop,
+    // Nested display lists and unknown opcodes, which are rare and are run through the regular
+    // decoder when replayed.
+    Other,
+  };
+
+  Type type;
+  // CP/BP: register. XF: count. Indexed load: size. Primitive: VAT.
+  u8 reg;
+  // Indexed load: array. Primitive: primitive type.
+  u8 kind;
+  // XF and indexed load: address. Primitive: number of vertices.
+  u16 address;
+  // CP/BP: value. Indexed load: index. Primitive: vertex size.
+  u32 value;
+  // Location and size of the command within the display list.
+  u32 offset;
+  u32 size;
+};
+
+struct DecodedDisplayList
+{
+  // Size and hash of the display list this was decoded from.
+  u32 size = 0;
+  u64 hash = 0;
+  // Number of bytes covered by the decoded commands. This is less than the size if the display
+  // list ends with an incomplete command.
+  u32 decoded_size = 0;
+  std::vector<DecodedCommand> commands;
+  // One entry per primitive command, for callbacks which keep the converted vertices.
+  std::vector<VertexLoaderManager::CachedVertices> cached_vertices;
+  bool decoded = false;
+};
+
+class DisplayListCache
+{
+public:
+  // Returns the decoded version of the display list with the given contents, or nullptr if the
+  // display list should be run through the regular decoder. Display lists are only decoded once
+  // they have been called twice with the same contents, so that display lists which are rebuilt
+  // before every call don't pay for decoding. <cp_state> is the CP state at the time of the call.
+  DecodedDisplayList* Get(u32 address, const u8* data, u32 size, const CPState& cp_state);
+
+  // Forgets about the display list at the given address.
+  void Invalidate(u32 address);
+
+  void Clear();
+
+private:
+  std::unordered_map<u32, DecodedDisplayList> m_entries;
+};
+
+extern DisplayListCache g_display_list_cache;
+
+// Replays a display list returned by DisplayListCache::Get, whose contents are at <data>.
+//
+// Returns the number of bytes of the display list that have been processed. If a vertex format
+// changed since the display list was decoded (through CP writes before the call), this stops at
+// the first affected primitive, and the remainder has to be run through Run() instead.
+//
+// Primitives are passed to OnCachedPrimitiveCommand along with their CachedVertices entry if the
+// callback has that function, and to OnPrimitiveCommand otherwise.
+u32 RunDecoded(DecodedDisplayList& display_list, const u8* data,
+               std::derived_from<Callback> auto& callback)
+{
+  size_t primitive_index = 0;
+  for (const DecodedCommand& command : display_list.commands)
+  {
+    const u8* const command_data = data + command.offset;
+
+    switch (command.type)
+    {
+    case DecodedCommand::Type::XF:
+      callback.OnXF(command.address, command.reg, command_data + 5);
+      break;
+    case DecodedCommand::Type::CP:
+      callback.OnCP(command.reg, command.value);
+      break;
+    case DecodedCommand::Type::BP:
+      callback.OnBP(command.reg, command.value);
+      break;
+    case DecodedCommand::Type::IndexedLoad:
+      callback.OnIndexedLoad(static_cast<CPArray>(command.kind), command.value, command.address,
+                             command.reg);
+      break;
+    case DecodedCommand::Type::Primitive:
+    {
+      if (callback.GetVertexSize(command.reg) != command.value)
+        return command.offset;
+
+      const auto primitive = static_cast<Primitive>(command.kind);
+      VertexLoaderManager::CachedVertices* const cached_vertices =
+          &display_list.cached_vertices[primitive_index++];
+      if constexpr (requires {
+                      callback.OnCachedPrimitiveCommand(primitive, command.reg, command.value,
+                                                        command.address, command_data + 3,
+                                                        cached_vertices);
+                    })
+      {
+        callback.OnCachedPrimitiveCommand(primitive, command.reg, command.value, command.address,
+                                          command_data + 3, cached_vertices);
+      }
+      else
+      {
+        callback.OnPrimitiveCommand(primitive, command.reg, command.value, command.address,
+                                    command_data + 3);
+      }
+      break;
+    }
+    case DecodedCommand::Type::Nop:
+      callback.OnNop(command.size);
+      break;
+    case DecodedCommand::Type::Other:
+      detail::RunCommand(command_data, command.size, callback);
+      break;
+    }
+
+    callback.OnCommand(command_data, command.size);
+  }
+
+  return display_list.decoded_size;
+}
+}  // namespace OpcodeDecoder
@@ -9,6 +9,7 @@
 #endif
 
 #include <array>
+#include <chrono>
 #include <string>
 
 #include <fmt/chrono.h>
@@ -17,6 +18,7 @@
 extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
+#include <libavutil/buffer.h>
 #include <libavutil/error.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
@@ -301,6 +303,11 @@ bool FFMpegFrameDump::CreateVideoFile()
   if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
     av_opt_set_int(m_context->codec->priv_data, "pred", 3, 0);  // median
 
+  // Let the encoder use as many threads as it supports, so that encoding runs in parallel with
+  // the conversion of the next frame.
+  m_context->codec->thread_count = 0;
+  m_context->codec->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
   if (output_format->flags & AVFMT_GLOBALHEADER)
     m_context->codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
 
@@ -320,6 +327,29 @@ bool FFMpegFrameDump::CreateVideoFile()
   if (av_frame_get_buffer(m_context->scaled_frame, 1))
     return false;
 
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+  // The conversion is split into slices that are converted on multiple threads.
+  m_context->sws = sws_alloc_context();
+  if (!m_context->sws)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate scaling context");
+    return false;
+  }
+  av_opt_set_int(m_context->sws, "srcw", m_context->width, 0);
+  av_opt_set_int(m_context->sws, "srch", m_context->height, 0);
+  av_opt_set_int(m_context->sws, "src_format", AV_PIX_FMT_RGBA, 0);
+  av_opt_set_int(m_context->sws, "dstw", m_context->width, 0);
+  av_opt_set_int(m_context->sws, "dsth", m_context->height, 0);
+  av_opt_set_int(m_context->sws, "dst_format", m_context->codec->pix_fmt, 0);
+  av_opt_set_int(m_context->sws, "sws_flags", SWS_BICUBIC, 0);
+  av_opt_set_int(m_context->sws, "threads", 0, 0);
+  if (sws_init_context(m_context->sws, nullptr, nullptr) < 0)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not initialize scaling context");
+    return false;
+  }
+#endif
+
   m_context->stream = avformat_new_stream(m_context->format, codec);
   if (!m_context->stream ||
       avcodec_parameters_from_context(m_context->stream->codecpar, m_context->codec) < 0)
@@ -354,17 +384,17 @@ bool FFMpegFrameDump::IsFirstFrameInCurrentFile() const
   return m_context->last_pts == AV_NOPTS_VALUE;
 }
 
-void FFMpegFrameDump::AddFrame(const FrameData& frame)
+FrameDumpTimings FFMpegFrameDump::AddFrame(const FrameData& frame)
 {
   // Are we even dumping?
   if (!IsStarted())
-    return;
+    return {};
 
   CheckForConfigChange(frame);
 
   // Handle failure after a config change.
   if (!IsStarted())
-    return;
+    return {};
 
   // Calculate presentation timestamp from ticks since start.
   const s64 pts = av_rescale_q(
@@ -378,7 +408,7 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
     if (pts <= m_context->last_pts)
     {
       WARN_LOG_FMT(FRAMEDUMP, "PTS delta < 1. Current frame will not be dumped.");
-      return;
+      return {};
     }
     else if (pts > m_context->last_pts + 1 && !m_context->gave_vfr_warning)
     {
@@ -388,8 +418,37 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
     }
   }
 
+  FrameDumpTimings timings;
+  const auto conversion_start = std::chrono::steady_clock::now();
+
   constexpr AVPixelFormat pix_fmt = AV_PIX_FMT_RGBA;
 
+  // The encoder may still hold a reference to the previous frame when it encodes on other threads.
+  if (const int error = av_frame_make_writable(m_context->scaled_frame))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate frame: {}", AVErrorString(error));
+    return {};
+  }
+
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+  // Convert image from RGBA to desired pixel format. This needs the source in a (non-owning)
+  // reference counted buffer, otherwise swscale would make a copy of it.
+  if (frame.width == m_context->width && frame.height == m_context->height)
+  {
+    m_context->src_frame->buf[0] = av_buffer_create(
+        const_cast<u8*>(frame.data), static_cast<size_t>(frame.stride) * frame.height,
+        [](void*, u8*) {}, nullptr, AV_BUFFER_FLAG_READONLY);
+    m_context->src_frame->data[0] = const_cast<u8*>(frame.data);
+    m_context->src_frame->linesize[0] = frame.stride;
+    m_context->src_frame->format = pix_fmt;
+    m_context->src_frame->width = frame.width;
+    m_context->src_frame->height = frame.height;
+
+    if (m_context->src_frame->buf[0])
+      sws_scale_frame(m_context->sws, m_context->scaled_frame, m_context->src_frame);
+    av_frame_unref(m_context->src_frame);
+  }
+#else
   m_context->src_frame->data[0] = const_cast<u8*>(frame.data);
   m_context->src_frame->linesize[0] = frame.stride;
   m_context->src_frame->format = pix_fmt;
@@ -405,6 +464,10 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
   }
+#endif
+
+  const auto encoding_start = std::chrono::steady_clock::now();
+  timings.conversion = encoding_start - conversion_start;
 
   m_context->last_pts = pts;
   m_context->scaled_frame->pts = pts;
@@ -412,10 +475,13 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
-    return;
+    return timings;
   }
 
   ProcessPackets();
+
+  timings.encoding = std::chrono::steady_clock::now() - encoding_start;
+  return timings;
 }
 
 void FFMpegFrameDump::ProcessPackets()
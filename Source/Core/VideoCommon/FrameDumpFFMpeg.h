@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <ctime>
 #include <limits>
 #include <memory>
@@ -32,6 +33,12 @@ struct FrameData
   FrameState state;
 };
 
+struct FrameDumpTimings
+{
+  std::chrono::nanoseconds conversion{};
+  std::chrono::nanoseconds encoding{};
+};
+
 class FFMpegFrameDump
 {
 public:
@@ -39,7 +46,7 @@ public:
   ~FFMpegFrameDump();
 
   bool Start(int w, int h, u64 start_ticks);
-  void AddFrame(const FrameData&);
+  FrameDumpTimings AddFrame(const FrameData&);
   void Stop();
   void DoState(PointerWrap&);
   bool IsStarted() const;
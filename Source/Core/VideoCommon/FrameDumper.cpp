@@ -3,9 +3,12 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <utility>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
+#include "Common/Logging/Log.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
@@ -61,13 +64,23 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  ReadbackTexture& readback = m_readback_textures[m_next_readback_texture];
+
+  // If all textures hold frames that haven't been read back yet, the oldest one is this one.
+  if (readback.readback_state == ReadbackState::Copied)
+    QueueOldestCopiedFrame();
+  if (readback.readback_state == ReadbackState::Dumping)
+    WaitForReadbackTexture(readback);
+
+  if (!CheckFrameDumpReadbackTexture(readback, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  readback.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, readback.texture->GetRect());
+  readback.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  readback.readback_state = ReadbackState::Copied;
+
+  m_next_readback_texture = (m_next_readback_texture + 1) % NUM_READBACK_TEXTURES;
+  ++m_num_copied_frames;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -98,9 +111,10 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(ReadbackTexture& readback, u32 target_width,
+                                                u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
+  std::unique_ptr<AbstractStagingTexture>& rbtex = readback.texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -117,60 +131,97 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_num_copied_frames == 0)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  // When dumping to video, keep the latest frames in flight so that mapping them doesn't stall on
+  // the GPU. Screenshots are written as soon as possible instead.
+  const size_t frames_in_flight =
+      Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES) ? NUM_READBACK_TEXTURES - 1 : 0;
+  while (m_num_copied_frames > frames_in_flight)
+    QueueOldestCopiedFrame();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
+}
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+void FrameDumper::QueueOldestCopiedFrame()
+{
+  ASSERT(m_num_copied_frames > 0);
+  const size_t index = (m_next_readback_texture + NUM_READBACK_TEXTURES - m_num_copied_frames) %
+                       NUM_READBACK_TEXTURES;
+  ReadbackTexture& readback = m_readback_textures[index];
+  --m_num_copied_frames;
+
+  const auto wait_start = std::chrono::steady_clock::now();
+  readback.texture->Flush();
+  const bool mapped = readback.texture->Map();
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    std::lock_guard lk(m_frame_dump_queue_lock);
+    m_frame_dump_stats.readback_wait += std::chrono::steady_clock::now() - wait_start;
   }
-  else
+
+  if (!mapped)
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    readback.readback_state = ReadbackState::Free;
+    return;
   }
 
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+  readback.readback_state = ReadbackState::Dumping;
+  DumpFrameData(readback);
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure the queued readbacks have been sent to the encoder.
+  while (m_num_copied_frames > 0)
+    QueueOldestCopiedFrame();
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
+  // Ensure previous frames have been encoded.
   FinishFrameData();
 
   // Wake thread up, and wait for it to exit.
-  m_frame_dump_thread_running.Clear();
-  m_frame_dump_start.Set();
+  {
+    std::lock_guard lk(m_frame_dump_queue_lock);
+    m_frame_dump_thread_running.Clear();
+  }
+  m_frame_dump_start.notify_one();
   if (m_frame_dump_thread.joinable())
     m_frame_dump_thread.join();
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (ReadbackTexture& readback : m_readback_textures)
+    readback = {};
+  m_next_readback_texture = 0;
+
+  const FrameDumpStats stats = GetStats();
+  if (stats.frames != 0)
+  {
+    const auto per_frame = [&stats](std::chrono::nanoseconds time) {
+      return std::chrono::duration<double, std::milli>(time).count() / stats.frames;
+    };
+    INFO_LOG_FMT(VIDEO,
+                 "Dumped {} frames. Per frame: {:.2f} ms readback wait, {:.2f} ms dump wait, "
+                 "{:.2f} ms conversion, {:.2f} ms encoding",
+                 stats.frames, per_frame(stats.readback_wait), per_frame(stats.dump_wait),
+                 per_frame(stats.conversion), per_frame(stats.encoding));
+  }
+  m_frame_dump_stats = {};
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(ReadbackTexture& readback)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  AbstractStagingTexture* const texture = readback.texture.get();
+  const FrameData frame{reinterpret_cast<u8*>(texture->GetMappedPointer()),
+                        static_cast<int>(texture->GetConfig().width),
+                        static_cast<int>(texture->GetConfig().height),
+                        static_cast<int>(texture->GetMappedStride()), readback.state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -181,19 +232,39 @@ void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
   }
 
   // Wake worker thread up.
-  m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
+  {
+    std::lock_guard lk(m_frame_dump_queue_lock);
+    readback.sequence = m_frames_queued++;
+    m_frame_dump_queue.push_back({frame, readback.sequence});
+  }
+  m_frame_dump_start.notify_one();
 }
 
-void FrameDumper::FinishFrameData()
+void FrameDumper::WaitForReadbackTexture(ReadbackTexture& readback)
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  ASSERT(readback.readback_state == ReadbackState::Dumping);
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  {
+    std::unique_lock lk(m_frame_dump_queue_lock);
+    if (m_frames_dumped <= readback.sequence)
+    {
+      const auto wait_start = std::chrono::steady_clock::now();
+      m_frame_dump_done.wait(lk, [&] { return m_frames_dumped > readback.sequence; });
+      m_frame_dump_stats.dump_wait += std::chrono::steady_clock::now() - wait_start;
+    }
+  }
 
-  m_frame_dump_output_texture->Unmap();
+  readback.texture->Unmap();
+  readback.readback_state = ReadbackState::Free;
+}
+
+void FrameDumper::FinishFrameData()
+{
+  for (ReadbackTexture& readback : m_readback_textures)
+  {
+    if (readback.readback_state == ReadbackState::Dumping)
+      WaitForReadbackTexture(readback);
+  }
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -215,11 +286,18 @@ void FrameDumper::FrameDumpThreadFunc()
 
   while (true)
   {
-    m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
+    FrameData frame;
+    {
+      std::unique_lock lk(m_frame_dump_queue_lock);
+      m_frame_dump_start.wait(lk, [this] {
+        return !m_frame_dump_queue.empty() || !m_frame_dump_thread_running.IsSet();
+      });
+      if (m_frame_dump_queue.empty())
+        break;
+      frame = m_frame_dump_queue.front().frame;
+    }
 
-    auto frame = m_frame_dump_data;
+    FrameDumpTimings timings;
 
     // Save screenshot
     if (m_screenshot_request.TestAndClear())
@@ -252,13 +330,27 @@ void FrameDumper::FrameDumpThreadFunc()
       if (frame_dump_started)
       {
         if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
+        {
+          timings = DumpFrameToFFMPEG(frame);
+        }
         else
+        {
+          const auto start = std::chrono::steady_clock::now();
           DumpFrameToImage(frame);
+          timings.encoding = std::chrono::steady_clock::now() - start;
+        }
       }
     }
 
-    m_frame_dump_done.Set();
+    {
+      std::lock_guard lk(m_frame_dump_queue_lock);
+      m_frame_dump_queue.pop_front();
+      ++m_frames_dumped;
+      ++m_frame_dump_stats.frames;
+      m_frame_dump_stats.conversion += timings.conversion;
+      m_frame_dump_stats.encoding += timings.encoding;
+    }
+    m_frame_dump_done.notify_one();
   }
 
   if (frame_dump_started)
@@ -280,9 +372,9 @@ bool FrameDumper::StartFrameDumpToFFMPEG(const FrameData& frame)
   return m_ffmpeg_dump.Start(frame.width, frame.height, start_ticks);
 }
 
-void FrameDumper::DumpFrameToFFMPEG(const FrameData& frame)
+FrameDumpTimings FrameDumper::DumpFrameToFFMPEG(const FrameData& frame)
 {
-  m_ffmpeg_dump.AddFrame(frame);
+  return m_ffmpeg_dump.AddFrame(frame);
 }
 
 void FrameDumper::StopFrameDumpToFFMPEG()
@@ -297,8 +389,9 @@ bool FrameDumper::StartFrameDumpToFFMPEG(const FrameData&)
   return false;
 }
 
-void FrameDumper::DumpFrameToFFMPEG(const FrameData&)
+FrameDumpTimings FrameDumper::DumpFrameToFFMPEG(const FrameData&)
 {
+  return {};
 }
 
 void FrameDumper::StopFrameDumpToFFMPEG()
@@ -356,6 +449,12 @@ bool FrameDumper::IsFrameDumping() const
   return false;
 }
 
+FrameDumpStats FrameDumper::GetStats()
+{
+  std::lock_guard lk(m_frame_dump_queue_lock);
+  return m_frame_dump_stats;
+}
+
 int FrameDumper::GetRequiredResolutionLeastCommonMultiple() const
 {
   if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
@@ -3,6 +3,15 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -16,6 +25,20 @@ class AbstractStagingTexture;
 class AbstractTexture;
 class AbstractFramebuffer;
 
+// Time spent in each stage of frame dumping, to find out which one limits the dumping speed.
+struct FrameDumpStats
+{
+  u64 frames = 0;
+  // Video thread waiting for the GPU to finish copying a frame to a readback texture.
+  std::chrono::nanoseconds readback_wait{};
+  // Video thread waiting for the dump thread to finish with a readback texture.
+  std::chrono::nanoseconds dump_wait{};
+  // Dump thread converting frames to the pixel format of the encoder.
+  std::chrono::nanoseconds conversion{};
+  // Dump thread encoding and writing frames.
+  std::chrono::nanoseconds encoding{};
+};
+
 class FrameDumper
 {
 public:
@@ -35,13 +58,45 @@ public:
   bool IsFrameDumping() const;
   int GetRequiredResolutionLeastCommonMultiple() const;
 
+  // Totals since frame dumping was last started.
+  FrameDumpStats GetStats();
+
   void DoState(PointerWrap& p);
 
 private:
+  // Number of staging textures frames are read back into. When dumping to video, frames are only
+  // mapped once the following frames have been copied, so that the GPU has already finished the
+  // copy, and the dump thread can work on an older frame in the meantime.
+  static constexpr size_t NUM_READBACK_TEXTURES = 3;
+
+  enum class ReadbackState
+  {
+    Free,
+    // A copy of the frame has been queued on the GPU.
+    Copied,
+    // The texture is mapped and has been handed to the dump thread.
+    Dumping,
+  };
+
+  struct ReadbackTexture
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    FrameState state;
+    ReadbackState readback_state = ReadbackState::Free;
+    // Position of the frame in the dump thread's queue, when Dumping.
+    u64 sequence = 0;
+  };
+
+  struct QueuedFrame
+  {
+    FrameData frame;
+    u64 sequence;
+  };
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameData&);
-  void DumpFrameToFFMPEG(const FrameData&);
+  FrameDumpTimings DumpFrameToFFMPEG(const FrameData&);
   void StopFrameDumpToFFMPEG();
   std::string GetFrameDumpNextImageFileName() const;
   bool StartFrameDumpToImage(const FrameData&);
@@ -53,10 +108,17 @@ private:
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
   // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  bool CheckFrameDumpReadbackTexture(ReadbackTexture& readback, u32 target_width,
+                                     u32 target_height);
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Maps the oldest copied frame and queues it for encoding.
+  void QueueOldestCopiedFrame();
+
+  // Asynchronously encodes the frame in the specified mapped readback texture.
+  void DumpFrameData(ReadbackTexture& readback);
+
+  // Waits until the dump thread is done with the readback texture, and makes it available again.
+  void WaitForReadbackTexture(ReadbackTexture& readback);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -64,29 +126,26 @@ private:
   std::thread m_frame_dump_thread;
   Common::Flag m_frame_dump_thread_running;
 
-  // Used to kick frame dump thread.
-  Common::Event m_frame_dump_start;
-
-  // Set by frame dump thread on frame completion.
-  Common::Event m_frame_dump_done;
-
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
+  // Communication of frames between video and dump threads.
+  std::mutex m_frame_dump_queue_lock;
+  // Signalled when a frame is queued, or the thread should exit.
+  std::condition_variable m_frame_dump_start;
+  // Signalled by the dump thread on frame completion.
+  std::condition_variable m_frame_dump_done;
+  std::deque<QueuedFrame> m_frame_dump_queue;
+  u64 m_frames_queued = 0;
+  u64 m_frames_dumped = 0;
+  FrameDumpStats m_frame_dump_stats;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Ring of readback textures. Frames are copied and read back in order, so the oldest copied frame
+  // is the one m_num_copied_frames before the next texture.
+  std::array<ReadbackTexture, NUM_READBACK_TEXTURES> m_readback_textures;
+  size_t m_next_readback_texture = 0;
+  size_t m_num_copied_frames = 0;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
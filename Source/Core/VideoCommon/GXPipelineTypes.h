@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -23,6 +25,10 @@ constexpr u32 GX_PIPELINE_UID_VERSION = 8;  // Last changed in PR 12185
 
 struct GXPipelineUid
 {
+  // Hash of the rest of the UID, which the pipeline caches are keyed by. UIDs must be updated with
+  // UpdateHash() after being changed before they are looked up. As it comes first, comparing UIDs
+  // with different hashes only looks at the first 8 bytes.
+  u64 hash;
   const NativeVertexFormat* vertex_format;
   VertexShaderUid vs_uid;
   GeometryShaderUid gs_uid;
@@ -34,7 +40,13 @@ struct GXPipelineUid
   // We use memcmp() for comparing pipelines as std::tie generates a large number of instructions,
   // and this map lookup can happen every draw call. However, as using memcmp() will also compare
   // any padding bytes, we have to ensure these are zeroed out.
-  GXPipelineUid() { std::memset(static_cast<void*>(this), 0, sizeof(*this)); }
+  GXPipelineUid()
+  {
+    std::memset(static_cast<void*>(this), 0, sizeof(*this));
+    UpdateHash();
+  }
+  u64 ComputeHash() const { return HashUidData(&vertex_format, sizeof(*this) - sizeof(hash)); }
+  void UpdateHash() { hash = ComputeHash(); }
   bool operator<(const GXPipelineUid& rhs) const
   {
     return std::memcmp(this, &rhs, sizeof(*this)) < 0;
@@ -46,6 +58,7 @@ struct GXPipelineUid
 };
 struct GXUberPipelineUid
 {
+  u64 hash;
   const NativeVertexFormat* vertex_format;
   UberShader::VertexShaderUid vs_uid;
   GeometryShaderUid gs_uid;
@@ -54,7 +67,13 @@ struct GXUberPipelineUid
   DepthState depth_state;
   BlendingState blending_state;
 
-  GXUberPipelineUid() { std::memset(static_cast<void*>(this), 0, sizeof(*this)); }
+  GXUberPipelineUid()
+  {
+    std::memset(static_cast<void*>(this), 0, sizeof(*this));
+    UpdateHash();
+  }
+  u64 ComputeHash() const { return HashUidData(&vertex_format, sizeof(*this) - sizeof(hash)); }
+  void UpdateHash() { hash = ComputeHash(); }
   bool operator<(const GXUberPipelineUid& rhs) const
   {
     return std::memcmp(this, &rhs, sizeof(*this)) < 0;
@@ -91,3 +110,23 @@ struct SerializedGXUberPipelineUid
 #pragma pack(pop)
 
 }  // namespace VideoCommon
+
+template <>
+struct std::hash<VideoCommon::GXPipelineUid>
+{
+  size_t operator()(const VideoCommon::GXPipelineUid& uid) const noexcept
+  {
+    DEBUG_ASSERT(uid.hash == uid.ComputeHash());
+    return static_cast<size_t>(uid.hash);
+  }
+};
+
+template <>
+struct std::hash<VideoCommon::GXUberPipelineUid>
+{
+  size_t operator()(const VideoCommon::GXUberPipelineUid& uid) const noexcept
+  {
+    DEBUG_ASSERT(uid.hash == uid.ComputeHash());
+    return static_cast<size_t>(uid.hash);
+  }
+};
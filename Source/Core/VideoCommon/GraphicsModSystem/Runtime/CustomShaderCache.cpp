@@ -158,7 +158,8 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXPipelineUid& ui
         // Re-queue for next frame.
         auto wi = m_shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             m_shader_cache, m_uid, m_custom_shaders, m_iterator, m_config);
-        m_shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), 0);
+        m_shader_cache->m_async_shader_compiler->QueueWorkItem(
+            std::move(wi), VideoCommon::AsyncShaderCompiler::Priority::CurrentFrame);
       }
     }
 
@@ -175,7 +176,8 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXPipelineUid& ui
   auto list_iter = m_pipeline_cache.InsertElement(uid, custom_shaders);
   auto work_item = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
       this, uid, custom_shaders, list_iter, pipeline_config);
-  m_async_shader_compiler->QueueWorkItem(std::move(work_item), 0);
+  m_async_shader_compiler->QueueWorkItem(
+      std::move(work_item), VideoCommon::AsyncShaderCompiler::Priority::CurrentFrame);
 }
 
 void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXUberPipelineUid& uid,
@@ -241,7 +243,8 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXUberPipelineUid
         // Re-queue for next frame.
         auto wi = m_shader_cache->m_async_uber_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             m_shader_cache, m_uid, m_custom_shaders, m_iterator, m_config);
-        m_shader_cache->m_async_uber_shader_compiler->QueueWorkItem(std::move(wi), 0);
+        m_shader_cache->m_async_uber_shader_compiler->QueueWorkItem(
+            std::move(wi), VideoCommon::AsyncShaderCompiler::Priority::CurrentFrame);
       }
     }
 
@@ -258,7 +261,8 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXUberPipelineUid
   auto list_iter = m_uber_pipeline_cache.InsertElement(uid, custom_shaders);
   auto work_item = m_async_uber_shader_compiler->CreateWorkItem<PipelineWorkItem>(
       this, uid, custom_shaders, list_iter, pipeline_config);
-  m_async_uber_shader_compiler->QueueWorkItem(std::move(work_item), 0);
+  m_async_uber_shader_compiler->QueueWorkItem(
+      std::move(work_item), VideoCommon::AsyncShaderCompiler::Priority::CurrentFrame);
 }
 
 void CustomShaderCache::NotifyPipelineFinished(PipelineIterator iterator,
@@ -311,7 +315,8 @@ void CustomShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid,
   auto list_iter = m_ps_cache.InsertElement(uid, custom_shaders);
   auto work_item = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(
       this, uid, custom_shaders, list_iter);
-  m_async_shader_compiler->QueueWorkItem(std::move(work_item), 0);
+  m_async_shader_compiler->QueueWorkItem(
+      std::move(work_item), VideoCommon::AsyncShaderCompiler::Priority::CurrentFrame);
 }
 
 void CustomShaderCache::QueuePixelShaderCompile(const UberShader::PixelShaderUid& uid,
@@ -350,7 +355,8 @@ void CustomShaderCache::QueuePixelShaderCompile(const UberShader::PixelShaderUid
   auto list_iter = m_uber_ps_cache.InsertElement(uid, custom_shaders);
   auto work_item = m_async_uber_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(
       this, uid, custom_shaders, list_iter);
-  m_async_uber_shader_compiler->QueueWorkItem(std::move(work_item), 0);
+  m_async_uber_shader_compiler->QueueWorkItem(
+      std::move(work_item), VideoCommon::AsyncShaderCompiler::Priority::CurrentFrame);
 }
 
 std::unique_ptr<AbstractShader>
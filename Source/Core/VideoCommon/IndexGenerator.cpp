@@ -3,7 +3,14 @@
 
 #include "VideoCommon/IndexGenerator.h"
 
+#include <array>
+#include <cstddef>
 #include <cstring>
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -14,6 +21,153 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Index sequences that repeat with a fixed stride are written a block at a time, 8 indices per
+// vector. Each index is either an offset from the vertex the block starts at, primitive restart,
+// or the first vertex of the primitive (for fans).
+constexpr int PATTERN_RESTART = -1;
+constexpr int PATTERN_FIRST = -2;
+
+template <size_t NumVectors>
+struct IndexBlock
+{
+  using Vector = std::array<u16, 8>;
+
+  std::array<Vector, NumVectors> offsets{};
+  // Set for lanes that are primitive restart or the first vertex instead of an offset.
+  std::array<Vector, NumVectors> fixed_mask{};
+  std::array<Vector, NumVectors> first_mask{};
+  // Number of vertices covered by one block.
+  u32 vertices = 0;
+};
+
+// Builds a block from a pattern of indices that is repeated, advancing by <advance> vertices each
+// time, until it fills whole vectors.
+template <size_t NumVectors, size_t Period>
+constexpr IndexBlock<NumVectors> MakeIndexBlock(const std::array<int, Period>& pattern,
+                                                u32 advance)
+{
+  static_assert((NumVectors * 8) % Period == 0);
+
+  IndexBlock<NumVectors> block;
+  for (size_t i = 0; i < NumVectors * 8; ++i)
+  {
+    const int entry = pattern[i % Period];
+    const u32 base = static_cast<u32>(i / Period) * advance;
+    if (entry == PATTERN_RESTART)
+    {
+      block.fixed_mask[i / 8][i % 8] = UINT16_MAX;
+    }
+    else if (entry == PATTERN_FIRST)
+    {
+      block.fixed_mask[i / 8][i % 8] = UINT16_MAX;
+      block.first_mask[i / 8][i % 8] = UINT16_MAX;
+    }
+    else
+    {
+      block.offsets[i / 8][i % 8] = static_cast<u16>(base + entry);
+    }
+  }
+  block.vertices = static_cast<u32>(NumVectors * 8 / Period) * advance;
+  return block;
+}
+
+// Writes <num_blocks> blocks starting at vertex <index>, where <first> is the first vertex of the
+// primitive.
+template <size_t NumVectors>
+u16* AddBlocks(u16* index_ptr, u32 num_blocks, u32 index, u32 first,
+               const IndexBlock<NumVectors>& block)
+{
+#if defined(_M_X86_64)
+  __m128i offsets[NumVectors];
+  __m128i fixed_mask[NumVectors];
+  __m128i fixed[NumVectors];
+  const __m128i first_vec = _mm_set1_epi16(static_cast<s16>(first));
+  for (size_t i = 0; i < NumVectors; ++i)
+  {
+    offsets[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.offsets[i].data()));
+    fixed_mask[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.fixed_mask[i].data()));
+    const __m128i first_mask =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.first_mask[i].data()));
+    // Restart lanes are all ones, first vertex lanes take the first vertex.
+    fixed[i] = _mm_or_si128(_mm_andnot_si128(first_mask, fixed_mask[i]),
+                            _mm_and_si128(first_mask, first_vec));
+  }
+
+  __m128i base = _mm_set1_epi16(static_cast<s16>(index));
+  const __m128i advance = _mm_set1_epi16(static_cast<s16>(block.vertices));
+  for (u32 n = 0; n < num_blocks; ++n)
+  {
+    for (size_t i = 0; i < NumVectors; ++i)
+    {
+      const __m128i indices = _mm_add_epi16(base, offsets[i]);
+      const __m128i result = _mm_or_si128(_mm_andnot_si128(fixed_mask[i], indices), fixed[i]);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), result);
+      index_ptr += 8;
+    }
+    base = _mm_add_epi16(base, advance);
+  }
+#elif defined(_M_ARM_64)
+  uint16x8_t offsets[NumVectors];
+  uint16x8_t fixed_mask[NumVectors];
+  uint16x8_t fixed[NumVectors];
+  const uint16x8_t first_vec = vdupq_n_u16(static_cast<u16>(first));
+  const uint16x8_t restart_vec = vdupq_n_u16(s_primitive_restart);
+  for (size_t i = 0; i < NumVectors; ++i)
+  {
+    offsets[i] = vld1q_u16(block.offsets[i].data());
+    fixed_mask[i] = vld1q_u16(block.fixed_mask[i].data());
+    fixed[i] = vbslq_u16(vld1q_u16(block.first_mask[i].data()), first_vec, restart_vec);
+  }
+
+  uint16x8_t base = vdupq_n_u16(static_cast<u16>(index));
+  const uint16x8_t advance = vdupq_n_u16(static_cast<u16>(block.vertices));
+  for (u32 n = 0; n < num_blocks; ++n)
+  {
+    for (size_t i = 0; i < NumVectors; ++i)
+    {
+      vst1q_u16(index_ptr, vbslq_u16(fixed_mask[i], fixed[i], vaddq_u16(base, offsets[i])));
+      index_ptr += 8;
+    }
+    base = vaddq_u16(base, advance);
+  }
+#else
+  for (u32 n = 0; n < num_blocks; ++n)
+  {
+    for (size_t i = 0; i < NumVectors * 8; ++i)
+    {
+      const u16 lane_index = static_cast<u16>(index + block.offsets[i / 8][i % 8]);
+      const u16 fixed = block.first_mask[i / 8][i % 8] ? static_cast<u16>(first) :
+                                                         s_primitive_restart;
+      *index_ptr++ = block.fixed_mask[i / 8][i % 8] ? fixed : lane_index;
+    }
+    index += block.vertices;
+  }
+#endif
+  return index_ptr;
+}
+
+constexpr int R = PATTERN_RESTART;
+constexpr int F = PATTERN_FIRST;
+
+// 8 triangles
+constexpr auto LIST_BLOCK = MakeIndexBlock<3>(std::array{0, 1, 2}, 3);
+// 6 triangles
+constexpr auto LIST_BLOCK_PR = MakeIndexBlock<3>(std::array{0, 1, 2, R}, 3);
+// 8 triangles, with every other one winded the other way
+constexpr auto STRIP_BLOCK = MakeIndexBlock<3>(std::array{0, 1, 2, 1, 3, 2}, 2);
+// 8 vertices
+constexpr auto SEQUENCE_BLOCK = MakeIndexBlock<1>(std::array{0}, 1);
+// 8 triangles
+constexpr auto FAN_BLOCK = MakeIndexBlock<3>(std::array{F, 1, 2}, 1);
+// 12 triangles, as 4 strips of 3 (see AddFan)
+constexpr auto FAN_BLOCK_PR = MakeIndexBlock<3>(std::array{1, 2, F, 3, 4, R}, 3);
+// 4 quads
+constexpr auto QUADS_BLOCK = MakeIndexBlock<3>(std::array{0, 1, 2, 0, 2, 3}, 4);
+// 8 quads, as strips (see AddQuads)
+constexpr auto QUADS_BLOCK_PR = MakeIndexBlock<5>(std::array{1, 2, 0, 3, R}, 4);
+// 4 lines
+constexpr auto LINE_STRIP_BLOCK = MakeIndexBlock<1>(std::array{0, 1}, 1);
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -28,7 +182,11 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  constexpr const auto& block = pr ? LIST_BLOCK_PR : LIST_BLOCK;
+  const u32 num_blocks = num_verts / block.vertices;
+  index_ptr = AddBlocks(index_ptr, num_blocks, index, index, block);
+
+  for (u32 i = num_blocks * block.vertices + 2; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -40,7 +198,10 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 num_blocks = num_verts / SEQUENCE_BLOCK.vertices;
+    index_ptr = AddBlocks(index_ptr, num_blocks, index, index, SEQUENCE_BLOCK);
+
+    for (u32 i = num_blocks * SEQUENCE_BLOCK.vertices; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -48,8 +209,12 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // Blocks cover an even number of triangles, so the winding starts out the same way after them.
+    const u32 num_blocks = num_verts > 2 ? (num_verts - 2) / STRIP_BLOCK.vertices : 0;
+    index_ptr = AddBlocks(index_ptr, num_blocks, index, index, STRIP_BLOCK);
+
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = num_blocks * STRIP_BLOCK.vertices + 2; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -81,7 +246,11 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 template <bool pr>
 u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 2;
+  constexpr const auto& block = pr ? FAN_BLOCK_PR : FAN_BLOCK;
+  const u32 num_blocks = num_verts > 2 ? (num_verts - 2) / block.vertices : 0;
+  index_ptr = AddBlocks(index_ptr, num_blocks, index, index, block);
+
+  u32 i = num_blocks * block.vertices + 2;
 
   if constexpr (pr)
   {
@@ -133,6 +302,16 @@ template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 3;
+  const auto add_blocks = [&](const auto& block) {
+    const u32 num_blocks = num_verts / block.vertices;
+    index_ptr = AddBlocks(index_ptr, num_blocks, index, index, block);
+    i += num_blocks * block.vertices;
+  };
+  if constexpr (pr)
+    add_blocks(QUADS_BLOCK_PR);
+  else
+    add_blocks(QUADS_BLOCK);
+
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -168,7 +347,11 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
+  // Whole lines are just the vertices in order.
+  const u32 num_blocks = num_verts / SEQUENCE_BLOCK.vertices;
+  index_ptr = AddBlocks(index_ptr, num_blocks, index, index, SEQUENCE_BLOCK);
+
+  for (u32 i = num_blocks * SEQUENCE_BLOCK.vertices + 1; i < num_verts; i += 2)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -180,7 +363,10 @@ u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 // so converting them to lists
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  const u32 num_blocks = num_verts > 1 ? (num_verts - 1) / LINE_STRIP_BLOCK.vertices : 0;
+  index_ptr = AddBlocks(index_ptr, num_blocks, index, index, LINE_STRIP_BLOCK);
+
+  for (u32 i = num_blocks * LINE_STRIP_BLOCK.vertices + 1; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -223,7 +409,10 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  const u32 num_blocks = num_verts / SEQUENCE_BLOCK.vertices;
+  index_ptr = AddBlocks(index_ptr, num_blocks, index, index, SEQUENCE_BLOCK);
+
+  for (u32 i = num_blocks * SEQUENCE_BLOCK.vertices; i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
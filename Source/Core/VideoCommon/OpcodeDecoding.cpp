@@ -14,8 +14,12 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <optional>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
+#include "Common/Metrics.h"
+#include "Common/Tracing.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -23,10 +27,13 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/StageTimer.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 
@@ -44,6 +51,7 @@ public:
 
     if constexpr (!is_preprocess)
     {
+      TRACE_SCOPE("GPU", "XF write");
       LoadXFReg(address, count, data);
 
       INCSTAT(g_stats.this_frame.num_xf_loads);
@@ -55,6 +63,7 @@ public:
     const u8 sub_command = command & CP_COMMAND_MASK;
     if constexpr (!is_preprocess)
     {
+      TRACE_SCOPE("GPU", "CP write");
       if (sub_command == MATINDEX_A)
       {
         VertexLoaderManager::g_needs_cp_xf_consistency_check = true;
@@ -110,6 +119,7 @@ public:
     }
     else
     {
+      TRACE_SCOPE("GPU", "BP write");
       LoadBPReg(command, value, m_cycles);
       INCSTAT(g_stats.this_frame.num_bp_loads);
     }
@@ -126,11 +136,22 @@ public:
   OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
                                           u32 vertex_size, u16 num_vertices, const u8* vertex_data))
   {
+    OnCachedPrimitiveCommand(primitive, vat, vertex_size, num_vertices, vertex_data, nullptr);
+  }
+  // Called by RunDecoded for primitives in cached display lists.
+  DOLPHIN_FORCE_INLINE void
+  OnCachedPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat, u32 vertex_size,
+                           u16 num_vertices, const u8* vertex_data,
+                           VertexLoaderManager::CachedVertices* cached_vertices)
+  {
+    if (cached_vertices != nullptr && !g_ActiveConfig.bCacheDisplayListVertices)
+      cached_vertices = nullptr;
+
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(
+        vat, primitive, num_vertices, vertex_data, cached_vertices);
 
     ASSERT(bytes == size);
 
@@ -187,7 +208,10 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
-          Run(start_address, size, *this);
+          if (g_ActiveConfig.bCacheDisplayLists)
+            RunCachedDisplayList(address, start_address, size);
+          else
+            Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
           // un-swap
@@ -254,17 +278,46 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+
+private:
+  void RunCachedDisplayList(u32 address, const u8* data, u32 size)
+  {
+    DecodedDisplayList* decoded = g_display_list_cache.Get(address, data, size, GetCPState());
+    if (decoded == nullptr)
+    {
+      Run(data, size, *this);
+      return;
+    }
+
+    const u32 decoded_size = decoded->decoded_size;
+    const u32 processed = RunDecoded(*decoded, data, *this);
+    if (processed < decoded_size)
+    {
+      // A vertex format used by the display list has changed, so it has to be decoded again.
+      g_display_list_cache.Invalidate(address);
+      Run(data + processed, size - processed, *this);
+    }
+  }
 };
 
+static Common::Metrics::Counter s_fifo_bytes{"fifo_bytes_total",
+                                             "Bytes of GPU commands processed from the FIFO"};
+
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
+  std::optional<VideoCommon::StageTimer> timer;
+  if constexpr (!is_preprocess)
+    timer.emplace(VideoCommon::GPUStage::OpcodeDecoding);
+
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
 
   if (cycles != nullptr)
     *cycles = callback.m_cycles;
+  if constexpr (!is_preprocess)
+    s_fifo_bytes.Add(size);
 
   src.Skip(size);
   return src.GetPointer();
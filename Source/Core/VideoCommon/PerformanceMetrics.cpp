@@ -4,15 +4,19 @@
 #include "VideoCommon/PerformanceMetrics.h"
 
 #include <algorithm>
+#include <utility>
 
 #include <imgui.h>
 #include <implot.h>
 
 #include "Common/HookableEvent.h"
+#include "Common/Metrics.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/Core.h"
 #include "VideoCommon/VideoConfig.h"
 
+static Common::Metrics::Counter s_frames{"frames_total", "Frames presented"};
+
 PerformanceMetrics::PerformanceMetrics()
 {
   const auto invalidate_counters_last_time = [this](Core::State) {
@@ -34,16 +38,23 @@ void PerformanceMetrics::Reset()
   m_max_speed = 0;
 
   m_frame_presentation_offset = DT{};
+
+  m_dsp_idle_skip_cycles_this_field = 0;
+  m_dsp_idle_skip_cycles = 0;
 }
 
 void PerformanceMetrics::CountFrame()
 {
   m_fps_counter.Count();
+  s_frames.Add();
 }
 
 void PerformanceMetrics::CountVBlank()
 {
   m_vps_counter.Count();
+
+  m_dsp_idle_skip_cycles.store(std::exchange(m_dsp_idle_skip_cycles_this_field, 0),
+                               std::memory_order_relaxed);
 }
 
 void PerformanceMetrics::CountThrottleSleep(DT sleep)
@@ -60,6 +71,11 @@ void PerformanceMetrics::AdjustClockSpeed(s64 ticks, u32 new_ppc_clock, u32 old_
   }
 }
 
+void PerformanceMetrics::CountDSPIdleSkip(u32 dsp_cycles)
+{
+  m_dsp_idle_skip_cycles_this_field += dsp_cycles;
+}
+
 void PerformanceMetrics::CountPerformanceMarker(s64 core_ticks, u32 ticks_per_second)
 {
   const auto clock_time = Clock::now();
@@ -103,6 +119,11 @@ double PerformanceMetrics::GetMaxSpeed() const
   return m_max_speed.load(std::memory_order_relaxed);
 }
 
+u32 PerformanceMetrics::GetDSPIdleSkipCycles() const
+{
+  return m_dsp_idle_skip_cycles.load(std::memory_order_relaxed);
+}
+
 void PerformanceMetrics::SetLatestFramePresentationOffset(DT offset)
 {
   m_frame_presentation_offset.store(offset, std::memory_order_relaxed);
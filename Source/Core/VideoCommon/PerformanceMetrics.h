@@ -35,12 +35,15 @@ public:
   void CountThrottleSleep(DT sleep);
   void AdjustClockSpeed(s64 ticks, u32 new_ppc_clock, u32 old_ppc_clock);
   void CountPerformanceMarker(s64 ticks, u32 ticks_per_second);
+  void CountDSPIdleSkip(u32 dsp_cycles);
 
   // Getter Functions. May be called from any thread.
   double GetFPS() const;
   double GetVPS() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
+  // DSP LLE cycles that were skipped by idle skipping during the last VI field.
+  u32 GetDSPIdleSkipCycles() const;
   // Call from any thread.
   void SetLatestFramePresentationOffset(DT offset);
   void SetLatestFrameBufferSize(u32 width, u32 height);
@@ -66,6 +69,9 @@ private:
   std::atomic<double> m_max_speed{};
 
   std::atomic<DT> m_frame_presentation_offset{};
+
+  u32 m_dsp_idle_skip_cycles_this_field = 0;
+  std::atomic<u32> m_dsp_idle_skip_cycles{};
   std::atomic<FrameBufferSize> m_frame_buffer_size{};
 
   struct PerfSample
@@ -322,7 +322,8 @@ Resource::TaskComplete MaterialResource::ProcessData()
         g_framebuffer_manager->GetEFBFramebufferState());
 
     // We don't need priority, that is already handled by the resource system
-    m_resource_context.shader_compiler->QueueWorkItem(std::move(wi), 0);
+    m_resource_context.shader_compiler->QueueWorkItem(
+        std::move(wi), AsyncShaderCompiler::Priority::CurrentFrame);
     m_processing_load_data = true;
   }
 
@@ -535,7 +535,8 @@ Resource::TaskComplete ShaderResource::ProcessData()
         m_load_data, m_uid ? &*m_uid : nullptr, m_shader_host_config.bits, preprocessor_settings);
 
     // We don't need priority, that is already handled by the resource system
-    m_resource_context.shader_compiler->QueueWorkItem(std::move(wi), 0);
+    m_resource_context.shader_compiler->QueueWorkItem(
+        std::move(wi), AsyncShaderCompiler::Priority::CurrentFrame);
     m_processing_load_data = true;
   }
 
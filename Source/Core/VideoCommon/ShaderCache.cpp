@@ -3,13 +3,19 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+#include <chrono>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
+#include "Common/Metrics.h"
 #include "Common/MsgHandler.h"
+#include "Common/Tracing.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/AbstractGfx.h"
@@ -31,6 +37,31 @@ std::unique_ptr<VideoCommon::ShaderCache> g_shader_cache;
 
 namespace VideoCommon
 {
+namespace
+{
+// The pipeline usage file holds a PipelineUsageRecord for each UID in the UID cache, in order.
+constexpr u32 PIPELINE_USAGE_FILE_MAGIC = 0x45535550;  // PUSE
+constexpr u32 PIPELINE_USAGE_FILE_VERSION = 1;
+constexpr size_t PIPELINE_USAGE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+struct PipelineUsageRecord
+{
+  u32 first_use_frame;
+  u32 use_count;
+};
+
+Common::Metrics::Counter s_sync_compiles{"pipelines_compiled_sync_total",
+                                         "Pipelines compiled synchronously by a draw"};
+Common::Metrics::Counter s_sync_compile_time{
+    "pipeline_sync_compile_ns_total", "Time draws spent compiling pipelines, in nanoseconds"};
+Common::Metrics::Counter s_on_demand_compiles{
+    "pipelines_queued_on_demand_total",
+    "Specialized pipelines which weren't ready when first drawn, and were queued for compiling"};
+Common::Metrics::Gauge s_precompile_wait_ms{
+    "pipeline_precompile_wait_ms",
+    "Time spent compiling pipelines before starting, in milliseconds"};
+}  // namespace
+
 ShaderCache::ShaderCache() : m_api_type{APIType::Nothing}
 {
 }
@@ -49,8 +80,10 @@ bool ShaderCache::Initialize()
     return false;
 
   m_async_shader_compiler = g_gfx->CreateAsyncShaderCompiler();
-  m_frame_end_handler = GetVideoEvents().after_frame_event.Register(
-      [this](Core::System&) { RetrieveAsyncShaders(); });
+  m_frame_end_handler = GetVideoEvents().after_frame_event.Register([this](Core::System&) {
+    m_frame_number++;
+    RetrieveAsyncShaders();
+  });
   return true;
 }
 
@@ -70,9 +103,7 @@ void ShaderCache::InitializeShaderCache()
     QueueUberShaderPipelines();
 
   // Compile all known UIDs.
-  CompileMissingPipelines();
-  if (g_ActiveConfig.bWaitForShadersBeforeStarting)
-    WaitForAsyncCompiler();
+  CompileMissingPipelines(g_ActiveConfig.bWaitForShadersBeforeStarting);
 
   // Switch to the runtime shader compiler thread configuration.
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
@@ -96,9 +127,7 @@ void ShaderCache::Reload()
   // We don't need to explicitly recompile the individual ubershaders here, as the pipelines
   // UIDs are still be in the map. Therefore, when these are rebuilt, the shaders will also
   // be recompiled.
-  CompileMissingPipelines();
-  if (g_ActiveConfig.bWaitForShadersBeforeStarting)
-    WaitForAsyncCompiler();
+  CompileMissingPipelines(g_ActiveConfig.bWaitForShadersBeforeStarting);
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
 }
 
@@ -122,50 +151,102 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
-  auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  PipelineCacheEntry* entry = FindGXPipeline(uid);
+  if (entry && !entry->pending)
+  {
+    RecordPipelineUse(*entry);
+    return entry->pipeline.get();
+  }
 
-  const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  // The pipeline is being compiled here, so the queued compile is no longer needed.
+  const bool exists_in_cache = entry != nullptr;
+  if (exists_in_cache)
+    entry->pending->Cancel();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    Common::Metrics::ScopedTimer timer(s_sync_compile_time);
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+    s_sync_compiles.Add();
+  }
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
-  return InsertGXPipeline(uid, std::move(pipeline));
+  const AbstractPipeline* result = InsertGXPipeline(uid, std::move(pipeline));
+  RecordPipelineUse(m_gx_pipeline_cache[uid]);
+  return result;
 }
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
-  auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end())
+  PipelineCacheEntry* entry = FindGXPipeline(uid);
+  if (entry)
   {
-    // .second is the pending flag, i.e. compiling in the background.
-    if (!it->second.second)
-      return it->second.first.get();
+    RecordPipelineUse(*entry);
+    if (!entry->pending)
+      return entry->pipeline.get();
     else
       return {};
   }
 
   AppendGXPipelineUID(uid);
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  RecordPipelineUse(m_gx_pipeline_cache[uid]);
+  s_on_demand_compiles.Add();
   return {};
 }
 
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
-  auto it = m_gx_uber_pipeline_cache.find(uid);
-  if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  PipelineCacheEntry* entry = FindGXUberPipeline(uid);
+  if (entry && !entry->pending)
+    return entry->pipeline.get();
+
+  // The pipeline is being compiled here, so the queued compile is no longer needed.
+  if (entry)
+    entry->pending->Cancel();
 
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    Common::Metrics::ScopedTimer timer(s_sync_compile_time);
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+    s_sync_compiles.Add();
+  }
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+ShaderCache::PipelineCacheEntry* ShaderCache::FindGXPipeline(const GXPipelineUid& uid)
+{
+  // When rendering is skipped while a pipeline is compiled in the background, the same UID is
+  // looked up on every draw until it is ready.
+  if (m_last_gx_pipeline && m_last_gx_pipeline->first == uid)
+    return &m_last_gx_pipeline->second;
+
+  auto it = m_gx_pipeline_cache.find(uid);
+  if (it == m_gx_pipeline_cache.end())
+    return nullptr;
+
+  m_last_gx_pipeline = &*it;
+  return &it->second;
+}
+
+ShaderCache::PipelineCacheEntry* ShaderCache::FindGXUberPipeline(const GXUberPipelineUid& uid)
+{
+  // Ubershader UIDs only depend on a few parts of the state, so most state changes between draws
+  // look up the same one again.
+  if (m_last_gx_uber_pipeline && m_last_gx_uber_pipeline->first == uid)
+    return &m_last_gx_uber_pipeline->second;
+
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it == m_gx_uber_pipeline_cache.end())
+    return nullptr;
+
+  m_last_gx_uber_pipeline = &*it;
+  return &it->second;
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   bool running = true;
@@ -229,6 +310,7 @@ static void UnserializePipelineUid(const SerializedUidType& uid, UidType& real_u
   real_uid.rasterization_state.hex = uid.rasterization_state_bits;
   real_uid.depth_state.hex = uid.depth_state_bits;
   real_uid.blending_state.hex = uid.blending_state_bits;
+  real_uid.UpdateHash();
 }
 
 template <ShaderStage stage, typename K, typename T>
@@ -312,8 +394,8 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
       }
 
       auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
+      entry.pipeline = std::move(pipeline);
+      entry.pending = nullptr;
     }
 
   private:
@@ -347,11 +429,11 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   disk_cache.Sync();
   disk_cache.Close();
 
-  // Set the pending flag to false, and destroy the pipeline.
+  // Clear the pending work item, and destroy the pipeline.
   for (auto& it : cache)
   {
-    it.second.first.reset();
-    it.second.second = false;
+    it.second.pipeline.reset();
+    it.second.pending = nullptr;
   }
 }
 
@@ -421,23 +503,70 @@ void ShaderCache::ClearCaches()
   SETSTAT(g_stats.num_vertex_shaders_alive, 0);
 }
 
-void ShaderCache::CompileMissingPipelines()
+void ShaderCache::CompileMissingPipelines(bool wait_for_first_scene)
 {
-  // Queue all uids with a null pipeline for compilation.
-  for (auto& it : m_gx_pipeline_cache)
-  {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
-  }
+  // Queue all uids with a null pipeline for compilation, starting with the ubershaders.
   for (auto& it : m_gx_uber_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.pipeline && !it.second.pending)
       QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   }
+
+  // Specialized pipelines are compiled in the order previous sessions first used them, so that
+  // the ones needed soonest are ready first. Pipelines used in more sessions go first among those
+  // first used on the same frame, and the rest keep the order they were added to the UID cache.
+  std::vector<std::pair<const GXPipelineUid*, const PipelineCacheEntry*>> missing;
+  bool has_usage = false;
+  for (const auto& [uid, entry] : m_gx_pipeline_cache)
+  {
+    has_usage |= entry.use_count != 0;
+    if (!entry.pipeline && !entry.pending)
+      missing.emplace_back(&uid, &entry);
+  }
+  std::ranges::sort(missing, [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.second->first_use_frame, rhs.second->use_count,
+                    lhs.second->uid_cache_index) <
+           std::tie(rhs.second->first_use_frame, lhs.second->use_count,
+                    rhs.second->uid_cache_index);
+  });
+
+  // If we know which pipelines the game needs first, only wait for those, and compile the rest in
+  // the background. Otherwise, wait for all of them.
+  size_t num_first_scene = missing.size();
+  if (wait_for_first_scene && has_usage)
+  {
+    const auto first_later = std::ranges::partition_point(missing, [](const auto& it) {
+      return it.second->first_use_frame < FIRST_SCENE_FRAMES;
+    });
+    num_first_scene = static_cast<size_t>(first_later - missing.begin());
+  }
+
+  for (size_t i = 0; i < num_first_scene; i++)
+    QueuePipelineCompile(*missing[i].first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+
+  if (wait_for_first_scene)
+  {
+    TRACE_SCOPE("Shader", "Precompile pipelines");
+    const auto start = std::chrono::steady_clock::now();
+    WaitForAsyncCompiler();
+    const auto wait_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    s_precompile_wait_ms.Set(static_cast<double>(wait_time.count()));
+    INFO_LOG_FMT(VIDEO, "Waited {} ms for {} pipelines, compiling {} more in the background",
+                 wait_time.count(), num_first_scene, missing.size() - num_first_scene);
+  }
+
+  // Skip any pipelines which were compiled synchronously while waiting.
+  for (size_t i = num_first_scene; i < missing.size(); i++)
+  {
+    if (!missing[i].second->pipeline && !missing[i].second->pending)
+      QueuePipelineCompile(*missing[i].first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+  }
 }
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  TRACE_SCOPE("Shader", "Vertex shader compile");
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -446,6 +575,7 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  TRACE_SCOPE("Shader", "Vertex ubershader compile");
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(), nullptr,
@@ -454,6 +584,7 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  TRACE_SCOPE("Shader", "Pixel shader compile");
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -462,6 +593,7 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  TRACE_SCOPE("Shader", "Pixel ubershader compile");
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(), nullptr,
@@ -745,14 +877,14 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
                                                       std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = nullptr;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
     if (g_ActiveConfig.bShaderCache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXPipelineUid disk_uid;
@@ -763,7 +895,7 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 const AbstractPipeline*
@@ -771,14 +903,14 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
                                   std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_uber_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = nullptr;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
     if (g_ActiveConfig.bShaderCache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXUberPipelineUid disk_uid;
@@ -789,15 +921,18 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 void ShaderCache::LoadPipelineUIDCache()
 {
   constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  const std::string base_filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID();
+  const std::string filename = base_filename + ".uidcache";
+  m_gx_pipeline_usage_filename = base_filename + ".uidusage";
+  m_gx_pipeline_uid_order.clear();
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -840,13 +975,22 @@ void ShaderCache::LoadPipelineUIDCache()
     }
 
     // If the file is invalid, close it. We re-open and truncate it below.
-    if (!uid_file_valid)
+    if (uid_file_valid)
+    {
+      LoadPipelineUsage();
+    }
+    else
+    {
       m_gx_pipeline_uid_cache_file.Close();
+      m_gx_pipeline_uid_order.clear();
+    }
   }
 
   // If the file is not open, it means it was either corrupted or didn't exist.
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
   {
+    // The usage records are indexed by position in the UID cache, so they can't be kept either.
+    File::Delete(m_gx_pipeline_usage_filename, File::IfAbsentBehavior::NoConsoleWarning);
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
@@ -867,22 +1011,83 @@ void ShaderCache::LoadPipelineUIDCache()
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  if (m_gx_pipeline_uid_cache_file.IsOpen())
+    SavePipelineUsage();
   m_gx_pipeline_uid_cache_file.Close();
 }
 
+void ShaderCache::LoadPipelineUsage()
+{
+  File::IOFile file(m_gx_pipeline_usage_filename, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != PIPELINE_USAGE_FILE_MAGIC || version != PIPELINE_USAGE_FILE_VERSION)
+  {
+    return;
+  }
+
+  // The records are in the same order as the UID cache. There may be fewer of them if Dolphin
+  // didn't shut down cleanly last time.
+  const size_t record_count =
+      std::min(static_cast<size_t>((file.GetSize() - PIPELINE_USAGE_HEADER_SIZE) /
+                                   sizeof(PipelineUsageRecord)),
+               m_gx_pipeline_uid_order.size());
+  std::vector<PipelineUsageRecord> records(record_count);
+  if (!file.ReadArray(records.data(), records.size()))
+    return;
+
+  for (size_t i = 0; i < record_count; i++)
+  {
+    PipelineCacheEntry& entry = m_gx_pipeline_cache[m_gx_pipeline_uid_order[i]];
+    entry.first_use_frame = std::min(entry.first_use_frame, records[i].first_use_frame);
+    entry.use_count = std::max(entry.use_count, records[i].use_count);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read usage of {} pipelines from {}", record_count,
+               m_gx_pipeline_usage_filename);
+}
+
+void ShaderCache::SavePipelineUsage()
+{
+  std::vector<PipelineUsageRecord> records;
+  records.reserve(m_gx_pipeline_uid_order.size());
+  for (const GXPipelineUid& uid : m_gx_pipeline_uid_order)
+  {
+    const PipelineCacheEntry& entry = m_gx_pipeline_cache[uid];
+    records.push_back({entry.first_use_frame, entry.use_count});
+  }
+
+  File::IOFile file(m_gx_pipeline_usage_filename, "wb");
+  if (!file.WriteBytes(&PIPELINE_USAGE_FILE_MAGIC, sizeof(PIPELINE_USAGE_FILE_MAGIC)) ||
+      !file.WriteBytes(&PIPELINE_USAGE_FILE_VERSION, sizeof(PIPELINE_USAGE_FILE_VERSION)) ||
+      !file.WriteArray(records.data(), records.size()))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write pipeline usage to {}", m_gx_pipeline_usage_filename);
+  }
+}
+
+void ShaderCache::RecordPipelineUse(PipelineCacheEntry& entry)
+{
+  if (entry.used_this_session)
+    return;
+
+  entry.used_this_session = true;
+  entry.use_count++;
+  entry.first_use_frame = std::min(entry.first_use_frame, m_frame_number);
+}
+
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
-  auto iter = m_gx_pipeline_cache.find(real_uid);
-  if (iter != m_gx_pipeline_cache.end())
-    return;
-
-  // Flag it as empty with a null pipeline object, for later compilation.
+  // If the pipeline isn't already in the map, this adds it with a null pipeline object, for later
+  // compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  if (entry.uid_cache_index == PIPELINE_NOT_RECORDED)
+    entry.uid_cache_index = static_cast<u32>(m_gx_pipeline_uid_order.size());
+  m_gx_pipeline_uid_order.push_back(real_uid);
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -896,10 +1101,17 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   {
     WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
     m_gx_pipeline_uid_cache_file.Close();
+    return;
   }
+
+  auto& entry = m_gx_pipeline_cache[config];
+  if (entry.uid_cache_index == PIPELINE_NOT_RECORDED)
+    entry.uid_cache_index = static_cast<u32>(m_gx_pipeline_uid_order.size());
+  m_gx_pipeline_uid_order.push_back(config);
 }
 
-void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
+void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid,
+                                           AsyncShaderCompiler::Priority priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
   {
@@ -928,7 +1140,8 @@ void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 prior
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
 
-void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid, u32 priority)
+void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid,
+                                               AsyncShaderCompiler::Priority priority)
 {
   class VertexUberShaderWorkItem final : public AsyncShaderCompiler::WorkItem
   {
@@ -957,7 +1170,8 @@ void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
 
-void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority)
+void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid,
+                                          AsyncShaderCompiler::Priority priority)
 {
   class PixelShaderWorkItem final : public AsyncShaderCompiler::WorkItem
   {
@@ -986,7 +1200,8 @@ void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priorit
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
 
-void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid, u32 priority)
+void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid,
+                                              AsyncShaderCompiler::Priority priority)
 {
   class PixelUberShaderWorkItem final : public AsyncShaderCompiler::WorkItem
   {
@@ -1015,12 +1230,14 @@ void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid&
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
 
-void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
+void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid,
+                                       AsyncShaderCompiler::Priority priority)
 {
   class PipelineWorkItem final : public AsyncShaderCompiler::WorkItem
   {
   public:
-    PipelineWorkItem(ShaderCache* shader_cache_, GXPipelineUid uid_, u32 priority_)
+    PipelineWorkItem(ShaderCache* shader_cache_, GXPipelineUid uid_,
+                     AsyncShaderCompiler::Priority priority_)
         : shader_cache(shader_cache_), uid(std::move(uid_)), priority(priority_)
     {
       // Check if all the stages required for this pipeline have been compiled.
@@ -1067,9 +1284,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       else
       {
         // Re-queue for next frame.
-        auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
-            shader_cache, uid, priority);
-        shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+        shader_cache->QueuePipelineCompile(uid, priority);
       }
     }
 
@@ -1077,22 +1292,24 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     ShaderCache* shader_cache;
     std::unique_ptr<AbstractPipeline> pipeline;
     GXPipelineUid uid;
-    u32 priority;
+    AsyncShaderCompiler::Priority priority;
     std::optional<AbstractPipelineConfig> config;
     bool stages_ready;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
+  m_gx_pipeline_cache[uid].pending = wi.get();
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_pipeline_cache[uid].second = true;
 }
 
-void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
+void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid,
+                                           AsyncShaderCompiler::Priority priority)
 {
   class UberPipelineWorkItem final : public AsyncShaderCompiler::WorkItem
   {
   public:
-    UberPipelineWorkItem(ShaderCache* shader_cache_, GXUberPipelineUid uid_, u32 priority_)
+    UberPipelineWorkItem(ShaderCache* shader_cache_, GXUberPipelineUid uid_,
+                         AsyncShaderCompiler::Priority priority_)
         : shader_cache(shader_cache_), uid(std::move(uid_)), priority(priority_)
     {
       // Check if all the stages required for this UberPipeline have been compiled.
@@ -1142,9 +1359,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
       else
       {
         // Re-queue for next frame.
-        auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(
-            shader_cache, uid, priority);
-        shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+        shader_cache->QueueUberPipelineCompile(uid, priority);
       }
     }
 
@@ -1152,14 +1367,14 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     ShaderCache* shader_cache;
     std::unique_ptr<AbstractPipeline> UberPipeline;
     GXUberPipelineUid uid;
-    u32 priority;
+    AsyncShaderCompiler::Priority priority;
     std::optional<AbstractPipelineConfig> config;
     bool stages_ready;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(this, uid, priority);
+  m_gx_uber_pipeline_cache[uid].pending = wi.get();
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_uber_pipeline_cache[uid].second = true;
 }
 
 void ShaderCache::QueueUberShaderPipelines()
@@ -1191,13 +1406,14 @@ void ShaderCache::QueueUberShaderPipelines()
           config.blending_state.logic_op_enable = true;
           config.blending_state.logic_mode = LogicOp::And;
         }
+        config.UpdateHash();
 
         auto iter = m_gx_uber_pipeline_cache.find(config);
         if (iter != m_gx_uber_pipeline_cache.end())
           return;
 
         auto& entry = m_gx_uber_pipeline_cache[config];
-        entry.second = false;
+        entry.pending = nullptr;
       };
 
   // Populate the pipeline configs with empty entries, these will be compiled afterwards.
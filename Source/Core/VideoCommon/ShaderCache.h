@@ -6,12 +6,14 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -117,12 +119,33 @@ public:
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
+  static constexpr u32 PIPELINE_NOT_RECORDED = std::numeric_limits<u32>::max();
+
+  struct PipelineCacheEntry
+  {
+    std::unique_ptr<AbstractPipeline> pipeline;
+
+    // The work item compiling the pipeline in the background, if any. It is cancelled if the
+    // pipeline is compiled synchronously first.
+    AsyncShaderCompiler::WorkItem* pending = nullptr;
+
+    // Usage recorded alongside the UID cache for specialized pipelines. first_use_frame is the
+    // earliest frame of any session the pipeline was used on, and use_count the number of sessions
+    // it was used in.
+    u32 uid_cache_index = PIPELINE_NOT_RECORDED;
+    u32 first_use_frame = PIPELINE_NOT_RECORDED;
+    u32 use_count = 0;
+    bool used_this_session = false;
+  };
+
   void WaitForAsyncCompiler();
   void LoadCaches();
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
-  void CompileMissingPipelines();
+  void LoadPipelineUsage();
+  void SavePipelineUsage();
+  void CompileMissingPipelines(bool wait_for_first_scene);
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
 
@@ -161,14 +184,20 @@ private:
                                                std::unique_ptr<AbstractPipeline> pipeline);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  void RecordPipelineUse(PipelineCacheEntry& entry);
+  PipelineCacheEntry* FindGXPipeline(const GXPipelineUid& uid);
+  PipelineCacheEntry* FindGXUberPipeline(const GXUberPipelineUid& uid);
 
   // ASync Compiler Methods
-  void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
-  void QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid, u32 priority);
-  void QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority);
-  void QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid, u32 priority);
-  void QueuePipelineCompile(const GXPipelineUid& uid, u32 priority);
-  void QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority);
+  void QueueVertexShaderCompile(const VertexShaderUid& uid, AsyncShaderCompiler::Priority priority);
+  void QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid,
+                                    AsyncShaderCompiler::Priority priority);
+  void QueuePixelShaderCompile(const PixelShaderUid& uid, AsyncShaderCompiler::Priority priority);
+  void QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid,
+                                   AsyncShaderCompiler::Priority priority);
+  void QueuePipelineCompile(const GXPipelineUid& uid, AsyncShaderCompiler::Priority priority);
+  void QueueUberPipelineCompile(const GXUberPipelineUid& uid,
+                                AsyncShaderCompiler::Priority priority);
 
   // Populating various caches.
   template <ShaderStage stage, typename K, typename T>
@@ -181,16 +210,22 @@ private:
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
 
-  // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
-  // The shader cache is compiled last, as it is the least likely to be required. On demand
-  // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
-  enum : u32
-  {
-    COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
-    COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
-    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
-  };
+  // Priorities for compiling. On demand pipelines are compiled first, as they are drawn with the
+  // ubershader until they are ready, and we want to use the ubershader for as few frames as
+  // possible, otherwise we risk framerate drops. Precompiled ubershader and shader cache pipelines
+  // may not be needed at all, so they are compiled in the background. Ubershaders are queued
+  // first, so they are still compiled before the shader cache. A draw which needs an ubershader
+  // that isn't ready compiles it synchronously instead of waiting for the queue.
+  static constexpr auto COMPILE_PRIORITY_UBERSHADER_PIPELINE =
+      AsyncShaderCompiler::Priority::Background;
+  static constexpr auto COMPILE_PRIORITY_ONDEMAND_PIPELINE =
+      AsyncShaderCompiler::Priority::CurrentFrame;
+  static constexpr auto COMPILE_PRIORITY_SHADERCACHE_PIPELINE =
+      AsyncShaderCompiler::Priority::Background;
+
+  // Pipelines which were first used within this many frames in previous sessions are compiled
+  // before starting when waiting for shaders is enabled. The rest are compiled in the background.
+  static constexpr u32 FIRST_SCENE_FRAMES = 600;
 
   // Configuration bits.
   APIType m_api_type;
@@ -215,7 +250,7 @@ private:
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
     };
-    std::map<Uid, Shader> shader_map;
+    std::unordered_map<Uid, Shader> shader_map;
     Common::LinearDiskCache<Uid, u8> disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
@@ -224,14 +259,29 @@ private:
   ShaderModuleCache<UberShader::VertexShaderUid> m_uber_vs_cache;
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
-  // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
-      m_gx_uber_pipeline_cache;
+  // GX Pipeline Caches
+  // These are looked up whenever the pipeline state changes between draws, so they are keyed by
+  // the hash stored in the UIDs rather than ordered by the (large) UIDs.
+  using GXPipelineCache = std::unordered_map<GXPipelineUid, PipelineCacheEntry>;
+  using GXUberPipelineCache = std::unordered_map<GXUberPipelineUid, PipelineCacheEntry>;
+  GXPipelineCache m_gx_pipeline_cache;
+  GXUberPipelineCache m_gx_uber_pipeline_cache;
+
+  // The entries found by the last lookups, which are checked before the caches. Entries are never
+  // removed from the caches, and pointers to them stay valid when more are added.
+  GXPipelineCache::value_type* m_last_gx_pipeline = nullptr;
+  GXUberPipelineCache::value_type* m_last_gx_uber_pipeline = nullptr;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
+  // UIDs in the order they are stored in the UID cache, which the usage file is indexed by.
+  std::vector<GXPipelineUid> m_gx_pipeline_uid_order;
+  std::string m_gx_pipeline_usage_filename;
+
+  // Frames presented since the shader cache was created, for recording first use.
+  u32 m_frame_number = 0;
+
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
       m_efb_copy_to_vram_pipelines;
@@ -4,12 +4,18 @@
 #include "VideoCommon/ShaderGenCommon.h"
 
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "Common/FileUtil.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
+std::size_t HashUidData(const void* data, std::size_t size)
+{
+  return static_cast<std::size_t>(XXH3_64bits(data, size));
+}
+
 ShaderHostConfig ShaderHostConfig::GetCurrent()
 {
   ShaderHostConfig bits = {};
@@ -57,6 +57,9 @@ public:
   void SetConstantsUsed(unsigned int first_index, unsigned int last_index) {}
 };
 
+// Hashes the raw bytes of a UID structure, for use as the key of hash tables.
+std::size_t HashUidData(const void* data, std::size_t size);
+
 /*
  * Shader UID class used to uniquely identify the ShaderCode output written in the shader generator.
  * uid_data can be any struct of parameters that uniquely identify each shader code output.
@@ -98,10 +101,19 @@ public:
   // Returns the size of the underlying UID data structure in bytes.
   size_t GetUidDataSize() const { return sizeof(data); }
 
+  // Returns a hash of the UID data, for use in hash tables.
+  size_t GetHash() const { return HashUidData(GetUidDataRaw(), GetUidDataSize()); }
+
 private:
   uid_data data{};
 };
 
+template <class uid_data>
+struct std::hash<ShaderUid<uid_data>>
+{
+  size_t operator()(const ShaderUid<uid_data>& uid) const noexcept { return uid.GetHash(); }
+};
+
 class ShaderCode : public ShaderGeneratorInterface
 {
 public:
@@ -0,0 +1,97 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/StageTimer.h"
+
+#include <chrono>
+
+namespace VideoCommon
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct AtomicStageTotals
+{
+  std::atomic<u64> time_ns{0};
+  std::atomic<u64> calls{0};
+};
+
+Common::EnumMap<AtomicStageTotals, GPUStage::BackendSubmit> s_totals;
+
+// The innermost stage being timed on this thread, and when it was (re)started.
+thread_local bool s_in_stage = false;
+thread_local GPUStage s_current_stage;
+thread_local Clock::time_point s_stage_start;
+
+void AddTime(GPUStage stage, Clock::time_point now)
+{
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - s_stage_start);
+  s_totals[stage].time_ns.fetch_add(static_cast<u64>(elapsed.count()), std::memory_order_relaxed);
+}
+}  // namespace
+
+std::atomic<bool> StageTimer::s_enabled{false};
+
+void StageTimer::SetEnabled(bool enabled)
+{
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void StageTimer::Reset()
+{
+  for (AtomicStageTotals& totals : s_totals)
+  {
+    totals.time_ns.store(0, std::memory_order_relaxed);
+    totals.calls.store(0, std::memory_order_relaxed);
+  }
+}
+
+GPUStageTotalsMap StageTimer::GetTotals()
+{
+  GPUStageTotalsMap result;
+  for (size_t i = 0; i < s_totals.size(); ++i)
+  {
+    result.data()[i].time_ns = s_totals.data()[i].time_ns.load(std::memory_order_relaxed);
+    result.data()[i].calls = s_totals.data()[i].calls.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+const char* StageTimer::GetStageName(GPUStage stage)
+{
+  static constexpr Common::EnumMap<const char*, GPUStage::BackendSubmit> names{
+      "opcode_decoding", "vertex_loading", "texture_cache", "shader_cache", "backend_submit",
+  };
+  return names[stage];
+}
+
+void StageTimer::Enter(GPUStage stage)
+{
+  const Clock::time_point now = Clock::now();
+
+  // Pause the enclosing stage, so that each stage only accounts for its own time.
+  m_active = true;
+  m_has_parent = s_in_stage;
+  if (m_has_parent)
+  {
+    m_parent = s_current_stage;
+    AddTime(m_parent, now);
+  }
+
+  s_in_stage = true;
+  s_current_stage = stage;
+  s_stage_start = now;
+  s_totals[stage].calls.fetch_add(1, std::memory_order_relaxed);
+}
+
+void StageTimer::Leave()
+{
+  const Clock::time_point now = Clock::now();
+  AddTime(s_current_stage, now);
+
+  s_in_stage = m_has_parent;
+  s_current_stage = m_parent;
+  s_stage_start = now;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Coarse timers for the stages of GPU command processing, used by the FIFO log benchmark.
+// Timing is disabled by default, in which case a StageTimer only costs a relaxed atomic load.
+
+#pragma once
+
+#include <atomic>
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+
+namespace VideoCommon
+{
+enum class GPUStage
+{
+  OpcodeDecoding,
+  VertexLoading,
+  TextureCache,
+  ShaderCache,
+  BackendSubmit,
+};
+
+struct GPUStageTotals
+{
+  // Time spent in the stage, excluding time spent in other stages nested within it.
+  u64 time_ns = 0;
+  u64 calls = 0;
+};
+
+using GPUStageTotalsMap = Common::EnumMap<GPUStageTotals, GPUStage::BackendSubmit>;
+
+class StageTimer
+{
+public:
+  explicit StageTimer(GPUStage stage)
+  {
+    if (s_enabled.load(std::memory_order_relaxed)) [[unlikely]]
+      Enter(stage);
+  }
+  ~StageTimer()
+  {
+    if (m_active) [[unlikely]]
+      Leave();
+  }
+
+  StageTimer(const StageTimer&) = delete;
+  StageTimer& operator=(const StageTimer&) = delete;
+  StageTimer(StageTimer&&) = delete;
+  StageTimer& operator=(StageTimer&&) = delete;
+
+  static void SetEnabled(bool enabled);
+  static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  // Clears the accumulated totals. Should only be called while the GPU is idle.
+  static void Reset();
+  static GPUStageTotalsMap GetTotals();
+
+  // Returns an identifier for the stage which is suitable for machine-readable output.
+  static const char* GetStageName(GPUStage stage);
+
+private:
+  void Enter(GPUStage stage);
+  void Leave();
+
+  static std::atomic<bool> s_enabled;
+
+  bool m_active = false;
+  // The stage that was being timed on this thread when this timer was started, if any.
+  bool m_has_parent = false;
+  GPUStage m_parent{};
+};
+}  // namespace VideoCommon
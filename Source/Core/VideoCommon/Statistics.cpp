@@ -3,6 +3,7 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <chrono>
 #include <cstring>
 #include <utility>
 
@@ -13,6 +14,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -105,6 +107,23 @@ void Statistics::Display() const
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
+  draw_statistic("DSP idle skip:", "%u cycles",
+                 Core::System::GetInstance().GetPerfMetrics().GetDSPIdleSkipCycles());
+
+  if (g_frame_dumper && g_frame_dumper->IsFrameDumping())
+  {
+    const FrameDumpStats dump_stats = g_frame_dumper->GetStats();
+    if (dump_stats.frames != 0)
+    {
+      const auto per_frame = [&dump_stats](std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::milli>(time).count() / dump_stats.frames;
+      };
+      draw_statistic("Dump readback wait:", "%.2f ms/frame", per_frame(dump_stats.readback_wait));
+      draw_statistic("Dump queue wait:", "%.2f ms/frame", per_frame(dump_stats.dump_wait));
+      draw_statistic("Dump conversion:", "%.2f ms/frame", per_frame(dump_stats.conversion));
+      draw_statistic("Dump encoding:", "%.2f ms/frame", per_frame(dump_stats.encoding));
+    }
+  }
 
   ImGui::Columns(1);
 
@@ -26,6 +26,8 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Metrics.h"
+#include "Common/Tracing.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
@@ -49,6 +51,7 @@
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Resources/CustomResourceManager.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/StageTimer.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureConversionShader.h"
@@ -65,6 +68,14 @@ static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
 static int xfb_count = 0;
 
+static Common::Metrics::Counter s_lookups{
+    "texture_cache_lookups_total",
+    "Texture cache lookups; hits are lookups minus texture_cache_misses_total"};
+static Common::Metrics::Counter s_misses{"texture_cache_misses_total",
+                                         "Texture cache lookups that created a new texture"};
+static Common::Metrics::Counter s_bytes_decoded{"texture_bytes_decoded_total",
+                                                "Bytes of emulated texture data decoded"};
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
@@ -1067,6 +1078,8 @@ SamplerState TextureCacheBase::GetSamplerState(u32 index, float custom_tex_scale
 void TextureCacheBase::BindTextures(BitSet32 used_textures,
                                     const std::array<SamplerState, 8>& samplers)
 {
+  VideoCommon::StageTimer timer(VideoCommon::GPUStage::TextureCache);
+
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
   for (u32 i = 0; i < m_bound_textures.size(); i++)
@@ -1233,6 +1246,8 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(u32 stage)
 {
+  VideoCommon::StageTimer timer(VideoCommon::GPUStage::TextureCache);
+
   if (auto entry = LoadImpl(stage, false))
   {
     if (!DidLinkedAssetsChange(*entry))
@@ -1309,6 +1324,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   if (!texture_info.IsDataValid())
     return {};
 
+  s_lookups.Add();
+
   // Hash assigned to texcache entry (also used to generate filenames used for texture dumping and
   // custom texture lookup)
   u64 base_hash = TEXHASH_INVALID;
@@ -1598,6 +1615,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
     }
   }
 
+  s_misses.Add();
   auto entry =
       CreateTextureEntry(TextureCreationInfo{base_hash, full_hash, bytes_per_block, palette_size},
                          texture_info, textureCacheSafetyColorSampleSize, custom_texture_data.get(),
@@ -1616,6 +1634,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     const int safety_color_sample_size, VideoCommon::CustomTextureData* custom_texture_data,
     const bool custom_arbitrary_mipmaps, bool skip_texture_dump)
 {
+  TRACE_SCOPE("GPU", "Texture decode");
+
 #ifdef __APPLE__
   const bool no_mips = g_ActiveConfig.bNoMipmapping;
 #else
@@ -1669,6 +1689,7 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
+    s_bytes_decoded.Add(texture_info.GetTextureSize());
 
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
@@ -1731,6 +1752,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         continue;
       }
 
+      s_bytes_decoded.Add(mip_level.GetTextureSize());
+
       if (!decode_on_gpu ||
           !DecodeTextureOnGPU(entry, mip_level.GetLevel(), mip_level.GetData(),
                               mip_level.GetTextureSize(), texture_info.GetTextureFormat(),
@@ -1819,6 +1842,8 @@ static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
 RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
                                               MathUtil::Rectangle<int>* display_rect)
 {
+  TRACE_SCOPE("GPU", "XFB decode");
+
   // Compute total texture size. XFB textures aren't tiled, so this is simple.
   const u32 total_size = height * stride;
 
@@ -2132,6 +2157,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     float gamma, bool clamp_top, bool clamp_bottom,
     const CopyFilterCoefficients::Values& filter_coefficients)
 {
+  TRACE_SCOPE("GPU", "EFB copy");
+
   // Emulation methods:
   //
   // - EFB to RAM:
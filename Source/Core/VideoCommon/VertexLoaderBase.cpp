@@ -232,6 +232,23 @@ u32 VertexLoaderBase::GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& v
   return components;
 }
 
+bool VertexLoaderBase::UsesIndexedArrays(const TVtxDesc& vtx_desc)
+{
+  if (IsIndexed(vtx_desc.low.Position) || IsIndexed(vtx_desc.low.Normal))
+    return true;
+  for (u32 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    if (IsIndexed(vtx_desc.low.Color[i]))
+      return true;
+  }
+  for (u32 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    if (IsIndexed(vtx_desc.high.TexCoord[i]))
+      return true;
+  }
+  return false;
+}
+
 std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                                        const VAT& vtx_attr)
 {
@@ -57,6 +57,7 @@ class VertexLoaderBase
 public:
   static u32 GetVertexSize(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
   static u32 GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
+  static bool UsesIndexedArrays(const TVtxDesc& vtx_desc);
   static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                               const VAT& vtx_attr);
   virtual ~VertexLoaderBase() {}
@@ -66,6 +67,9 @@ public:
   PortableVertexDeclaration m_native_vtx_decl{};
   const u32 m_vertex_size;  // number of bytes of a raw GC vertex
   const u32 m_native_components;
+  // Whether any component is read from the vertex arrays in main memory, so that the output
+  // depends on more than the raw vertex data.
+  const bool m_uses_indexed_arrays;
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
@@ -74,8 +78,8 @@ public:
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
       : m_vertex_size{GetVertexSize(vtx_desc, vtx_attr)},
-        m_native_components{GetVertexComponents(vtx_desc, vtx_attr)}, m_VtxAttr{vtx_attr},
-        m_VtxDesc{vtx_desc}
+        m_native_components{GetVertexComponents(vtx_desc, vtx_attr)},
+        m_uses_indexed_arrays{UsesIndexedArrays(vtx_desc)}, m_VtxAttr{vtx_attr}, m_VtxDesc{vtx_desc}
   {
   }
 
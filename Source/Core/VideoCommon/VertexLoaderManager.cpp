@@ -4,6 +4,8 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -26,6 +28,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/StageTimer.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -395,8 +398,47 @@ static bool CanSplit(OpcodeDecoder::Primitive primitive)
   }
 }
 
+// The largest vertex the loaders output: a position matrix index, a position, three normals, two
+// colors and eight texture coordinates with matrix indices.
+constexpr int MAX_NATIVE_VERTEX_STRIDE = 4 + 3 * 4 + 3 * 3 * 4 + 2 * 4 + 8 * 3 * 4;
+// The last vertices are always loaded even when cached, see below.
+constexpr int NUM_TAIL_VERTICES = 3;
+
+static int LoadVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count,
+                        CachedVertices* cached_vertices)
+{
+  const int stride = loader->m_native_vtx_decl.stride;
+  if (cached_vertices == nullptr || loader->m_uses_indexed_arrays ||
+      stride > MAX_NATIVE_VERTEX_STRIDE)
+  {
+    return loader->RunVertices(src, dst, count);
+  }
+
+  if (cached_vertices->loader != loader)
+  {
+    const int num_loaded = loader->RunVertices(src, dst, count);
+    cached_vertices->loader = loader;
+    cached_vertices->num_loaded = num_loaded;
+    cached_vertices->data.assign(dst, dst + num_loaded * stride);
+    return num_loaded;
+  }
+
+  std::memcpy(dst, cached_vertices->data.data(), cached_vertices->data.size());
+
+  // The loaders also store the last vertices for zfreeze and the last normal, tangent and binormal
+  // in the caches above, so the last few vertices still need to go through the loader. Their output
+  // is thrown away, and loaders may write up to 4 bytes past the last vertex.
+  std::array<u8, NUM_TAIL_VERTICES * MAX_NATIVE_VERTEX_STRIDE + 4> tail_buffer;
+  const int tail = std::min(count, NUM_TAIL_VERTICES);
+  loader->RunVertices(src + (count - tail) * loader->m_vertex_size, tail_buffer.data(), tail);
+  loader->m_numLoadedVertices += count - tail;
+
+  return cached_vertices->num_loaded;
+}
+
 template <bool IsPreprocess>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                CachedVertices* cached_vertices)
 {
   if (count == 0) [[unlikely]]
     return 0;
@@ -444,15 +486,24 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
     const int stride = loader->m_native_vtx_decl.stride;
+    const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
+
+    // Primitives large enough to be split are rare, and aren't worth caching.
+    if (CanSplit(primitive) && count > max_vertices)
+      cached_vertices = nullptr;
+
     do
     {
-      const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
       const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      int num_loaded;
+      {
+        VideoCommon::StageTimer timer(VideoCommon::GPUStage::VertexLoading);
+        num_loaded = LoadVertices(loader, src, dst.GetPointer(), run, cached_vertices);
+      }
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
@@ -479,9 +530,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 }
 
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                                const u8* src);
+                                const u8* src, CachedVertices* cached_vertices);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                               const u8* src);
+                               const u8* src, CachedVertices* cached_vertices);
 
 NativeVertexFormat* GetCurrentVertexFormat()
 {
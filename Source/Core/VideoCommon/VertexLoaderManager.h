@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
@@ -40,9 +41,23 @@ NativeVertexFormat* GetOrCreateMatchingFormat(const PortableVertexDeclaration& d
 // offsets set to the unused attributes.
 NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 
+// Converted vertices of a primitive in a display list, so that they can be reused when the same
+// display list is called again. Only used for vertex formats without indexed components, as the
+// output then only depends on the vertex data (which the display list cache checks) and the
+// vertex format.
+struct CachedVertices
+{
+  const VertexLoaderBase* loader = nullptr;
+  int num_loaded = 0;
+  std::vector<u8> data;
+};
+
 // Returns -1 if buf_size is insufficient, else the amount of bytes consumed
+// If <cached_vertices> is set, the converted vertices are stored there, or taken from there if
+// they were stored with the same vertex loader.
 template <bool IsPreprocess = false>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                CachedVertices* cached_vertices = nullptr);
 
 namespace detail
 {
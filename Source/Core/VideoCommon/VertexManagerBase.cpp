@@ -14,6 +14,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
+#include "Common/Tracing.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/SystemTimers.h"
@@ -34,6 +35,7 @@
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/StageTimer.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -438,6 +440,7 @@ void VertexManagerBase::Flush()
     return;
 
   m_is_flushed = true;
+  TRACE_SCOPE("GPU", "Draw");
 
   if (m_draw_counter == 0)
   {
@@ -797,13 +800,15 @@ void VertexManagerBase::CalculateNormals(NativeVertexFormat* format)
 
 void VertexManagerBase::UpdatePipelineConfig()
 {
+  bool config_changed = false;
+
   NativeVertexFormat* vertex_format = VertexLoaderManager::GetCurrentVertexFormat();
   if (vertex_format != m_current_pipeline_config.vertex_format)
   {
     m_current_pipeline_config.vertex_format = vertex_format;
     m_current_uber_pipeline_config.vertex_format =
         VertexLoaderManager::GetUberVertexFormat(vertex_format->GetVertexDeclaration());
-    m_pipeline_config_changed = true;
+    config_changed = true;
   }
 
   VertexShaderUid vs_uid = GetVertexShaderUid();
@@ -811,7 +816,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   {
     m_current_pipeline_config.vs_uid = vs_uid;
     m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
-    m_pipeline_config_changed = true;
+    config_changed = true;
   }
 
   PixelShaderUid ps_uid = GetPixelShaderUid();
@@ -819,7 +824,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   {
     m_current_pipeline_config.ps_uid = ps_uid;
     m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
-    m_pipeline_config_changed = true;
+    config_changed = true;
   }
 
   GeometryShaderUid gs_uid = GetGeometryShaderUid(GetCurrentPrimitiveType());
@@ -827,7 +832,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   {
     m_current_pipeline_config.gs_uid = gs_uid;
     m_current_uber_pipeline_config.gs_uid = gs_uid;
-    m_pipeline_config_changed = true;
+    config_changed = true;
   }
 
   if (m_rasterization_state_changed)
@@ -840,7 +845,7 @@ void VertexManagerBase::UpdatePipelineConfig()
     {
       m_current_pipeline_config.rasterization_state = new_rs;
       m_current_uber_pipeline_config.rasterization_state = new_rs;
-      m_pipeline_config_changed = true;
+      config_changed = true;
     }
   }
 
@@ -854,7 +859,7 @@ void VertexManagerBase::UpdatePipelineConfig()
     {
       m_current_pipeline_config.depth_state = new_ds;
       m_current_uber_pipeline_config.depth_state = new_ds;
-      m_pipeline_config_changed = true;
+      config_changed = true;
     }
   }
 
@@ -868,9 +873,16 @@ void VertexManagerBase::UpdatePipelineConfig()
     {
       m_current_pipeline_config.blending_state = new_bs;
       m_current_uber_pipeline_config.blending_state = new_bs;
-      m_pipeline_config_changed = true;
+      config_changed = true;
     }
   }
+
+  if (config_changed)
+  {
+    m_current_pipeline_config.UpdateHash();
+    m_current_uber_pipeline_config.UpdateHash();
+    m_pipeline_config_changed = true;
+  }
 }
 
 void VertexManagerBase::UpdatePipelineObject()
@@ -878,6 +890,8 @@ void VertexManagerBase::UpdatePipelineObject()
   if (!m_pipeline_config_changed)
     return;
 
+  VideoCommon::StageTimer timer(VideoCommon::GPUStage::ShaderCache);
+
   m_current_pipeline_object = nullptr;
   m_pipeline_config_changed = false;
 
@@ -1060,6 +1074,8 @@ void VertexManagerBase::RenderDrawCall(
     std::span<u8> custom_pixel_shader_uniforms, PrimitiveType primitive_type,
     const AbstractPipeline* current_pipeline)
 {
+  VideoCommon::StageTimer timer(VideoCommon::GPUStage::BackendSubmit);
+
   // Now we can upload uniforms, as nothing else will override them.
   geometry_shader_manager.SetConstants(primitive_type);
   pixel_shader_manager.SetConstants();
@@ -48,6 +48,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/EFBInterface.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FrameDumper.h"
@@ -396,5 +397,6 @@ void VideoBackendBase::ShutdownShared()
   m_initialized = false;
 
   VertexLoaderManager::Clear();
+  OpcodeDecoder::g_display_list_cache.Clear();
   system.GetFifo().Shutdown();
 }
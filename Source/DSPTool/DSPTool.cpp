@@ -49,6 +49,9 @@ void DSP::Host::CodeLoaded(DSPCore& dsp, const u8* ptr, size_t size)
 void DSP::Host::InterruptRequest()
 {
 }
+void DSP::Host::IdleSkipped(u32 cycles)
+{
+}
 
 static std::string CodeToHeader(const std::vector<u16>& code, const std::string& filename)
 {
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Metrics.h"
+
+using Common::Metrics::Counter;
+using Common::Metrics::Gauge;
+using Common::Metrics::Metric;
+
+static Counter s_test_counter{"test_counter_total", "A counter for testing"};
+static Gauge s_test_gauge{"test_gauge", "A gauge for testing"};
+
+TEST(Metrics, CountersAreThreadSafe)
+{
+  const u64 initial = s_test_counter.Get();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([] {
+      for (int j = 0; j < 10000; ++j)
+        s_test_counter.Add();
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(s_test_counter.Get(), initial + 40000);
+}
+
+TEST(Metrics, MetricsAreRegistered)
+{
+  s_test_gauge.Set(2.5);
+
+  bool found_counter = false;
+  bool found_gauge = false;
+  Common::Metrics::ForEach([&](const Metric& metric) {
+    if (&metric == &s_test_counter)
+    {
+      found_counter = true;
+      EXPECT_EQ(metric.GetType(), Metric::Type::Counter);
+    }
+    else if (&metric == &s_test_gauge)
+    {
+      found_gauge = true;
+      EXPECT_EQ(metric.GetType(), Metric::Type::Gauge);
+      EXPECT_EQ(metric.GetValue(), 2.5);
+    }
+  });
+  EXPECT_TRUE(found_counter);
+  EXPECT_TRUE(found_gauge);
+}
+
+TEST(Metrics, FormatText)
+{
+  s_test_gauge.Set(0.5);
+
+  const std::string text = Common::Metrics::FormatText();
+  EXPECT_NE(text.find("# HELP dolphin_test_gauge A gauge for testing\n"
+                      "# TYPE dolphin_test_gauge gauge\n"
+                      "dolphin_test_gauge 0.5\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("# TYPE dolphin_test_counter_total counter\n"
+                      "dolphin_test_counter_total " +
+                      std::to_string(s_test_counter.Get()) + "\n"),
+            std::string::npos);
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <picojson.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Tracing.h"
+
+namespace
+{
+picojson::array ExportEvents()
+{
+  const std::string directory = File::CreateTempDir();
+  const std::string path = directory + "/trace.json";
+  EXPECT_TRUE(Common::Tracing::ExportChromeTrace(path));
+
+  std::string contents;
+  File::ReadFileToString(path, contents);
+  File::DeleteDirRecursively(directory);
+
+  picojson::value root;
+  const std::string error = picojson::parse(root, contents);
+  EXPECT_EQ(error, "");
+  return root.get("traceEvents").get<picojson::array>();
+}
+}  // namespace
+
+TEST(Tracing, SpansAreOnlyRecordedWhileEnabled)
+{
+  { TRACE_SCOPE("Test", "Before start"); }
+
+  Common::Tracing::Start();
+  { TRACE_SCOPE("Test", "Main \"span\""); }
+  std::thread([] {
+    Common::Tracing::SetCurrentThreadName("Worker");
+    TRACE_SCOPE("Test", "Worker span");
+  }).join();
+  Common::Tracing::Stop();
+
+  { TRACE_SCOPE("Test", "After stop"); }
+
+  std::map<std::string, std::string> span_threads;
+  std::map<double, std::string> thread_names;
+  for (const picojson::value& event : ExportEvents())
+  {
+    const std::string& phase = event.get("ph").get<std::string>();
+    const double tid = event.get("tid").get<double>();
+    if (phase == "M")
+    {
+      thread_names[tid] = event.get("args").get("name").get<std::string>();
+    }
+    else
+    {
+      EXPECT_EQ(phase, "X");
+      EXPECT_EQ(event.get("cat").get<std::string>(), "Test");
+      EXPECT_GE(event.get("dur").get<double>(), 0.0);
+      span_threads[event.get("name").get<std::string>()] = thread_names[tid];
+    }
+  }
+
+  ASSERT_EQ(span_threads.size(), 2u);
+  EXPECT_TRUE(span_threads.contains("Main \"span\""));
+  EXPECT_EQ(span_threads["Worker span"], "Worker");
+}
+
+TEST(Tracing, StartDiscardsPreviousSpans)
+{
+  Common::Tracing::Start();
+  { TRACE_SCOPE("Test", "First trace"); }
+  Common::Tracing::Stop();
+
+  Common::Tracing::Start();
+  { TRACE_SCOPE("Test", Common::Tracing::InternName("Second trace")); }
+  Common::Tracing::Stop();
+
+  const picojson::array events = ExportEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[1].get("name").get<std::string>(), "Second trace");
+}
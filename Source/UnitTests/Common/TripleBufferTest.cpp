@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+#include "Common/CommonTypes.h"
+#include "Common/TripleBuffer.h"
+
+TEST(TripleBuffer, Simple)
+{
+  Common::TripleBuffer<u32> buffer;
+
+  EXPECT_FALSE(buffer.Update());
+  EXPECT_EQ(0u, buffer.GetReadBuffer());
+
+  buffer.GetWriteBuffer() = 1;
+  buffer.Publish();
+  EXPECT_EQ(0u, buffer.GetReadBuffer());
+  EXPECT_TRUE(buffer.Update());
+  EXPECT_EQ(1u, buffer.GetReadBuffer());
+  EXPECT_FALSE(buffer.Update());
+  EXPECT_EQ(1u, buffer.GetReadBuffer());
+
+  // Only the latest published value is picked up.
+  for (u32 i = 2; i <= 10; ++i)
+  {
+    buffer.GetWriteBuffer() = i;
+    buffer.Publish();
+  }
+  EXPECT_TRUE(buffer.Update());
+  EXPECT_EQ(10u, buffer.GetReadBuffer());
+
+  // Values which are written but not published are not visible.
+  buffer.GetWriteBuffer() = 11;
+  EXPECT_FALSE(buffer.Update());
+  EXPECT_EQ(10u, buffer.GetReadBuffer());
+}
+
+TEST(TripleBuffer, MultiThreaded)
+{
+  // Every element is written with the same value, so a torn snapshot would be detected.
+  using Snapshot = std::array<u32, 64>;
+  Common::TripleBuffer<Snapshot> buffer;
+  std::atomic<bool> done = false;
+
+  constexpr u32 COUNT = 100000;
+  std::thread producer([&] {
+    for (u32 i = 1; i <= COUNT; ++i)
+    {
+      buffer.GetWriteBuffer().fill(i);
+      buffer.Publish();
+    }
+    done = true;
+  });
+
+  u32 last = 0;
+  bool ok = true;
+  while (last != COUNT)
+  {
+    const bool was_done = done;
+    if (!buffer.Update())
+    {
+      // Once the producer is done, its last value must be visible.
+      ok &= !was_done;
+      if (!ok)
+        break;
+      continue;
+    }
+
+    const Snapshot& snapshot = buffer.GetReadBuffer();
+    for (const u32 value : snapshot)
+      ok &= value == snapshot[0];
+    // Snapshots never go back in time.
+    ok &= snapshot[0] > last;
+    last = snapshot[0];
+    if (!ok)
+      break;
+  }
+
+  producer.join();
+  EXPECT_TRUE(ok);
+  EXPECT_EQ(COUNT, last);
+}
@@ -0,0 +1,228 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/ConfigManager.h"
+#include "Core/HW/DSP.h"
+#include "Core/HW/DSPHLE/DSPHLE.h"
+#include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+
+namespace
+{
+// F-Zero GX and others. Has a low-pass filter in its PBs and the compressor command.
+constexpr u32 AX_CRC = 0x07f88145;
+
+constexpr u32 CMDLIST_ADDR = 0x00100000;
+constexpr u32 INIT_ADDR = 0x00101000;
+constexpr u32 PB_ADDR = 0x00102000;
+constexpr u32 AUX_UPLOAD_ADDR = 0x00103000;
+constexpr u32 AUX_DOWNLOAD_ADDR = 0x00104000;
+constexpr u32 COMPRESSOR_TABLE_ADDR = 0x00105000;
+constexpr u32 SURROUND_ADDR = 0x00107000;
+constexpr u32 LR_ADDR = 0x00108000;
+
+// In 16-bit samples.
+constexpr u32 ARAM_SAMPLES_ADDR = 0x1000;
+constexpr u32 ARAM_SAMPLE_COUNT = 0x100;
+
+constexpr u32 BUFFER_SIZE = 5 * 32 * sizeof(int);
+constexpr u32 COMPRESSOR_FRAMES = 2;
+constexpr u32 COMPRESSOR_TABLE_SIZE = (11 + COMPRESSOR_FRAMES) * 5 * 32 * sizeof(u16);
+
+class TestAXUCode final : public DSP::HLE::AXUCode
+{
+public:
+  using AXUCode::AXUCode;
+
+  using AXUCode::CopyCmdList;
+  using AXUCode::HandleCommandList;
+  using AXUCode::SnapshotCommandList;
+
+  void ApplyWrites() { m_memory.ApplyWrites(); }
+};
+
+struct OutputRange
+{
+  u32 address;
+  u32 size;
+};
+
+constexpr std::array<OutputRange, 4> OUTPUT_RANGES{{
+    {PB_ADDR, sizeof(DSP::HLE::AXPB)},
+    {AUX_UPLOAD_ADDR, 3 * BUFFER_SIZE},
+    {SURROUND_ADDR, BUFFER_SIZE},
+    {LR_ADDR, 5 * 32 * 2 * sizeof(s16)},
+}};
+}  // namespace
+
+class AXCommandListTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    SConfig::Init();
+
+    auto& system = Core::System::GetInstance();
+    system.GetMemory().Init();
+    system.GetDSP().Reinit(true);
+
+    WriteCommandList();
+    WriteInputs(0);
+  }
+
+  void TearDown() override
+  {
+    auto& system = Core::System::GetInstance();
+    system.GetDSP().Shutdown();
+    system.GetMemory().Shutdown();
+
+    SConfig::Shutdown();
+  }
+
+  static TestAXUCode MakeUCode()
+  {
+    auto& system = Core::System::GetInstance();
+    auto* dsphle = static_cast<DSP::HLE::DSPHLE*>(system.GetDSP().GetDSPEmulator());
+    return TestAXUCode(dsphle, AX_CRC);
+  }
+
+  static void WriteCommandList()
+  {
+    const std::vector<u16> cmdlist{
+        // SETUP
+        0x0000, INIT_ADDR >> 16, INIT_ADDR & 0xFFFF,
+        // PB_ADDR
+        0x0002, PB_ADDR >> 16, PB_ADDR & 0xFFFF,
+        // PROCESS
+        0x0003,
+        // MIX_AUXA
+        0x0004, AUX_UPLOAD_ADDR >> 16, AUX_UPLOAD_ADDR & 0xFFFF, AUX_DOWNLOAD_ADDR >> 16,
+        AUX_DOWNLOAD_ADDR & 0xFFFF,
+        // COMPRESSOR
+        0x0012, 0x0100, COMPRESSOR_FRAMES, COMPRESSOR_TABLE_ADDR >> 16,
+        COMPRESSOR_TABLE_ADDR & 0xFFFF,
+        // OUTPUT
+        0x000E, SURROUND_ADDR >> 16, SURROUND_ADDR & 0xFFFF, LR_ADDR >> 16, LR_ADDR & 0xFFFF,
+        // END
+        0x000F,
+    };
+    auto& memory = Core::System::GetInstance().GetMemory();
+    memory.CopyToEmuSwapped(CMDLIST_ADDR, cmdlist.data(), cmdlist.size() * sizeof(u16));
+  }
+
+  // Writes everything the command list reads. A different seed simulates the CPU overwriting the
+  // inputs after the command list has been sent.
+  static void WriteInputs(int seed)
+  {
+    auto& system = Core::System::GetInstance();
+    auto& memory = system.GetMemory();
+
+    std::array<u16, 3 * 9> init{};
+    // AUXA L starts at 0x100, and increases by 1 for each sample.
+    init[3 * 3 + 1] = 0x100 + seed;
+    init[3 * 3 + 2] = 1;
+    memory.CopyToEmuSwapped(INIT_ADDR, init.data(), sizeof(init));
+
+    DSP::HLE::AXPB pb{};
+    pb.src_type = 1;  // Linear
+    pb.mixer_control = 0x0001 | 0x0002 | 0x0010;
+    pb.running = 1;
+    pb.mixer.main_left.volume = 0x4000;
+    pb.mixer.main_right.volume = 0x2000;
+    pb.mixer.auxA_left.volume = 0x3000 + seed;
+    pb.vol_env.cur_volume = 0x7000;
+    pb.audio_addr.looping = 1;
+    pb.audio_addr.sample_format = 0x0A;  // PCM16
+    pb.audio_addr.loop_addr_lo = ARAM_SAMPLES_ADDR;
+    pb.audio_addr.end_addr_lo = ARAM_SAMPLES_ADDR + ARAM_SAMPLE_COUNT - 1;
+    pb.audio_addr.cur_addr_lo = ARAM_SAMPLES_ADDR + 0x40 + seed;
+    pb.adpcm.gain = 0x800;
+    // Consumes 1.5 input samples per output sample, so that the voice loops within the frame.
+    pb.src.ratio_hi = 1;
+    pb.src.ratio_lo = 0x8000;
+    memory.CopyToEmuSwapped(PB_ADDR, reinterpret_cast<const u16*>(&pb), sizeof(pb));
+
+    auto& dsp = system.GetDSP();
+    for (u32 i = 0; i < ARAM_SAMPLE_COUNT; ++i)
+    {
+      const u16 sample = static_cast<u16>((i + seed) * 0x95);
+      dsp.WriteARAM(static_cast<u8>(sample >> 8), (ARAM_SAMPLES_ADDR + i) * 2);
+      dsp.WriteARAM(static_cast<u8>(sample), (ARAM_SAMPLES_ADDR + i) * 2 + 1);
+    }
+
+    std::array<s32, 3 * 5 * 32> aux;
+    for (size_t i = 0; i < aux.size(); ++i)
+      aux[i] = static_cast<s32>(i * 7 + seed) - 0x200;
+    memory.CopyToEmuSwapped(AUX_DOWNLOAD_ADDR, aux.data(), sizeof(aux));
+
+    std::array<u16, COMPRESSOR_TABLE_SIZE / sizeof(u16)> table;
+    for (size_t i = 0; i < table.size(); ++i)
+      table[i] = static_cast<u16>(0x4000 + i + seed);
+    memory.CopyToEmuSwapped(COMPRESSOR_TABLE_ADDR, table.data(), sizeof(table));
+  }
+
+  static std::vector<u8> ReadOutputs()
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    std::vector<u8> outputs;
+    for (const OutputRange& range : OUTPUT_RANGES)
+    {
+      const u8* data = memory.GetPointerForRange(range.address, range.size);
+      outputs.insert(outputs.end(), data, data + range.size);
+    }
+    return outputs;
+  }
+};
+
+TEST_F(AXCommandListTest, RecordedMatchesInline)
+{
+  const std::vector<u8> initial_outputs = ReadOutputs();
+
+  TestAXUCode inline_ucode = MakeUCode();
+  inline_ucode.CopyCmdList(CMDLIST_ADDR, 64);
+  inline_ucode.HandleCommandList();
+  const std::vector<u8> inline_outputs = ReadOutputs();
+  ASSERT_NE(inline_outputs, initial_outputs);
+
+  // Start over, and record the command list as the CPU thread does when it receives it.
+  WriteInputs(0);
+  auto& memory = Core::System::GetInstance().GetMemory();
+  memory.Memset(AUX_UPLOAD_ADDR, 0, 3 * BUFFER_SIZE);
+  memory.Memset(SURROUND_ADDR, 0, BUFFER_SIZE);
+  memory.Memset(LR_ADDR, 0, 5 * 32 * 2 * sizeof(s16));
+  ASSERT_EQ(ReadOutputs(), initial_outputs);
+
+  TestAXUCode recorded_ucode = MakeUCode();
+  recorded_ucode.CopyCmdList(CMDLIST_ADDR, 64);
+  ASSERT_TRUE(recorded_ucode.SnapshotCommandList());
+
+  // The CPU keeps running while the command list is handled, and may change what it reads.
+  WriteInputs(1);
+  const std::vector<u8> clobbered_outputs = ReadOutputs();
+
+  recorded_ucode.HandleCommandList();
+  EXPECT_EQ(ReadOutputs(), clobbered_outputs);
+
+  recorded_ucode.ApplyWrites();
+  EXPECT_EQ(ReadOutputs(), inline_outputs);
+}
+
+TEST_F(AXCommandListTest, LoopingPBListIsNotRecorded)
+{
+  // A PB that links to itself would be processed forever.
+  const std::array<u16, 2> next_pb{PB_ADDR >> 16, PB_ADDR & 0xFFFF};
+  auto& memory = Core::System::GetInstance().GetMemory();
+  memory.CopyToEmuSwapped(PB_ADDR, next_pb.data(), sizeof(next_pb));
+
+  TestAXUCode ucode = MakeUCode();
+  ucode.CopyCmdList(CMDLIST_ADDR, 64);
+  EXPECT_FALSE(ucode.SnapshotCommandList());
+}
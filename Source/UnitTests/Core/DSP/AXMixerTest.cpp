@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixer.h"
+
+namespace
+{
+// Reference implementations, matching the original per-sample AX voice code.
+s16 ReferenceScale(s16 sample, u16 volume, bool signed_volume)
+{
+  const s64 vol = signed_volume ? s64(s16(volume)) : s64(volume);
+  return static_cast<s16>(std::clamp<s64>((sample * vol) >> 15, -0x8000, 0x7FFF));
+}
+
+constexpr std::array<u32, 6> COUNTS = {0, 1, 7, 18, 32, 96};
+constexpr std::array<u16, 6> VOLUMES = {0x0000, 0x0001, 0x7FFF, 0x8000, 0xC000, 0xFFFF};
+constexpr std::array<u16, 5> DELTAS = {0x0000, 0x0001, 0x0123, 0x8000, 0xFFFF};
+
+std::array<s16, 96> MakeSamples(std::mt19937& rng)
+{
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  std::array<s16, 96> samples;
+  for (s16& sample : samples)
+    sample = static_cast<s16>(dist(rng));
+  // Make sure the extremes are covered so that saturation is exercised.
+  samples[3] = -0x8000;
+  samples[10] = 0x7FFF;
+  return samples;
+}
+}  // namespace
+
+TEST(AXMixer, ApplyVolumeRampMatchesReference)
+{
+  std::mt19937 rng(1234);
+  for (const bool signed_volume : {false, true})
+  {
+    for (const u32 count : COUNTS)
+    {
+      for (const u16 volume : VOLUMES)
+      {
+        for (const u16 delta : DELTAS)
+        {
+          std::array<s16, 96> samples = MakeSamples(rng);
+          std::array<s16, 96> expected = samples;
+
+          u16 expected_volume = volume;
+          for (u32 i = 0; i < count; ++i)
+          {
+            expected[i] = ReferenceScale(expected[i], expected_volume, signed_volume);
+            expected_volume += delta;
+          }
+
+          const u16 new_volume =
+              DSP::HLE::AXMixer::ApplyVolumeRamp(samples.data(), count, volume, delta, signed_volume);
+          EXPECT_EQ(new_volume, expected_volume);
+          EXPECT_EQ(samples, expected);
+        }
+      }
+    }
+  }
+}
+
+TEST(AXMixer, MixAddMatchesReference)
+{
+  std::mt19937 rng(5678);
+  std::uniform_int_distribution<int> out_dist(-0x100000, 0x100000);
+  for (const u32 count : COUNTS)
+  {
+    for (const u16 volume : VOLUMES)
+    {
+      for (const u16 delta : DELTAS)
+      {
+        const std::array<s16, 96> input = MakeSamples(rng);
+        std::array<int, 96> out;
+        for (int& value : out)
+          value = out_dist(rng);
+        std::array<int, 96> expected = out;
+
+        u16 expected_volume = volume;
+        s16 expected_last = 0x1234;
+        for (u32 i = 0; i < count; ++i)
+        {
+          expected_last = ReferenceScale(input[i], expected_volume, false);
+          expected[i] += expected_last;
+          expected_volume += delta;
+        }
+
+        s16 last = 0x1234;
+        const u16 new_volume =
+            DSP::HLE::AXMixer::MixAdd(out.data(), input.data(), count, volume, delta, &last);
+        EXPECT_EQ(new_volume, expected_volume);
+        EXPECT_EQ(last, expected_last);
+        EXPECT_EQ(out, expected);
+      }
+    }
+  }
+}
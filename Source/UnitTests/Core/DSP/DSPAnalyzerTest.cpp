@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+
+namespace
+{
+constexpr u16 LOOP_START = 0x0010;
+
+// LRS $AC0.M, @CMBH
+constexpr u16 POLL_MAILBOX = 0x26fe;
+// ANDCF $AC0.M, #0x8000
+constexpr std::initializer_list<u16> TEST_MAIL_BIT = {0x02c0, 0x8000};
+// JLNZ LOOP_START
+constexpr std::initializer_list<u16> LOOP_UNTIL_MAIL = {0x029c, LOOP_START};
+}  // namespace
+
+class DSPAnalyzerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    DSP::InitInstructionTable();
+    m_iram.fill(0x0021);  // HALT
+    m_irom.fill(0x0021);
+    m_core.DSPState().iram = m_iram.data();
+    m_core.DSPState().irom = m_irom.data();
+  }
+
+  void TearDown() override
+  {
+    m_core.DSPState().iram = nullptr;
+    m_core.DSPState().irom = nullptr;
+  }
+
+  // Writes the given instructions, one list of words per instruction, from the loop start.
+  void WriteLoop(std::initializer_list<std::initializer_list<u16>> instructions)
+  {
+    u16 addr = LOOP_START;
+    for (const auto& words : instructions)
+    {
+      for (const u16 word : words)
+        m_iram[addr++] = word;
+    }
+  }
+
+  bool IsIdleSkip(u16 address)
+  {
+    m_analyzer.Analyze(m_core.DSPState());
+    return m_analyzer.IsIdleSkip(address);
+  }
+
+  DSP::DSPCore m_core;
+  DSP::Analyzer m_analyzer;
+  std::array<u16, DSP::DSP_IRAM_SIZE> m_iram{};
+  std::array<u16, DSP::DSP_IROM_SIZE> m_irom{};
+};
+
+TEST_F(DSPAnalyzerTest, MailboxPollingLoopIsIdle)
+{
+  WriteLoop({{POLL_MAILBOX}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_TRUE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, ImmediateLoadsInPollingLoopAreIdle)
+{
+  // LRI $AR0, #0x1234
+  WriteLoop({{0x0080, 0x1234}, {POLL_MAILBOX}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_TRUE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, LoopWithoutMemoryReadIsNotIdle)
+{
+  // CMPI $AC0.M, #0x1234; JLNZ LOOP_START
+  WriteLoop({{0x0280, 0x1234}, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, LoopThatModifiesAccumulatorIsNotIdle)
+{
+  // INC $AC0
+  WriteLoop({{POLL_MAILBOX}, {0x7600}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, ImmediateLoadToStackRegisterIsNotIdle)
+{
+  // LRI $ST0, #0x1234
+  WriteLoop({{0x008c, 0x1234}, {POLL_MAILBOX}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, MemoryLoadToStackRegisterIsNotIdle)
+{
+  // LR $ST1, @CMBH
+  WriteLoop({{0x00cd, 0xfffe}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, LoadToStatusRegisterIsNotIdle)
+{
+  // LR $SR, @CMBH
+  WriteLoop({{0x00d3, 0xfffe}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, MemoryLoadFromMailboxLowIsNotIdle)
+{
+  // LR $AC0.M, @CMBL
+  WriteLoop({{0x00de, 0xffff}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
+
+TEST_F(DSPAnalyzerTest, ShortLoadFromMailboxLowIsNotIdle)
+{
+  // LRS $AC0.M, @DMBL
+  WriteLoop({{0x26fd}, TEST_MAIL_BIT, LOOP_UNTIL_MAIL});
+  EXPECT_FALSE(IsIdleSkip(LOOP_START));
+}
@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -13,6 +14,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/HostBackend/FS.h"
 #include "Core/IOS/IOS.h"
 #include "UICommon/UICommon.h"
 
@@ -575,3 +577,164 @@ TEST_F(FileSystemTest, DoState)
       ASSERT_EQ(read_buffer[i], TEST_DATA_1[i]);
   }
 }
+
+static const std::vector<u8> BASE_DATA{{1, 2, 3, 4}};
+
+class FileSystemOverlayTest : public testing::Test
+{
+protected:
+  FileSystemOverlayTest()
+      : m_base_path{File::CreateTempDir()}, m_overlay_path{File::CreateTempDir()}
+  {
+    HostFileSystem base{m_base_path};
+    base.CreateDirectory(Uid{0}, Gid{0}, "/tmp", 0, modes);
+    base.CreateDirectory(Uid{0}, Gid{0}, "/tmp/dir", 0, modes);
+    base.CreateFile(Uid{0}, Gid{0}, "/tmp/dir/f", 0, modes);
+    const Result<FileHandle> file = base.OpenFile(Uid{0}, Gid{0}, "/tmp/dir/f", Mode::Write);
+    if (file)
+      file->Write(BASE_DATA.data(), BASE_DATA.size());
+
+    ResetOverlay();
+  }
+
+  ~FileSystemOverlayTest() override
+  {
+    m_fs.reset();
+    File::DeleteDirRecursively(m_base_path);
+    File::DeleteDirRecursively(m_overlay_path);
+  }
+
+  void ResetOverlay()
+  {
+    m_fs.reset();
+    m_fs = std::make_unique<HostFileSystem>(m_overlay_path, std::vector<NandRedirect>{},
+                                            m_base_path);
+  }
+
+  static std::optional<std::vector<u8>> ReadFile(FileSystem& fs, const std::string& path)
+  {
+    const Result<FileHandle> file = fs.OpenFile(Uid{0}, Gid{0}, path, Mode::Read);
+    if (!file)
+      return std::nullopt;
+    const Result<FileStatus> status = file->GetStatus();
+    if (!status)
+      return std::nullopt;
+
+    std::vector<u8> data(status->size);
+    if (!file->Read(data.data(), data.size()))
+      return std::nullopt;
+    return data;
+  }
+
+  std::optional<std::vector<u8>> ReadBaseFile(const std::string& path)
+  {
+    HostFileSystem base{m_base_path};
+    return ReadFile(base, path);
+  }
+
+  std::string m_base_path;
+  std::string m_overlay_path;
+  std::unique_ptr<HostFileSystem> m_fs;
+};
+
+TEST_F(FileSystemOverlayTest, ReadsFromBase)
+{
+  const Result<std::vector<std::string>> tmp_files = m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp");
+  ASSERT_TRUE(tmp_files.has_value());
+  EXPECT_EQ(*tmp_files, std::vector<std::string>{"dir"});
+
+  const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/dir/f");
+  ASSERT_TRUE(metadata.has_value());
+  EXPECT_EQ(metadata->size, BASE_DATA.size());
+  EXPECT_EQ(ReadFile(*m_fs, "/tmp/dir/f"), BASE_DATA);
+
+  // Nothing should have been copied yet.
+  EXPECT_FALSE(File::Exists(m_overlay_path + "/tmp"));
+}
+
+TEST_F(FileSystemOverlayTest, WritesOnlyChangeOverlay)
+{
+  const std::vector<u8> NEW_DATA{{9, 8, 7, 6, 5}};
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/dir/f", Mode::ReadWrite);
+    ASSERT_TRUE(file.has_value());
+    ASSERT_TRUE(file->Write(NEW_DATA.data(), NEW_DATA.size()).has_value());
+  }
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/dir/g", 0, modes), ResultCode::Success);
+
+  EXPECT_EQ(ReadFile(*m_fs, "/tmp/dir/f"), NEW_DATA);
+  EXPECT_EQ(ReadBaseFile("/tmp/dir/f"), BASE_DATA);
+  EXPECT_FALSE(ReadBaseFile("/tmp/dir/g").has_value());
+
+  const Result<std::vector<std::string>> files = m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp/dir");
+  ASSERT_TRUE(files.has_value());
+  EXPECT_EQ(files->size(), 2u);
+}
+
+TEST_F(FileSystemOverlayTest, HandlesSeeWritesAfterCopy)
+{
+  const std::vector<u8> NEW_DATA{{9, 8, 7, 6}};
+  std::vector<u8> read_buffer(NEW_DATA.size());
+
+  const Result<FileHandle> reader = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/dir/f", Mode::Read);
+  ASSERT_TRUE(reader.has_value());
+
+  // Opening the file for writing copies it to the overlay, which the first handle must follow.
+  const Result<FileHandle> writer = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/dir/f", Mode::ReadWrite);
+  ASSERT_TRUE(writer.has_value());
+  ASSERT_TRUE(writer->Write(NEW_DATA.data(), NEW_DATA.size()).has_value());
+
+  ASSERT_TRUE(reader->Read(read_buffer.data(), read_buffer.size()).has_value());
+  EXPECT_EQ(read_buffer, NEW_DATA);
+  EXPECT_EQ(ReadBaseFile("/tmp/dir/f"), BASE_DATA);
+}
+
+TEST_F(FileSystemOverlayTest, DeleteHidesBase)
+{
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/tmp/dir"), ResultCode::Success);
+  EXPECT_EQ(m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/dir/f").error(), ResultCode::NotFound);
+  EXPECT_EQ(ReadBaseFile("/tmp/dir/f"), BASE_DATA);
+
+  // Recreating the directory must not bring back what was in it.
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/dir", 0, modes), ResultCode::Success);
+  ResetOverlay();
+  const Result<std::vector<std::string>> files = m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp/dir");
+  ASSERT_TRUE(files.has_value());
+  EXPECT_TRUE(files->empty());
+}
+
+TEST_F(FileSystemOverlayTest, RenameFromBase)
+{
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/dir", "/tmp/dir2"), ResultCode::Success);
+  EXPECT_EQ(ReadFile(*m_fs, "/tmp/dir2/f"), BASE_DATA);
+  EXPECT_EQ(m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp/dir").error(), ResultCode::NotFound);
+
+  const Result<std::vector<std::string>> tmp_files = m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp");
+  ASSERT_TRUE(tmp_files.has_value());
+  EXPECT_EQ(*tmp_files, std::vector<std::string>{"dir2"});
+  EXPECT_EQ(ReadBaseFile("/tmp/dir/f"), BASE_DATA);
+}
+
+TEST_F(FileSystemOverlayTest, RenameWithBasePathAsRootPrefix)
+{
+  m_fs.reset();
+  File::DeleteDirRecursively(m_overlay_path);
+  m_overlay_path = m_base_path + "2";
+  ResetOverlay();
+
+  // A file in the overlay, whose host path starts with the base path.
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/dir/g", 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/dir", "/tmp/dir2"), ResultCode::Success);
+
+  EXPECT_EQ(ReadFile(*m_fs, "/tmp/dir2/f"), BASE_DATA);
+  EXPECT_TRUE(m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/dir2/g").has_value());
+  EXPECT_EQ(ReadBaseFile("/tmp/dir/f"), BASE_DATA);
+}
+
+TEST_F(FileSystemOverlayTest, FormatHidesBase)
+{
+  ASSERT_EQ(m_fs->Format(Uid{0}), ResultCode::Success);
+  ResetOverlay();
+  EXPECT_EQ(m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp").error(), ResultCode::NotFound);
+  EXPECT_EQ(ReadBaseFile("/tmp/dir/f"), BASE_DATA);
+}
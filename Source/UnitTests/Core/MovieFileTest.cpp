@@ -0,0 +1,196 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/MovieFile.h"
+
+using Movie::FrameIndexEntry;
+using Movie::Keyframe;
+using Movie::MovieData;
+
+namespace
+{
+// Stands in for the DTMHeader, which the seekable data follows.
+constexpr size_t HEADER_SIZE = 256;
+
+struct TestMovie
+{
+  std::vector<u8> input;
+  std::vector<FrameIndexEntry> frame_index;
+};
+
+// Two 8 byte pads per frame, with the sticks slowly moving and a button pressed now and then.
+// Every hundredth frame also has a variable length record, like a Wii Remote changing modes.
+TestMovie MakeTestMovie(u64 frames)
+{
+  TestMovie movie;
+  for (u64 frame = 0; frame < frames; ++frame)
+  {
+    movie.frame_index.push_back({frame, movie.input.size()});
+    for (u8 pad = 0; pad < 2; ++pad)
+    {
+      movie.input.insert(movie.input.end(), {static_cast<u8>(frame % 50 == 0), 0x80, 0, 0,
+                                             static_cast<u8>(frame / 16), 128, pad, 128});
+    }
+    if (frame % 100 == 0)
+      movie.input.insert(movie.input.end(), frame % 7 + 1, static_cast<u8>(frame));
+  }
+  return movie;
+}
+
+std::vector<u8> MakeTestState(size_t size, u32 seed)
+{
+  std::vector<u8> state(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    state[i] = (i % 5 == 0) ? static_cast<u8>(seed >> 24) : static_cast<u8>(i / 256);
+  }
+  return state;
+}
+
+// A zstd frame whose header claims that it holds content_size bytes, with a single RLE block.
+std::vector<u8> MakeZstdFrame(u64 content_size)
+{
+  // The magic number, then a single segment frame with an 8 byte content size.
+  std::vector<u8> frame{0x28, 0xb5, 0x2f, 0xfd, 0xe0};
+  for (int i = 0; i < 8; ++i)
+    frame.push_back(static_cast<u8>(content_size >> (i * 8)));
+
+  // The last block, 128 KiB of zeroes.
+  const u32 block_header = 1 | (1 << 1) | (128 * 1024 << 3);
+  frame.insert(frame.end(), {static_cast<u8>(block_header), static_cast<u8>(block_header >> 8),
+                             static_cast<u8>(block_header >> 16), 0});
+  return frame;
+}
+
+class MovieFileTest : public ::testing::Test
+{
+protected:
+  MovieFileTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/movie.dtm") {}
+  ~MovieFileTest() override { File::DeleteDirRecursively(m_directory); }
+
+  bool Write(const TestMovie& movie, const std::vector<Keyframe>& keyframes)
+  {
+    File::IOFile file(m_path, "wb");
+    const std::vector<u8> header(HEADER_SIZE, 0xcc);
+    return file.WriteBytes(header.data(), header.size()) &&
+           Movie::WriteSeekableMovieData(file, movie.input, movie.frame_index, keyframes, 1234);
+  }
+
+  std::optional<MovieData> Read()
+  {
+    File::IOFile file(m_path, "rb");
+    file.Seek(HEADER_SIZE, File::SeekOrigin::Begin);
+    return Movie::ReadSeekableMovieData(file);
+  }
+
+  std::string m_directory;
+  std::string m_path;
+};
+}  // namespace
+
+TEST_F(MovieFileTest, RoundTrip)
+{
+  const TestMovie movie = MakeTestMovie(10000);
+  const std::vector<u8> state_a = MakeTestState(300000, 1);
+  const std::vector<u8> state_b = MakeTestState(200000, 2);
+  const std::vector<Keyframe> keyframes = {Movie::CompressKeyframe(3600, 58000, state_a),
+                                           Movie::CompressKeyframe(7201, 115000, state_b)};
+
+  ASSERT_TRUE(Write(movie, keyframes));
+  const std::optional<MovieData> data = Read();
+  ASSERT_TRUE(data.has_value());
+
+  EXPECT_EQ(data->input, movie.input);
+  EXPECT_EQ(data->frame_index, movie.frame_index);
+  EXPECT_EQ(data->state_version, 1234u);
+  ASSERT_EQ(data->keyframes.size(), keyframes.size());
+  for (size_t i = 0; i < keyframes.size(); ++i)
+  {
+    EXPECT_EQ(data->keyframes[i].frame, keyframes[i].frame);
+    EXPECT_EQ(data->keyframes[i].input_byte, keyframes[i].input_byte);
+    EXPECT_EQ(data->keyframes[i].compressed_state, keyframes[i].compressed_state);
+  }
+
+  Common::UniqueBuffer<u8> state;
+  ASSERT_TRUE(Movie::DecompressKeyframe(data->keyframes[1], state));
+  EXPECT_EQ(std::vector<u8>(state.begin(), state.end()), state_b);
+}
+
+TEST_F(MovieFileTest, EmptyMovie)
+{
+  ASSERT_TRUE(Write({}, {}));
+  const std::optional<MovieData> data = Read();
+  ASSERT_TRUE(data.has_value());
+  EXPECT_TRUE(data->input.empty());
+  EXPECT_TRUE(data->frame_index.empty());
+  EXPECT_TRUE(data->keyframes.empty());
+}
+
+TEST_F(MovieFileTest, CompressesInput)
+{
+  const TestMovie movie = MakeTestMovie(100000);
+  ASSERT_TRUE(Write(movie, {}));
+
+  // Stored as in version 1 files, the input alone would take more than 1.6 MB.
+  EXPECT_LT(File::GetSize(m_path), HEADER_SIZE + 40000);
+}
+
+TEST_F(MovieFileTest, RejectsTruncatedFile)
+{
+  const TestMovie movie = MakeTestMovie(1000);
+  ASSERT_TRUE(Write(movie, {Movie::CompressKeyframe(500, 8000, MakeTestState(50000, 3))}));
+
+  const u64 size = File::GetSize(m_path);
+  for (const u64 removed : {u64{1}, u64{100}, size / 2, size - HEADER_SIZE - 10})
+  {
+    {
+      File::IOFile file(m_path, "r+b");
+      ASSERT_TRUE(file.Resize(size - removed));
+    }
+    EXPECT_FALSE(Read().has_value()) << removed;
+  }
+}
+
+TEST_F(MovieFileTest, RejectsOversizedInput)
+{
+  // Neither of these should be allocated: the first is above the limit, and the second can't be
+  // decompressed from so few bytes.
+  for (const u64 input_size : {u64{1} << 40, u64{200} * 1024 * 1024})
+  {
+    const std::vector<u8> compressed_input = MakeZstdFrame(input_size);
+    Movie::DTMSeekableHeader header{};
+    header.input_size = input_size;
+    header.compressed_input_size = compressed_input.size();
+
+    {
+      File::IOFile file(m_path, "wb");
+      const std::vector<u8> dtm_header(HEADER_SIZE, 0xcc);
+      ASSERT_TRUE(file.WriteBytes(dtm_header.data(), dtm_header.size()));
+      ASSERT_TRUE(file.WriteArray(&header, 1));
+      ASSERT_TRUE(file.WriteBytes(compressed_input.data(), compressed_input.size()));
+    }
+    EXPECT_FALSE(Read().has_value()) << input_size;
+  }
+}
+
+TEST_F(MovieFileTest, RejectsOversizedKeyframe)
+{
+  for (const u64 state_size : {u64{1} << 40, u64{200} * 1024 * 1024})
+  {
+    const Keyframe keyframe{0, 0, state_size, MakeZstdFrame(state_size)};
+    Common::UniqueBuffer<u8> state;
+    EXPECT_FALSE(Movie::DecompressKeyframe(keyframe, state)) << state_size;
+    EXPECT_TRUE(state.empty());
+  }
+}
@@ -0,0 +1,215 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <SFML/Network/Packet.hpp>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/NetPlayCommon.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace
+{
+std::vector<u8> MakeTestData(size_t size)
+{
+  // Partly repetitive, so that the data is neither trivially compressible nor incompressible.
+  std::vector<u8> data(size);
+  u32 state = 1;
+  for (size_t i = 0; i < size; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    data[i] = (i % 7 == 0) ? static_cast<u8>(state >> 24) : static_cast<u8>(i / 64);
+  }
+  return data;
+}
+
+bool WriteFile(const std::string& path, const std::vector<u8>& data)
+{
+  return File::WriteStringToFile(path, std::string(data.begin(), data.end()));
+}
+
+// Passes the requested data from the sender to the receiver in pieces which don't line up with
+// the compressed frames, like the units of the chunked data channel.
+bool Transfer(const NetPlay::SyncDataSender& sender, NetPlay::SyncDataReceiver& receiver)
+{
+  sf::Packet request;
+  receiver.WriteRequest(request);
+  const std::optional<std::vector<bool>> requested = sender.ReadRequest(request);
+  if (!requested || sender.GetSize(*requested) != receiver.GetRequestedSize())
+    return false;
+
+  const bool success = sender.Compress(*requested, [&](std::span<const u8> data) {
+    for (size_t i = 0; i < data.size(); i += 1000)
+    {
+      if (!receiver.Receive(data.subspan(i, std::min<size_t>(1000, data.size() - i))))
+        return false;
+    }
+    return true;
+  });
+  return success && receiver.IsComplete();
+}
+}  // namespace
+
+TEST(NetPlayCommon, BufferRoundTrip)
+{
+  for (const size_t size : {size_t{0}, size_t{1}, size_t{1000}, size_t{3 * 1024 * 1024 + 17}})
+  {
+    const std::vector<u8> data = MakeTestData(size);
+
+    NetPlay::SyncDataSender sender;
+    sf::Packet packet;
+    sender.AddBuffer(data, packet);
+    packet << u32{0x12345678};
+
+    NetPlay::SyncDataReceiver receiver;
+    const std::optional<size_t> index = receiver.ReadBuffer(packet, std::nullopt);
+    ASSERT_TRUE(index.has_value());
+
+    // The description must be consumed exactly, as other data follows it in sync packets.
+    u32 trailer = 0;
+    packet >> trailer;
+    EXPECT_EQ(trailer, 0x12345678u);
+    EXPECT_TRUE(packet.endOfPacket());
+
+    EXPECT_EQ(receiver.GetRequestedSize(), size);
+    ASSERT_TRUE(Transfer(sender, receiver));
+    EXPECT_EQ(receiver.GetReceivedSize(), size);
+    EXPECT_EQ(receiver.TakeBuffer(*index), data);
+  }
+}
+
+TEST(NetPlayCommon, BufferWithSameDataIsNotRequested)
+{
+  const std::vector<u8> data = MakeTestData(5000);
+  std::vector<u8> changed = data;
+  changed[1234] ^= 1;
+
+  NetPlay::SyncDataSender sender;
+  sf::Packet packet;
+  sender.AddBuffer(data, packet);
+  sender.AddBuffer(data, packet);
+
+  NetPlay::SyncDataReceiver receiver;
+  const std::optional<size_t> same = receiver.ReadBuffer(packet, data);
+  const std::optional<size_t> different = receiver.ReadBuffer(packet, changed);
+  ASSERT_TRUE(same.has_value());
+  ASSERT_TRUE(different.has_value());
+
+  EXPECT_EQ(receiver.GetRequestedSize(), data.size());
+  ASSERT_TRUE(Transfer(sender, receiver));
+  EXPECT_EQ(receiver.TakeBuffer(*same), data);
+  EXPECT_EQ(receiver.TakeBuffer(*different), data);
+}
+
+TEST(NetPlayCommon, FolderRoundTrip)
+{
+  const std::string source = File::CreateTempDir();
+  const std::string target = File::CreateTempDir();
+  ASSERT_FALSE(source.empty());
+  ASSERT_FALSE(target.empty());
+
+  const std::vector<u8> large = MakeTestData(2 * 1024 * 1024 + 5);
+  const std::vector<u8> small = MakeTestData(100);
+  ASSERT_TRUE(File::CreateDir(source + "/sub"));
+  ASSERT_TRUE(WriteFile(source + "/large.bin", large));
+  ASSERT_TRUE(WriteFile(source + "/sub/small.bin", small));
+  ASSERT_TRUE(WriteFile(source + "/sub/empty.bin", {}));
+
+  // Left over from a previous sync. Only the file which differs has to be sent again.
+  ASSERT_TRUE(File::CreateDir(target + "/out"));
+  ASSERT_TRUE(File::CreateDir(target + "/out/sub"));
+  ASSERT_TRUE(WriteFile(target + "/out/large.bin", large));
+  ASSERT_TRUE(WriteFile(target + "/out/sub/small.bin", MakeTestData(99)));
+  ASSERT_TRUE(WriteFile(target + "/out/sub/empty.bin", small));
+  ASSERT_TRUE(WriteFile(target + "/out/stale.bin", small));
+
+  NetPlay::SyncDataSender sender;
+  sf::Packet packet;
+  ASSERT_TRUE(sender.AddFolder(source, packet));
+
+  NetPlay::SyncDataReceiver receiver;
+  ASSERT_TRUE(receiver.ReadFolder(packet, target + "/out"));
+  EXPECT_TRUE(packet.endOfPacket());
+  EXPECT_EQ(receiver.GetRequestedSize(), small.size());
+  ASSERT_TRUE(Transfer(sender, receiver));
+
+  std::string contents;
+  ASSERT_TRUE(File::ReadFileToString(target + "/out/large.bin", contents));
+  EXPECT_EQ(contents, std::string(large.begin(), large.end()));
+  ASSERT_TRUE(File::ReadFileToString(target + "/out/sub/small.bin", contents));
+  EXPECT_EQ(contents, std::string(small.begin(), small.end()));
+  EXPECT_FALSE(File::Exists(target + "/out/sub/empty.bin"));
+  EXPECT_FALSE(File::Exists(target + "/out/stale.bin"));
+
+  File::DeleteDirRecursively(source);
+  File::DeleteDirRecursively(target);
+}
+
+TEST(NetPlayCommon, InputDeltaRoundTrip)
+{
+  NetPlay::SerializedInput sent_state;
+  NetPlay::SerializedInput received_state;
+
+  GCPadStatus pad;
+  std::vector<NetPlay::SerializedInput> inputs;
+  for (int i = 0; i < 100; ++i)
+  {
+    pad.stickX = static_cast<u8>(0x80 + i / 3);
+    if (i % 10 == 0)
+      pad.button ^= 0x0101;
+    // Switching between a GBA and a controller changes the length of the state.
+    inputs.push_back(NetPlay::SerializeGCPadStatus(pad, i >= 50 && i < 60));
+  }
+
+  sf::Packet packet;
+  for (const NetPlay::SerializedInput& input : inputs)
+    NetPlay::EncodeInputDelta(input, sent_state, packet);
+
+  // Most polls only change a few bytes, so the deltas are much smaller than the states.
+  EXPECT_LT(packet.getDataSize(), inputs.size() * 6);
+
+  for (const NetPlay::SerializedInput& input : inputs)
+  {
+    ASSERT_TRUE(NetPlay::DecodeInputDelta(packet, received_state));
+    ASSERT_EQ(received_state.length, input.length);
+    EXPECT_TRUE(std::ranges::equal(received_state.GetData(), input.GetData()));
+  }
+  EXPECT_TRUE(packet.endOfPacket());
+
+  const GCPadStatus result = NetPlay::DeserializeGCPadStatus(received_state);
+  EXPECT_EQ(result.button, pad.button);
+  EXPECT_EQ(result.stickX, pad.stickX);
+  EXPECT_EQ(result.isConnected, pad.isConnected);
+}
+
+TEST(NetPlayCommon, InputDeltaRejectsMalformedPackets)
+{
+  NetPlay::SerializedInput state;
+
+  sf::Packet too_long;
+  too_long << u8{NetPlay::SerializedInput::MAX_SIZE + 1};
+  EXPECT_FALSE(NetPlay::DecodeInputDelta(too_long, state));
+
+  sf::Packet truncated;
+  truncated << u8{11} << u8{0xff};
+  EXPECT_FALSE(NetPlay::DecodeInputDelta(truncated, state));
+}
+
+TEST(NetPlayCommon, AdaptivePadBufferSize)
+{
+  // Without any latency, a single entry covers the jitter.
+  EXPECT_EQ(NetPlay::GetAdaptivePadBufferSize(std::vector<u32>{0, 0}), 1u);
+
+  // The host has no latency to itself, so input from a client takes half of its round trip time.
+  EXPECT_EQ(NetPlay::GetAdaptivePadBufferSize(std::vector<u32>{0, 80}), 6u);
+
+  // Between two clients, input goes through the host.
+  EXPECT_EQ(NetPlay::GetAdaptivePadBufferSize(std::vector<u32>{0, 80, 10, 80}), 11u);
+}
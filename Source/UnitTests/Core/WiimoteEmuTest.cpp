@@ -0,0 +1,156 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Common/Matrix.h"
+#include "Core/HW/WiimoteCommon/DataReport.h"
+#include "Core/HW/WiimoteEmu/Camera.h"
+#include "Core/HW/WiimoteEmu/Dynamics.h"
+
+using Common::Matrix33;
+using Common::Matrix44;
+using Common::Vec2;
+using Common::Vec3;
+using Common::Vec4;
+using WiimoteCommon::DataReportBuilder;
+using WiimoteCommon::InputReportID;
+using WiimoteEmu::CameraLogic;
+using WiimoteEmu::CameraPoint;
+
+namespace
+{
+// Scripted pointing, swinging and tilting, different for each of four Wii Remotes.
+Matrix44 GetScriptedTransformation(int wiimote, int step)
+{
+  const float t = step / 200.f + wiimote;
+  const Vec3 angle{0.2f * std::sin(t * 1.3f), 0.5f * std::cos(t * 0.7f), 0.25f * std::sin(t)};
+  const Vec3 position{0.3f * std::sin(t * 0.9f), 2 + 0.5f * std::cos(t * 0.4f),
+                      0.2f * std::sin(t * 2.1f)};
+
+  return Matrix44::FromMatrix33(WiimoteEmu::GetRotationalMatrix(-angle)) *
+         Matrix44::Translate(-position);
+}
+
+// The camera transformation as it was done before it was simplified.
+std::array<CameraPoint, CameraLogic::NUM_POINTS>
+GetReferenceCameraPoints(const Matrix44& transform, Vec2 field_of_view)
+{
+  const auto camera_view =
+      Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
+      Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4))) * transform;
+
+  std::array<CameraPoint, CameraLogic::NUM_POINTS> camera_points;
+  for (int i = 0; i != 2; ++i)
+  {
+    const Vec3 led{(i ? 1 : -1) * CameraLogic::SENSOR_BAR_LED_SEPARATION / 2, 0, 0};
+    const Vec4 point = camera_view * Vec4(led, 1.0);
+    if (point.z < 0)
+      continue;
+
+    const auto x = s32((1 - point.x / point.w) * CameraLogic::CAMERA_RES_X / 2);
+    const auto y = s32((1 - point.y / point.w) * CameraLogic::CAMERA_RES_Y / 2);
+    if (x < 0 || y < 0 || x >= CameraLogic::CAMERA_RES_X || y >= CameraLogic::CAMERA_RES_Y)
+      continue;
+
+    const auto size = std::clamp<s32>(std::lround(2.37f * std::pow(point.z, -0.778f)), 1,
+                                      CameraLogic::MAX_POINT_SIZE);
+    camera_points[i] = CameraPoint({u16(x), u16(y)}, u8(size));
+  }
+  return camera_points;
+}
+}  // namespace
+
+TEST(WiimoteEmu, RotationalMatrix)
+{
+  for (int step = 0; step != 1000; ++step)
+  {
+    const Vec3 angle{std::sin(step * 0.1f) * 3, std::cos(step * 0.3f) * 2, step * 0.01f - 5};
+    const Matrix33 expected = Matrix33::RotateZ(angle.z) * Matrix33::RotateY(angle.y) *
+                              Matrix33::RotateX(angle.x);
+    const Matrix33 actual = WiimoteEmu::GetRotationalMatrix(angle);
+
+    for (size_t i = 0; i != expected.data.size(); ++i)
+      EXPECT_NEAR(expected.data[i], actual.data[i], 1e-6f);
+  }
+}
+
+TEST(WiimoteEmu, CameraPointsMatchReference)
+{
+  const Vec2 field_of_view = Vec2(42, 31.5f) / 360 * float(MathUtil::TAU);
+
+  // Four Wii Remotes at 200 updates per second for ten seconds.
+  int visible_points = 0;
+  for (int step = 0; step != 2000; ++step)
+  {
+    for (int wiimote = 0; wiimote != 4; ++wiimote)
+    {
+      const Matrix44 transform = GetScriptedTransformation(wiimote, step);
+      const auto expected = GetReferenceCameraPoints(transform, field_of_view);
+      const auto actual = CameraLogic::GetCameraPoints(transform, field_of_view);
+
+      for (size_t i = 0; i != expected.size(); ++i)
+      {
+        // Rounding differences may move a point by a pixel, or across the edge of the view.
+        if (expected[i] == CameraPoint() || actual[i] == CameraPoint())
+          continue;
+
+        ++visible_points;
+        EXPECT_LE(std::abs(expected[i].position.x - actual[i].position.x), 1);
+        EXPECT_LE(std::abs(expected[i].position.y - actual[i].position.y), 1);
+        EXPECT_EQ(expected[i].size, actual[i].size);
+      }
+    }
+  }
+
+  // Make sure the script actually points at the sensor bar most of the time.
+  EXPECT_GT(visible_points, 2000 * 4);
+}
+
+TEST(WiimoteEmu, DataReportBuilder)
+{
+  for (u8 id = 0x30; id != 0x40; ++id)
+  {
+    const auto mode = static_cast<InputReportID>(id);
+    if (!DataReportBuilder::IsValidMode(mode))
+      continue;
+
+    DataReportBuilder builder(mode);
+    u8 buffer[DataReportBuilder::MAX_DATA_SIZE + 1] = {};
+    const auto manipulator = WiimoteCommon::MakeDataReportManipulator(mode, buffer + 1);
+
+    EXPECT_EQ(builder.GetMode(), mode);
+    EXPECT_EQ(builder.GetDataSize(), manipulator->GetDataSize() + 1);
+    EXPECT_EQ(builder.HasCore(), manipulator->HasCore());
+    EXPECT_EQ(builder.HasAccel(), manipulator->HasAccel());
+    EXPECT_EQ(builder.GetIRDataSize(), manipulator->GetIRDataSize());
+    EXPECT_EQ(builder.GetExtDataSize(), manipulator->GetExtDataSize());
+    if (builder.HasIR())
+    {
+      EXPECT_EQ(builder.GetIRDataPtr() - builder.GetDataPtr(),
+                manipulator->GetIRDataPtr() - buffer);
+    }
+    if (builder.HasExt())
+    {
+      EXPECT_EQ(builder.GetExtDataPtr() - builder.GetDataPtr(),
+                manipulator->GetExtDataPtr() - buffer);
+    }
+
+    // Switching back and forth, as the interleaved modes do, keeps the data.
+    WiimoteCommon::ButtonData buttons{};
+    buttons.hex = WiimoteCommon::ButtonData::BUTTON_MASK & 0x1234;
+    builder.SetCoreData(buttons);
+    builder.SetMode(InputReportID::ReportCore);
+    builder.SetMode(mode);
+    WiimoteCommon::ButtonData result{};
+    builder.GetCoreData(&result);
+    EXPECT_EQ(result.hex, builder.HasCore() ? buttons.hex : 0);
+  }
+}
@@ -0,0 +1,169 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "InputCommon/ControlReference/CompiledExpression.h"
+#include "InputCommon/ControlReference/ExpressionParser.h"
+#include "InputCommon/ControllerInterface/CoreDevice.h"
+
+using namespace ciface::ExpressionParser;
+using ciface::Core::Device;
+
+namespace
+{
+class TestInput final : public Device::Input
+{
+public:
+  explicit TestInput(std::string name) : m_name(std::move(name)) {}
+
+  std::string GetName() const override { return m_name; }
+  ControlState GetState() const override
+  {
+    ++reads;
+    return state;
+  }
+
+  ControlState state = 0;
+  mutable int reads = 0;
+
+private:
+  std::string m_name;
+};
+
+class TestDevice final : public Device
+{
+public:
+  TestDevice()
+  {
+    for (const char* name : {"A", "B", "C"})
+    {
+      auto* const input = new TestInput(name);
+      inputs.push_back(input);
+      AddInput(input);
+    }
+  }
+
+  std::string GetName() const override { return "Device"; }
+  std::string GetSource() const override { return "Test"; }
+
+  std::vector<TestInput*> inputs;
+};
+
+class TestContainer final : public ciface::Core::DeviceContainer
+{
+public:
+  void AddDevice(std::shared_ptr<Device> device) { m_devices.push_back(std::move(device)); }
+};
+
+class CompiledExpressionTest : public ::testing::Test
+{
+protected:
+  CompiledExpressionTest()
+  {
+    m_container.AddDevice(m_device);
+    m_default_device.FromDevice(m_device.get());
+  }
+
+  std::unique_ptr<Expression> Parse(const std::string& str,
+                                    ControlEnvironment::VariableContainer& variables)
+  {
+    ParseResult result = ParseExpression(str);
+    EXPECT_EQ(result.status, ParseStatus::Successful) << str;
+    ControlEnvironment env(m_container, m_default_device, variables);
+    result.expr->UpdateReferences(env);
+    return std::move(result.expr);
+  }
+
+  void SetInputs(ControlState a, ControlState b, ControlState c)
+  {
+    m_device->inputs[0]->state = a;
+    m_device->inputs[1]->state = b;
+    m_device->inputs[2]->state = c;
+  }
+
+  // Evaluates separately parsed copies of the expression through the tree and the bytecode, so
+  // that stateful functions see the same sequence of inputs in both.
+  void ExpectSameResults(const std::string& str)
+  {
+    ControlEnvironment::VariableContainer tree_variables;
+    ControlEnvironment::VariableContainer compiled_variables;
+    const std::unique_ptr<Expression> tree = Parse(str, tree_variables);
+    const std::unique_ptr<Expression> compiled_tree = Parse(str, compiled_variables);
+    CompiledExpression compiled = ExpressionCompiler::Compile(*compiled_tree);
+
+    for (const ControlState a : {0.0, 0.3, 0.6, 1.0})
+    {
+      for (const ControlState b : {0.0, 0.5, 1.0})
+      {
+        for (const ControlState c : {-0.5, 0.25, 2.0})
+        {
+          SetInputs(a, b, c);
+          const ControlState expected = tree->GetValue();
+          const ControlState actual = compiled.Evaluate();
+          if (std::isnan(expected))
+            EXPECT_TRUE(std::isnan(actual)) << str;
+          else
+            EXPECT_EQ(expected, actual) << str << " with " << a << ", " << b << ", " << c;
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<TestDevice> m_device = std::make_shared<TestDevice>();
+  TestContainer m_container;
+  ciface::Core::DeviceQualifier m_default_device;
+};
+}  // namespace
+
+TEST_F(CompiledExpressionTest, MatchesTree)
+{
+  for (const char* str : {
+           "`A`",
+           "`A` + `B` * 2 - `C` / `B` % 0.3",
+           "`A` & `B` | `C` ^ `A`",
+           "`A` < `B`, `B` > `C`",
+           "!`A` + -`B` + +`C`",
+           "if(`A` > 0.5, `B` * 3, `C` - 1)",
+           "`A` ? `B` : `A` ? 1 : `C`",
+           "abs(`C`) + sin(`A`) + cos(`B`) + tan(`C`) + asin(`C`) + acos(`A`) + atan(`B`)",
+           "atan2(`A`, `C`) + sqrt(`C`) + pow(`A`, `C`) + min(`A`, `C`) + max(`B`, `C`)",
+           "clamp(`C` * 2, `A` - 1, 1) + deadzone(`C`, 0.2)",
+           "$x = `A` + `B`, $x * 2 + $x",
+           "$y += `A`, toggle(`B`) + $y",
+           "@(`A`+`B`) + `C`",
+           "`Missing` + `A`",
+       })
+  {
+    ExpectSameResults(str);
+  }
+}
+
+TEST_F(CompiledExpressionTest, FoldsConstants)
+{
+  ControlEnvironment::VariableContainer variables;
+  const std::unique_ptr<Expression> expr =
+      Parse("(1 + 2) * 3 - sin(0) + if(1, 5, `A`) + `Missing` * 4", variables);
+  CompiledExpression compiled = ExpressionCompiler::Compile(*expr);
+
+  EXPECT_EQ(compiled.GetInstructionCount(), 0u);
+  EXPECT_EQ(compiled.Evaluate(), 14.0);
+}
+
+TEST_F(CompiledExpressionTest, ReadsEachInputOnce)
+{
+  ControlEnvironment::VariableContainer variables;
+  const std::unique_ptr<Expression> expr = Parse("`A` * `A` + max(`A`, `B`)", variables);
+  CompiledExpression compiled = ExpressionCompiler::Compile(*expr);
+
+  SetInputs(0.5, 1.0, 0.0);
+  m_device->inputs[0]->reads = 0;
+  EXPECT_EQ(compiled.Evaluate(), 1.25);
+  EXPECT_EQ(m_device->inputs[0]->reads, 1);
+}
@@ -0,0 +1,165 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Event.h"
+#include "VideoCommon/AsyncShaderCompiler.h"
+
+using VideoCommon::AsyncShaderCompiler;
+using Priority = AsyncShaderCompiler::Priority;
+
+namespace
+{
+struct Log
+{
+  std::mutex lock;
+  std::vector<int> compiled;
+  std::vector<int> retrieved;
+  std::vector<int> destroyed;
+};
+
+class TestWorkItem final : public AsyncShaderCompiler::WorkItem
+{
+public:
+  TestWorkItem(Log* log, int id) : m_log(log), m_id(id) {}
+  ~TestWorkItem() override
+  {
+    std::lock_guard guard(m_log->lock);
+    m_log->destroyed.push_back(m_id);
+  }
+
+  bool Compile() override
+  {
+    std::lock_guard guard(m_log->lock);
+    m_log->compiled.push_back(m_id);
+    return true;
+  }
+
+  void Retrieve() override { m_log->retrieved.push_back(m_id); }
+
+private:
+  Log* m_log;
+  int m_id;
+};
+
+// Occupies a worker thread until released.
+class BlockingWorkItem final : public AsyncShaderCompiler::WorkItem
+{
+public:
+  BlockingWorkItem(Common::Event* started, Common::Event* release)
+      : m_started(started), m_release(release)
+  {
+  }
+
+  bool Compile() override
+  {
+    m_started->Set();
+    m_release->Wait();
+    return true;
+  }
+
+  void Retrieve() override {}
+
+private:
+  Common::Event* m_started;
+  Common::Event* m_release;
+};
+
+void WaitForWorkers(AsyncShaderCompiler& compiler)
+{
+  while (compiler.HasPendingWork())
+    std::this_thread::yield();
+}
+}  // namespace
+
+TEST(AsyncShaderCompiler, CompilesInPriorityOrder)
+{
+  AsyncShaderCompiler compiler;
+  ASSERT_TRUE(compiler.StartWorkerThreads(1));
+
+  Common::Event started, release;
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<BlockingWorkItem>(&started, &release),
+                         Priority::Background);
+  started.Wait();
+
+  Log log;
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, 1),
+                         Priority::Background);
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, 2),
+                         Priority::CurrentFrame);
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, 3),
+                         Priority::Background);
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, 4),
+                         Priority::CurrentFrame);
+  release.Set();
+
+  WaitForWorkers(compiler);
+  compiler.RetrieveWorkItems();
+  compiler.StopWorkerThreads();
+
+  EXPECT_EQ(log.compiled, (std::vector<int>{2, 4, 1, 3}));
+  EXPECT_EQ(log.retrieved, (std::vector<int>{2, 4, 1, 3}));
+}
+
+TEST(AsyncShaderCompiler, CancelledItemsAreNotCompiled)
+{
+  AsyncShaderCompiler compiler;
+  ASSERT_TRUE(compiler.StartWorkerThreads(1));
+
+  Common::Event started, release;
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<BlockingWorkItem>(&started, &release),
+                         Priority::Background);
+  started.Wait();
+
+  Log log;
+  auto item = AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, 1);
+  AsyncShaderCompiler::WorkItem* cancelled = item.get();
+  compiler.QueueWorkItem(std::move(item), Priority::CurrentFrame);
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, 2),
+                         Priority::CurrentFrame);
+  cancelled->Cancel();
+  release.Set();
+
+  WaitForWorkers(compiler);
+  EXPECT_TRUE(log.destroyed.empty());
+  compiler.RetrieveWorkItems();
+  compiler.StopWorkerThreads();
+
+  EXPECT_EQ(log.compiled, std::vector<int>{2});
+  EXPECT_EQ(log.retrieved, std::vector<int>{2});
+  EXPECT_EQ(log.destroyed, (std::vector<int>{1, 2}));
+}
+
+TEST(AsyncShaderCompiler, CompilesAllItemsWithManyWorkers)
+{
+  AsyncShaderCompiler compiler;
+  ASSERT_TRUE(compiler.StartWorkerThreads(4));
+
+  constexpr int NUM_ITEMS = 1000;
+  Log log;
+  for (int i = 0; i < NUM_ITEMS; i++)
+  {
+    compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, i),
+                           static_cast<Priority>(i % AsyncShaderCompiler::NUM_PRIORITIES));
+  }
+
+  WaitForWorkers(compiler);
+  compiler.RetrieveWorkItems();
+  EXPECT_EQ(log.compiled.size(), static_cast<size_t>(NUM_ITEMS));
+  EXPECT_EQ(log.retrieved.size(), static_cast<size_t>(NUM_ITEMS));
+
+  ASSERT_TRUE(compiler.ResizeWorkerThreads(2));
+  compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&log, NUM_ITEMS),
+                         Priority::Background);
+  WaitForWorkers(compiler);
+  compiler.RetrieveWorkItems();
+  compiler.StopWorkerThreads();
+
+  EXPECT_EQ(log.retrieved.size(), static_cast<size_t>(NUM_ITEMS + 1));
+}
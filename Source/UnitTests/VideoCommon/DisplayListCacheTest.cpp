@@ -0,0 +1,218 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+namespace
+{
+using namespace OpcodeDecoder;
+
+// Logs every callback, so that running a display list can be compared with replaying it.
+class LoggingCallback : public Callback
+{
+public:
+  explicit LoggingCallback(const CPState& cp_state) : m_cp_state(cp_state) {}
+
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+  {
+    log.push_back(fmt::format("XF {:04x} {} {:02x}", address, count, data[0]));
+  }
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+  {
+    m_cp_state.LoadCPReg(command, value);
+    log.push_back(fmt::format("CP {:02x} {:08x}", command, value));
+  }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+  {
+    log.push_back(fmt::format("BP {:02x} {:06x}", command, value));
+  }
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+  {
+    log.push_back(fmt::format("INDX {} {} {:03x} {}", static_cast<u8>(array), index, address, size));
+  }
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices, const u8* vertex_data))
+  {
+    log.push_back(fmt::format("PRIM {} {} {} {} {:02x}", static_cast<u8>(primitive), vat,
+                              vertex_size, num_vertices, vertex_data[0]));
+  }
+  OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size))
+  {
+    log.push_back(fmt::format("DL {:08x} {}", address, size));
+  }
+  OPCODE_CALLBACK(void OnNop(u32 count)) { log.push_back(fmt::format("NOP {}", count)); }
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+  {
+    log.push_back(fmt::format("UNKNOWN {:02x}", opcode));
+  }
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size))
+  {
+    log.push_back(fmt::format("CMD {:02x} {}", data[0], size));
+  }
+  OPCODE_CALLBACK(CPState& GetCPState()) { return m_cp_state; }
+
+  std::vector<std::string> log;
+
+private:
+  CPState m_cp_state;
+};
+
+// Records which CachedVertices entry each primitive is replayed with.
+class CachingCallback final : public LoggingCallback
+{
+public:
+  using LoggingCallback::LoggingCallback;
+
+  void OnCachedPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat, u32 vertex_size,
+                                u16 num_vertices, const u8* vertex_data,
+                                VertexLoaderManager::CachedVertices* cached_vertices)
+  {
+    OnPrimitiveCommand(primitive, vat, vertex_size, num_vertices, vertex_data);
+    entries.push_back(cached_vertices);
+  }
+
+  std::vector<VertexLoaderManager::CachedVertices*> entries;
+};
+
+CPState PositionOnlyState(ComponentFormat format)
+{
+  CPState state;
+  state.vtx_desc.low.Position = VertexComponentFormat::Direct;
+  state.vtx_attr[0].g0.PosElements = CoordComponentCount::XYZ;
+  state.vtx_attr[0].g0.PosFormat = format;
+  return state;
+}
+
+// Appends a primitive with 3 vertices of <vertex_size> bytes each.
+void AddTriangle(std::vector<u8>* data, u32 vertex_size)
+{
+  data->insert(data->end(), {0x90, 0x00, 0x03});
+  for (u32 i = 0; i < 3 * vertex_size; ++i)
+    data->push_back(static_cast<u8>(i % 8));
+}
+
+std::vector<u8> MakeDisplayList(u32 vertex_size)
+{
+  std::vector<u8> data = {
+      0x61, 0x28, 0x12, 0x34, 0x56,                          // BP
+      0x10, 0x00, 0x00, 0x10, 0x00, 0xaa, 0xbb, 0xcc, 0xdd,  // XF
+      0x20, 0x00, 0x05, 0x30, 0x24,                          // Indexed load
+      0x44,                                                  // Unknown (metrics)
+  };
+  AddTriangle(&data, vertex_size);
+  data.insert(data.end(), {0x00, 0x00, 0x00});  // NOPs
+  AddTriangle(&data, vertex_size);
+  // Incomplete CP command at the end.
+  data.insert(data.end(), {0x08, 0x50});
+  return data;
+}
+}  // namespace
+
+TEST(DisplayListCache, ReplayMatchesDecoder)
+{
+  const CPState state = PositionOnlyState(ComponentFormat::Float);
+  const u32 vertex_size = 12;
+  const std::vector<u8> data = MakeDisplayList(vertex_size);
+  const u32 size = static_cast<u32>(data.size());
+
+  LoggingCallback expected(state);
+  const u32 expected_size = OpcodeDecoder::Run(data.data(), size, expected);
+
+  DisplayListCache cache;
+  // Display lists are only decoded once they are seen again with the same contents.
+  EXPECT_EQ(cache.Get(0x1000, data.data(), size, state), nullptr);
+  DecodedDisplayList* decoded = cache.Get(0x1000, data.data(), size, state);
+  ASSERT_NE(decoded, nullptr);
+
+  LoggingCallback actual(state);
+  EXPECT_EQ(RunDecoded(*decoded, data.data(), actual), expected_size);
+  EXPECT_EQ(actual.log, expected.log);
+
+  // Replaying again gives the same result.
+  LoggingCallback actual_again(state);
+  EXPECT_EQ(RunDecoded(*decoded, data.data(), actual_again), expected_size);
+  EXPECT_EQ(actual_again.log, expected.log);
+}
+
+TEST(DisplayListCache, ModifiedContentsAreNotReplayed)
+{
+  const CPState state = PositionOnlyState(ComponentFormat::Float);
+  std::vector<u8> data = MakeDisplayList(12);
+  const u32 size = static_cast<u32>(data.size());
+
+  DisplayListCache cache;
+  EXPECT_EQ(cache.Get(0x1000, data.data(), size, state), nullptr);
+  EXPECT_NE(cache.Get(0x1000, data.data(), size, state), nullptr);
+
+  data[2] ^= 0xff;
+  EXPECT_EQ(cache.Get(0x1000, data.data(), size, state), nullptr);
+  EXPECT_NE(cache.Get(0x1000, data.data(), size, state), nullptr);
+
+  // Same contents at another address are tracked separately.
+  EXPECT_EQ(cache.Get(0x2000, data.data(), size, state), nullptr);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Get(0x1000, data.data(), size, state), nullptr);
+}
+
+TEST(DisplayListCache, ReplayStopsOnVertexFormatChange)
+{
+  const CPState float_state = PositionOnlyState(ComponentFormat::Float);
+  const CPState u8_state = PositionOnlyState(ComponentFormat::UByte);
+
+  std::vector<u8> data = {0x61, 0x28, 0x12, 0x34, 0x56};
+  const u32 primitive_offset = static_cast<u32>(data.size());
+  AddTriangle(&data, 12);
+  const u32 size = static_cast<u32>(data.size());
+
+  DisplayListCache cache;
+  cache.Get(0x1000, data.data(), size, float_state);
+  DecodedDisplayList* decoded = cache.Get(0x1000, data.data(), size, float_state);
+  ASSERT_NE(decoded, nullptr);
+
+  // With a different vertex format, replaying stops at the primitive, and the rest of the display
+  // list has to be decoded again.
+  LoggingCallback actual(u8_state);
+  EXPECT_EQ(RunDecoded(*decoded, data.data(), actual), primitive_offset);
+  OpcodeDecoder::Run(data.data() + primitive_offset, size - primitive_offset, actual);
+
+  LoggingCallback expected(u8_state);
+  OpcodeDecoder::Run(data.data(), size, expected);
+  EXPECT_EQ(actual.log, expected.log);
+}
+
+TEST(DisplayListCache, PrimitivesHaveCachedVertices)
+{
+  const CPState state = PositionOnlyState(ComponentFormat::Float);
+  const std::vector<u8> data = MakeDisplayList(12);
+  const u32 size = static_cast<u32>(data.size());
+
+  LoggingCallback expected(state);
+  OpcodeDecoder::Run(data.data(), size, expected);
+
+  DisplayListCache cache;
+  cache.Get(0x1000, data.data(), size, state);
+  DecodedDisplayList* decoded = cache.Get(0x1000, data.data(), size, state);
+  ASSERT_NE(decoded, nullptr);
+
+  CachingCallback first(state);
+  RunDecoded(*decoded, data.data(), first);
+  EXPECT_EQ(first.log, expected.log);
+  ASSERT_EQ(first.entries.size(), 2u);
+  EXPECT_NE(first.entries[0], nullptr);
+  EXPECT_NE(first.entries[0], first.entries[1]);
+
+  // Each primitive keeps its entry across calls.
+  CachingCallback second(state);
+  RunDecoded(*decoded, data.data(), second);
+  EXPECT_EQ(second.entries, first.entries);
+}
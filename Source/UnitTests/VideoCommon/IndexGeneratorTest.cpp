@@ -0,0 +1,157 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+using OpcodeDecoder::Primitive;
+
+constexpr u16 RESTART = UINT16_MAX;
+
+// Straightforward versions of the index generators, one primitive at a time.
+std::vector<u16> Reference(Primitive primitive, u32 num_verts, u32 index, bool pr)
+{
+  std::vector<u16> out;
+  const auto triangle = [&](u32 a, u32 b, u32 c) {
+    out.insert(out.end(), {static_cast<u16>(a), static_cast<u16>(b), static_cast<u16>(c)});
+    if (pr)
+      out.push_back(RESTART);
+  };
+
+  switch (primitive)
+  {
+  case Primitive::GX_DRAW_QUADS:
+  case Primitive::GX_DRAW_QUADS_2:
+  {
+    u32 i = 3;
+    for (; i < num_verts; i += 4)
+    {
+      if (pr)
+      {
+        out.insert(out.end(), {static_cast<u16>(index + i - 2), static_cast<u16>(index + i - 1),
+                               static_cast<u16>(index + i - 3), static_cast<u16>(index + i),
+                               RESTART});
+      }
+      else
+      {
+        triangle(index + i - 3, index + i - 2, index + i - 1);
+        triangle(index + i - 3, index + i - 1, index + i);
+      }
+    }
+    if (i == num_verts)
+      triangle(index + num_verts - 3, index + num_verts - 2, index + num_verts - 1);
+    break;
+  }
+  case Primitive::GX_DRAW_TRIANGLES:
+    for (u32 i = 2; i < num_verts; i += 3)
+      triangle(index + i - 2, index + i - 1, index + i);
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_STRIP:
+    if (pr)
+    {
+      for (u32 i = 0; i < num_verts; ++i)
+        out.push_back(static_cast<u16>(index + i));
+      out.push_back(RESTART);
+    }
+    else
+    {
+      for (u32 i = 2; i < num_verts; ++i)
+      {
+        if (i % 2 == 0)
+          triangle(index + i - 2, index + i - 1, index + i);
+        else
+          triangle(index + i - 2, index + i, index + i - 1);
+      }
+    }
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_FAN:
+  {
+    u32 i = 2;
+    if (pr)
+    {
+      for (; i + 3 <= num_verts; i += 3)
+      {
+        out.insert(out.end(), {static_cast<u16>(index + i - 1), static_cast<u16>(index + i),
+                               static_cast<u16>(index), static_cast<u16>(index + i + 1),
+                               static_cast<u16>(index + i + 2), RESTART});
+      }
+      for (; i + 2 <= num_verts; i += 2)
+      {
+        out.insert(out.end(), {static_cast<u16>(index + i - 1), static_cast<u16>(index + i),
+                               static_cast<u16>(index), static_cast<u16>(index + i + 1),
+                               RESTART});
+      }
+    }
+    for (; i < num_verts; ++i)
+      triangle(index, index + i - 1, index + i);
+    break;
+  }
+  case Primitive::GX_DRAW_LINES:
+    for (u32 i = 1; i < num_verts; i += 2)
+      out.insert(out.end(), {static_cast<u16>(index + i - 1), static_cast<u16>(index + i)});
+    break;
+  case Primitive::GX_DRAW_LINE_STRIP:
+    for (u32 i = 1; i < num_verts; ++i)
+      out.insert(out.end(), {static_cast<u16>(index + i - 1), static_cast<u16>(index + i)});
+    break;
+  case Primitive::GX_DRAW_POINTS:
+    for (u32 i = 0; i < num_verts; ++i)
+      out.push_back(static_cast<u16>(index + i));
+    break;
+  }
+
+  return out;
+}
+
+class IndexGeneratorTest : public testing::TestWithParam<bool>
+{
+protected:
+  void SetUp() override
+  {
+    m_old_backend_info = g_backend_info;
+    g_backend_info.bSupportsPrimitiveRestart = GetParam();
+    g_backend_info.bSupportsVSLinePointExpand = false;
+    m_generator.Init();
+  }
+  void TearDown() override { g_backend_info = m_old_backend_info; }
+
+  IndexGenerator m_generator;
+  BackendInfo m_old_backend_info;
+};
+}  // namespace
+
+TEST_P(IndexGeneratorTest, MatchesReference)
+{
+  const bool pr = GetParam();
+  // Enough room for the largest output (4 indices per vertex for lines).
+  std::vector<u16> buffer(0x1000);
+
+  for (u8 p = 0; p <= static_cast<u8>(Primitive::GX_DRAW_POINTS); ++p)
+  {
+    const auto primitive = static_cast<Primitive>(p);
+    for (u32 num_verts = 0; num_verts < 100; ++num_verts)
+    {
+      // Start with another primitive so that the base index isn't 0.
+      m_generator.Start(buffer.data());
+      m_generator.AddIndices(Primitive::GX_DRAW_POINTS, 5);
+      const u32 start = m_generator.GetIndexLen();
+      m_generator.AddIndices(primitive, num_verts);
+
+      const std::vector<u16> actual(buffer.begin() + start,
+                                    buffer.begin() + m_generator.GetIndexLen());
+      EXPECT_EQ(actual, Reference(primitive, num_verts, 5, pr))
+          << "primitive " << static_cast<int>(p) << ", " << num_verts << " vertices";
+      EXPECT_EQ(m_generator.GetNumVerts(), 5 + num_verts);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(PrimitiveRestart, IndexGeneratorTest, testing::Bool());